@@ -0,0 +1,93 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include "src/Physics/World/PhysicsWorld.h"
+#include "src/Physics/Contacts/ContactSolver.h"
+
+using namespace EngiGraph;
+
+/**
+ * Build 100 stacks of 10 unit boxes on an immovable ground, with the 4 corner contacts under each box.
+ * @details All boxes are falling, so the solver has to stop the whole stack.
+ */
+static void buildStacks(PhysicsWorld& world, std::vector<Contact>& contacts) {
+    BodyDescription description{};
+    description.mass = 0.0;
+    uint32_t ground = world.getIndex(world.createBody(description));
+    description.mass = 1.0;
+    description.inertia_tensor = Eigen::Matrix3d::Identity() / 6.0;
+    description.velocity = {0,-1,0};
+    for (int x = 0; x < 10; ++x) {
+        for (int z = 0; z < 10; ++z) {
+            uint32_t below = ground;
+            for (int y = 0; y < 10; ++y) {
+                description.position = {x * 2.0, y + 0.5, z * 2.0};
+                uint32_t box = world.getIndex(world.createBody(description));
+                for (double corner_x : {-0.5, 0.5}) {
+                    for (double corner_z : {-0.5, 0.5}) {
+                        contacts.push_back({below, box, description.position + Eigen::Vector3d{corner_x, -0.5, corner_z}, {0,1,0}});
+                    }
+                }
+                below = box;
+            }
+        }
+    }
+}
+
+/**
+ * Time solving the same stacking scene.
+ * @param threads Worker threads of the parallel solve, or 0 to solve serially.
+ * @return Average milliseconds per solve.
+ */
+static double measureSolve(uint32_t threads, ContactSolverStats& stats) {
+    PhysicsWorld world;
+    std::vector<Contact> contacts;
+    buildStacks(world, contacts);
+    ContactSolver solver;
+    solver.settings.parallel = threads > 0;
+    if(threads > 0) solver.setExecutor(std::make_shared<tf::Executor>(threads));
+    solver.settings.max_iterations = 20;
+    solver.settings.residual_tolerance = 0.0; //Always run the full budget, so all runs do the same work
+    const PhysicsWorld initial_world = world;
+    const std::vector<Contact> initial_contacts = contacts;
+
+    const int repetitions = 20;
+    double total = 0.0;
+    for (int j = 0; j < repetitions; ++j) {
+        world = initial_world;
+        contacts = initial_contacts;
+        auto start = std::chrono::steady_clock::now();
+        stats = solver.solve(world, contacts, 1.0 / 60.0);
+        total += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    return total / repetitions;
+}
+
+/**
+ * Measure the graph colored contact solve on 1000 stacked boxes, serially and with 1 to N threads.
+ */
+int main() {
+    ContactSolverStats stats{};
+    const double serial = measureSolve(0, stats);
+    std::printf("1000 box stacks: %u colors, %u iterations\n", stats.colors, stats.iterations);
+    std::printf("serial %.3f ms\n", serial);
+    const uint32_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+    const double one_thread = measureSolve(1, stats);
+    std::printf("1 thread %.3f ms\n", one_thread);
+    std::vector<uint32_t> thread_counts = {2, 4, hardware_threads};
+    std::sort(thread_counts.begin(), thread_counts.end());
+    thread_counts.erase(std::unique(thread_counts.begin(), thread_counts.end()), thread_counts.end());
+    for (uint32_t threads : thread_counts) {
+        if(threads <= 1) continue;
+        const double time = measureSolve(threads, stats);
+        std::printf("%u threads %.3f ms, speedup over 1 thread %.2fx\n", threads, time, one_thread / time);
+    }
+    //More threads than cores only adds scheduling overhead
+    if(hardware_threads < 2) std::printf("only one hardware thread, so the multi-thread runs measure overhead, not speedup\n");
+    return 0;
+}
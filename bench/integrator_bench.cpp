@@ -0,0 +1,77 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include "src/Physics/World/PhysicsWorld.h"
+#include "src/Physics/World/BatchIntegrator.h"
+
+using namespace EngiGraph;
+
+/**
+ * Integrate a pose and rebuild its transform one body at a time with Eigen quaternions, the way the solvers used to.
+ */
+static void integrateReference(PhysicsWorld& world, double delta_time) {
+    for (uint32_t j = 0; j < world.getBodyCount(); ++j) {
+        Eigen::Quaterniond rotation = world.getRotation(j);
+        Eigen::Vector3d half_angular = 0.5 * delta_time * world.getAngularVelocity(j);
+        Eigen::Quaterniond change = Eigen::Quaterniond(0, half_angular.x(), half_angular.y(), half_angular.z()) * rotation;
+        rotation.coeffs() += change.coeffs();
+        rotation.normalize();
+        world.setRotation(j, rotation);
+        world.setPosition(j, world.getPosition(j) + world.getVelocity(j) * delta_time);
+        Eigen::Transform<double,3,Eigen::Affine> transform = Eigen::Transform<double,3,Eigen::Affine>::Identity();
+        transform.translate(world.getPosition(j)).rotate(rotation);
+        world.current_transforms[j] = transform.matrix();
+    }
+}
+
+static void integrateBatch(PhysicsWorld& world, double delta_time) {
+    integratePoses(world.states, delta_time, nullptr, 0, world.getBodyCount());
+    writePoseTransforms(world.states, 0.0, world.current_transforms.data(), 0, world.getBodyCount());
+}
+
+/**
+ * Time an integrator and get the bodies integrated per second.
+ */
+template<typename F> static double measureBodiesPerSecond(PhysicsWorld& world, F&& integrate) {
+    const double delta_time = 1.0 / 60.0;
+    integrate(world, delta_time); //Warm up caches
+    uint64_t steps = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    while (elapsed < 0.5) {
+        integrate(world, delta_time);
+        steps++;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+    return (double)steps * world.getBodyCount() / elapsed;
+}
+
+/**
+ * Measure pose integration throughput at several world sizes.
+ * @details Compares the batch integrator against per-body Eigen quaternion math.
+ */
+int main() {
+    std::printf("Batch integrator vectorized: %s\n", isBatchIntegratorVectorized() ? "yes" : "no");
+    std::printf("%10s %20s %20s %10s\n", "bodies", "reference bodies/s", "batch bodies/s", "speedup");
+    std::mt19937 random(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (uint32_t body_count : {1000u, 10000u, 100000u}) {
+        PhysicsWorld world;
+        world.reserve(body_count);
+        for (uint32_t i = 0; i < body_count; ++i) {
+            BodyDescription description{};
+            description.position = {distribution(random), distribution(random), distribution(random)};
+            description.velocity = {distribution(random), distribution(random), distribution(random)};
+            description.angular_velocity = {distribution(random), distribution(random), distribution(random)};
+            world.createBody(description);
+        }
+        const double reference = measureBodiesPerSecond(world, integrateReference);
+        const double batch = measureBodiesPerSecond(world, integrateBatch);
+        std::printf("%10u %20.0f %20.0f %9.2fx\n", body_count, reference, batch, batch / reference);
+    }
+    return 0;
+}
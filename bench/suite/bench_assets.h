@@ -0,0 +1,33 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <memory>
+#include "src/FileIO/ObjLoader.h"
+#include "src/Geometry/MeshConversions.h"
+#include "src/Geometry/MeshUtilities.h"
+
+/**
+ * Collider shapes used across benchmarks.
+ */
+enum class BenchShape {
+    CUBE,
+    SPHERE,
+    TORUS
+};
+
+/**
+ * Get a collider of about unit size. Run from the working directory, the sphere is loaded from meshes/unit_sphere.obj.
+ */
+inline std::shared_ptr<EngiGraph::Mesh> loadBenchShape(BenchShape shape) {
+    switch (shape) {
+        case BenchShape::CUBE:
+            return std::make_shared<EngiGraph::Mesh>(EngiGraph::makeBoxMesh({1, 1, 1}));
+        case BenchShape::SPHERE:
+            return std::make_shared<EngiGraph::Mesh>(EngiGraph::stripVisualMesh(EngiGraph::loadOBJ("meshes/unit_sphere.obj")[0]));
+        default:
+            return std::make_shared<EngiGraph::Mesh>(EngiGraph::makeTorusMesh(0.4f, 0.15f));
+    }
+}
@@ -0,0 +1,210 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include <benchmark/benchmark.h>
+#include "bench_assets.h"
+#include "src/Physics/Collisions/BodyCollision.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Physics/Collisions/LinearPointCcd.h"
+#include "src/Physics/Queries/SceneQuery.h"
+
+using namespace EngiGraph;
+
+static void BM_RayTriangleIntersection(benchmark::State& state) {
+    const Eigen::Vector3d a{0,-1,-1}, b{0,-1,1}, c{0,1,0};
+    const Eigen::Vector3d origin{1, 0.1, 0.2};
+    const Eigen::Vector3d direction = Eigen::Vector3d{-1, 0.05, -0.1}.normalized();
+    const auto k = calculateRayDimensions(direction);
+    const auto s = calculateRayShearConstraints(k, direction);
+    Eigen::Vector4d hit_info;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rayTriangleIntersection(a, b, c, origin, hit_info, k, s));
+        benchmark::DoNotOptimize(hit_info);
+    }
+}
+BENCHMARK(BM_RayTriangleIntersection);
+
+static void BM_RayQuadPatchIntersection(benchmark::State& state) {
+    //Non-planar patch, the general case
+    const Eigen::Vector3d q00{0,-1,-1}, q01{0.2,-1,1}, q10{-0.1,1,-1}, q11{0.3,1,1};
+    const Eigen::Vector3d origin{1, 0.1, 0.2};
+    const Eigen::Vector3d direction = Eigen::Vector3d{-1, 0.05, -0.1}.normalized();
+    Eigen::Vector3d hit_info;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rayQuadPatchIntersection(q00, q01, q10, q11, origin, direction, hit_info, 100.0));
+        benchmark::DoNotOptimize(hit_info);
+    }
+}
+BENCHMARK(BM_RayQuadPatchIntersection);
+
+/**
+ * CCD of a shape moving into a resting copy of itself.
+ */
+static void BM_LinearCCD(benchmark::State& state, BenchShape shape) {
+    auto mesh = loadBenchShape(shape);
+    Eigen::Matrix4d resting = Eigen::Matrix4d::Identity();
+    Eigen::Transform<double,3,Eigen::Affine> start = Eigen::Transform<double,3,Eigen::Affine>::Identity();
+    start.translate(Eigen::Vector3d{0, 1.5, 0}).rotate(Eigen::AngleAxisd(0.3, Eigen::Vector3d{1, 0, 1}.normalized()));
+    Eigen::Transform<double,3,Eigen::Affine> end = Eigen::Transform<double,3,Eigen::Affine>::Identity();
+    end.translate(Eigen::Vector3d{0.05, 0.5, 0}).rotate(Eigen::AngleAxisd(0.4, Eigen::Vector3d{1, 0, 1}.normalized()));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(linearCCD(*mesh, *mesh, start.matrix(), resting, end.matrix(), resting));
+    }
+    state.counters["vertices"] = (double)mesh->vertices.size();
+}
+BENCHMARK_CAPTURE(BM_LinearCCD, cube, BenchShape::CUBE);
+BENCHMARK_CAPTURE(BM_LinearCCD, sphere, BenchShape::SPHERE);
+BENCHMARK_CAPTURE(BM_LinearCCD, torus, BenchShape::TORUS);
+
+/**
+ * A box falling onto one child of a square grid of tori, as one compound collider against the same tori merged into a single mesh.
+ */
+static void BM_CompoundCCD(benchmark::State& state) {
+    const auto side = (int)state.range(0);
+    const bool compound = state.range(1) != 0;
+    auto& registry = ColliderRegistry::getShared();
+    std::vector<CompoundChild> children;
+    for (int x = 0; x < side; ++x) {
+        for (int z = 0; z < side; ++z) {
+            Eigen::Affine3d local = Eigen::Affine3d::Identity();
+            local.translate(Eigen::Vector3d{3.0 * x, 0, 3.0 * z});
+            children.push_back({registry.getTorus(1.0f, 0.3f), local.matrix()});
+        }
+    }
+    BodyDescription description{};
+    auto grid = std::make_shared<const CompoundCollider>(children);
+    if(compound) description.compound = grid;
+    else description.collider = grid->getMergedMesh();
+    PhysicsWorld world;
+    world.createBody(description);
+    description = BodyDescription{};
+    description.collider = registry.getBox();
+    description.position = {1.0, 0.8, 0};
+    description.velocity = {0, -50, 0};
+    world.createBody(description);
+    world.updateCurrentTransforms();
+    world.updateFutureTransforms(0.01);
+    CollisionBounds bounds;
+    bounds.update(world);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(collideBodies(world, bounds, 0, 1));
+    }
+    state.counters["children"] = (double)children.size();
+    state.SetLabel(compound ? "compound" : "merged");
+}
+BENCHMARK(BM_CompoundCCD)->ArgsProduct({{2, 4, 8}, {0, 1}})->Unit(benchmark::kMicrosecond);
+
+/**
+ * A box falling onto rolling terrain, as a height field against the same grid triangulated into a mesh.
+ */
+static void BM_HeightFieldCCD(benchmark::State& state) {
+    const auto side = (uint32_t)state.range(0);
+    const bool height_field = state.range(1) != 0;
+    std::vector<float> heights(side * side);
+    for (uint32_t row = 0; row < side; ++row) {
+        for (uint32_t column = 0; column < side; ++column) {
+            heights[row * side + column] = (float)(std::sin(column * 0.4) * std::cos(row * 0.3));
+        }
+    }
+    auto field = std::make_shared<const HeightField>(side, side, heights);
+    BodyDescription description{};
+    description.type = BodyType::STATIC;
+    if(height_field) description.height_field = field;
+    else description.collider = std::make_shared<const Mesh>(field->triangulate());
+    PhysicsWorld world;
+    world.createBody(description);
+    description = BodyDescription{};
+    description.collider = ColliderRegistry::getShared().getBox();
+    description.position = {0.3, 1.6, -0.4};
+    description.velocity = {0, -100, 0};
+    world.createBody(description);
+    world.updateCurrentTransforms();
+    world.updateFutureTransforms(0.01);
+    CollisionBounds bounds;
+    bounds.update(world);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(collideBodies(world, bounds, 0, 1));
+    }
+    state.counters["cells"] = (double)((side - 1) * (side - 1));
+    state.counters["collider_bytes"] = height_field ? (double)field->getMemoryUsage()
+            : (double)(world.colliders[0]->vertices.size() * sizeof(Eigen::Vector3f) + (world.colliders[0]->triangle_indices.size() + world.colliders[0]->edge_indices.size()) * sizeof(uint32_t));
+    state.SetLabel(height_field ? "height field" : "mesh");
+}
+BENCHMARK(BM_HeightFieldCCD)->ArgsProduct({{16, 64}, {0, 1}})->Unit(benchmark::kMicrosecond);
+
+/**
+ * A box falling into a static torus of growing detail, tested against its signed distance field and against its triangles.
+ */
+static void BM_SignedDistanceFieldCCD(benchmark::State& state) {
+    const auto rings = (uint32_t)state.range(0);
+    const bool distance_field = state.range(1) != 0;
+    auto& registry = ColliderRegistry::getShared();
+    auto torus = registry.getTorus(1.0f, 0.3f, rings, rings / 2);
+    BodyDescription description{};
+    description.type = BodyType::STATIC;
+    description.collider = torus;
+    if(distance_field) description.signed_distance_field = registry.getSignedDistanceField(torus, 0.025);
+    PhysicsWorld world;
+    world.createBody(description);
+    description = BodyDescription{};
+    description.collider = registry.getBox();
+    description.scale = {0.4, 0.4, 0.4};
+    description.position = {1.0, 1.0, 0.0};
+    description.velocity = {0, -100, 0};
+    world.createBody(description);
+    world.updateCurrentTransforms();
+    world.updateFutureTransforms(0.01);
+    CollisionBounds bounds;
+    bounds.update(world);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(collideBodies(world, bounds, 0, 1));
+    }
+    state.counters["triangles"] = (double)(torus->triangle_indices.size() / 3);
+    if(distance_field) state.counters["field_bytes"] = (double)world.signed_distance_fields[0]->getMemoryUsage();
+    state.SetLabel(distance_field ? "distance field" : "mesh");
+}
+BENCHMARK(BM_SignedDistanceFieldCCD)->ArgsProduct({{16, 64, 256}, {0, 1}})->Unit(benchmark::kMicrosecond);
+
+/**
+ * Baking the signed distance field of a detailed torus.
+ */
+static void BM_SignedDistanceFieldBake(benchmark::State& state) {
+    auto torus = ColliderRegistry::getShared().getTorus(1.0f, 0.3f, 128, 64);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(SignedDistanceField::bake(*torus, 0.025, 3, state.range(0) != 0));
+    }
+    state.SetLabel(state.range(0) ? "parallel" : "serial");
+}
+BENCHMARK(BM_SignedDistanceFieldBake)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+/**
+ * A batch of 1024 rays cast down onto a square grid of tori, closest hit each.
+ */
+static void BM_RaycastBatch(benchmark::State& state) {
+    const auto side = (int)state.range(0);
+    PhysicsWorld world;
+    BodyDescription description{};
+    description.collider = ColliderRegistry::getShared().getTorus(1.0f, 0.3f);
+    description.type = BodyType::STATIC;
+    for (int x = 0; x < side; ++x) {
+        for (int z = 0; z < side; ++z) {
+            description.position = {3.0 * x, 0, 3.0 * z};
+            world.createBody(description);
+        }
+    }
+    SceneQuery query;
+    query.parallel = state.range(1) != 0;
+    query.update(world);
+    std::vector<RayQuery> rays(1024);
+    for (size_t i = 0; i < rays.size(); ++i) {
+        rays[i].origin = {3.0 * side * (double)(i % 32) / 32.0, 5, 3.0 * side * (double)(i / 32) / 32.0};
+        rays[i].direction = {0.01, -1, 0.02};
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(query.raycast(rays));
+    }
+    state.SetItemsProcessed((int64_t)(state.iterations() * rays.size()));
+    state.counters["bodies"] = (double)world.getBodyCount();
+}
+BENCHMARK(BM_RaycastBatch)->ArgsProduct({{4, 16}, {0, 1}})->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,55 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include <benchmark/benchmark.h>
+#include "bench_assets.h"
+#include "src/Physics/VBD/RigidBody.h"
+#include "src/Geometry/MassProperties.h"
+
+using namespace EngiGraph;
+
+/**
+ * Reduce a triangle soup, the way OBJ meshes arrive, with about state.range(0) unique vertices.
+ */
+static void BM_ReduceMesh(benchmark::State& state) {
+    const uint32_t sides = 8;
+    const uint32_t rings = std::max<uint32_t>(3, (uint32_t)state.range(0) / sides);
+    Mesh torus = makeTorusMesh(1.0f, 0.3f, rings, sides);
+    Mesh soup{};
+    for (uint32_t index : torus.triangle_indices) {
+        soup.triangle_indices.push_back((uint32_t)soup.vertices.size());
+        soup.vertices.push_back(torus.vertices[index]);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reduceMesh(soup));
+    }
+    state.SetComplexityN((int64_t)torus.vertices.size());
+}
+BENCHMARK(BM_ReduceMesh)->RangeMultiplier(4)->Range(64, 4096)->Complexity();
+
+static void BM_RigidBodyConstruction(benchmark::State& state, BenchShape shape) {
+    auto mesh = loadBenchShape(shape);
+    for (auto _ : state) {
+        RigidBody body(mesh, 1.0, 0.01);
+        benchmark::DoNotOptimize(body.inertia_tensor);
+    }
+}
+BENCHMARK_CAPTURE(BM_RigidBodyConstruction, cube, BenchShape::CUBE);
+BENCHMARK_CAPTURE(BM_RigidBodyConstruction, sphere, BenchShape::SPHERE);
+BENCHMARK_CAPTURE(BM_RigidBodyConstruction, torus, BenchShape::TORUS);
+
+/**
+ * Single pass mass properties of a torus with about state.range(0) triangles. Meshes past one chunk are summed in parallel.
+ */
+static void BM_MassProperties(benchmark::State& state, MassModel model) {
+    const uint32_t sides = 32;
+    const uint32_t rings = std::max<uint32_t>(3, (uint32_t)state.range(0) / (2 * sides));
+    Mesh torus = makeTorusMesh(1.0f, 0.3f, rings, sides);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(computeMassProperties(torus, model));
+    }
+    state.SetComplexityN((int64_t)torus.triangle_indices.size() / 3);
+}
+BENCHMARK_CAPTURE(BM_MassProperties, solid, MassModel::SOLID)->RangeMultiplier(8)->Range(1024, 1 << 19)->Complexity();
+BENCHMARK_CAPTURE(BM_MassProperties, shell, MassModel::SHELL)->RangeMultiplier(8)->Range(1024, 1 << 19)->Complexity();
@@ -0,0 +1,83 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include <benchmark/benchmark.h>
+#include "src/FileIO/ImageIo.h"
+#include "src/FileIO/ObjLoader.h"
+#include "src/FileIO/TrajectoryFile.h"
+#include "src/Scenes/SceneGenerator.h"
+#include <cstdio>
+
+using namespace EngiGraph;
+
+static void BM_LoadOBJ(benchmark::State& state, const char* filename) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(loadOBJ(filename));
+    }
+}
+BENCHMARK_CAPTURE(BM_LoadOBJ, unit_sphere, "meshes/unit_sphere.obj");
+BENCHMARK_CAPTURE(BM_LoadOBJ, utah_teapot, "meshes/utah_teapot.obj")->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadOBJ, mori_knob, "meshes/mori_knob.obj")->Unit(benchmark::kMillisecond);
+
+static void BM_LoadImage(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(loadImage("textures/test_orange.png"));
+    }
+}
+BENCHMARK(BM_LoadImage)->Unit(benchmark::kMillisecond);
+
+/**
+ * A settled pile, where most bodies barely move between steps, and a step of drift applied to it.
+ */
+static PhysicsWorld makeTrajectoryWorld(uint32_t body_count) {
+    PhysicsWorld world;
+    buildScene(generateStressScene(StressScene::RANDOM_PILE, body_count), world);
+    return world;
+}
+
+static void driftBodies(PhysicsWorld& world) {
+    for (uint32_t i = 0; i < world.getBodyCount(); i += 8) {
+        world.setPosition(i, world.getPosition(i) + Eigen::Vector3d(0.001, -0.002, 0.0));
+    }
+}
+
+static void BM_TrajectoryAppend(benchmark::State& state) {
+    PhysicsWorld world = makeTrajectoryWorld((uint32_t)state.range(0));
+    const bool compress = state.range(1) != 0;
+    uint64_t bytes = 0, steps = 0;
+    for (auto _ : state) {
+        TrajectoryWriter writer("bench_trajectory.egtrj", 0.01, {64, 1e-4, compress});
+        for (int step = 0; step < 256; ++step) {
+            driftBodies(world);
+            writer.append(world);
+        }
+        writer.close();
+        bytes += writer.getBytesWritten();
+        steps += writer.getStepCount();
+    }
+    std::remove("bench_trajectory.egtrj");
+    state.counters["bytes_per_body_step"] = (double)bytes / (double)(steps * world.getBodyCount());
+    state.SetItemsProcessed((int64_t)steps);
+}
+BENCHMARK(BM_TrajectoryAppend)->ArgsProduct({{100, 1000, 10000}, {0, 1}})->Unit(benchmark::kMillisecond);
+
+static void BM_TrajectorySeek(benchmark::State& state) {
+    PhysicsWorld world = makeTrajectoryWorld((uint32_t)state.range(0));
+    {
+        TrajectoryWriter writer("bench_trajectory_seek.egtrj", 0.01);
+        for (int step = 0; step < 1024; ++step) {
+            driftBodies(world);
+            writer.append(world);
+        }
+    }
+    TrajectoryReader reader("bench_trajectory_seek.egtrj");
+    uint64_t step = 0;
+    for (auto _ : state) {
+        //Jump around the file, so every read is in a new chunk
+        step = (step + 389) % reader.getStepCount();
+        benchmark::DoNotOptimize(reader.readStep(step));
+    }
+    std::remove("bench_trajectory_seek.egtrj");
+}
+BENCHMARK(BM_TrajectorySeek)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
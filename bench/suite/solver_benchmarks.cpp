@@ -0,0 +1,202 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include <benchmark/benchmark.h>
+#include "src/Physics/TOISolver/ToiSolver.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Physics/World/WorldSnapshot.h"
+#include "src/Scenes/SceneDescription.h"
+#include "src/Scenes/SceneGenerator.h"
+
+using namespace EngiGraph;
+
+/**
+ * Steps of a scene. The scene keeps evolving across iterations, like a real run.
+ */
+template<typename Solver> static void stepScene(benchmark::State& state, Solver& solver, StressScene type = StressScene::RANDOM_PILE) {
+    solver.sleep_settings.enabled = false;
+    auto scene = generateStressScene(type, (uint32_t)state.range(0));
+    solver.gravity = scene.gravity;
+    buildScene(scene, solver.world);
+    for (auto _ : state) {
+        solver.step(scene.delta_time);
+    }
+    state.counters["bodies"] = solver.world.getBodyCount();
+    state.SetLabel(getStressSceneName(type));
+    state.SetComplexityN(state.range(0));
+}
+
+static void BM_VBDSolverStep(benchmark::State& state) {
+    VBDSolver solver;
+    stepScene(state, solver);
+}
+BENCHMARK(BM_VBDSolverStep)->RangeMultiplier(2)->Range(8, 64)->Unit(benchmark::kMillisecond)->Complexity();
+
+static void BM_TOISolverStep(benchmark::State& state) {
+    TOISolver solver;
+    stepScene(state, solver);
+}
+BENCHMARK(BM_TOISolverStep)->RangeMultiplier(2)->Range(8, 64)->Unit(benchmark::kMillisecond)->Complexity();
+
+static void BM_TOISolverSpeculativeStep(benchmark::State& state) {
+    TOISolver solver;
+    solver.integration_mode = TOISolver::IntegrationMode::SPECULATIVE;
+    stepScene(state, solver);
+}
+BENCHMARK(BM_TOISolverSpeculativeStep)->RangeMultiplier(2)->Range(8, 64)->Unit(benchmark::kMillisecond)->Complexity();
+
+static void BM_StressSceneStep(benchmark::State& state) {
+    TOISolver solver;
+    solver.integration_mode = TOISolver::IntegrationMode::SPECULATIVE;
+    stepScene(state, solver, (StressScene)state.range(1));
+}
+BENCHMARK(BM_StressSceneStep)->ArgsProduct({{10, 20, 40}, {(int)StressScene::BOX_STACKS, (int)StressScene::RANDOM_PILE, (int)StressScene::DOMINOES,
+                                             (int)StressScene::TORUS_CHAINS, (int)StressScene::PROJECTILES}})->Unit(benchmark::kMillisecond);
+
+/**
+ * Generating and building a scene, so large scenes stay cheap to set up.
+ */
+static void BM_GenerateStressScene(benchmark::State& state) {
+    for (auto _ : state) {
+        PhysicsWorld world;
+        auto scene = generateStressScene(StressScene::RANDOM_PILE, (uint32_t)state.range(0));
+        benchmark::DoNotOptimize(buildScene(scene, world));
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_GenerateStressScene)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMillisecond)->Complexity();
+
+/**
+ * Snapshot of a resting pile each step, where only the moving arrays are copied, against copying the whole world.
+ */
+static void BM_WorldSnapshotCapture(benchmark::State& state) {
+    PhysicsWorld world;
+    buildScene(generateStressScene(StressScene::RANDOM_PILE, (uint32_t)state.range(0)), world);
+    WorldSnapshot previous = WorldSnapshot::capture(world);
+    for (auto _ : state) {
+        world.setPosition(0, world.getPosition(0) + Eigen::Vector3d{0, 1e-3, 0});
+        previous = WorldSnapshot::capture(world, &previous);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_WorldSnapshotCapture)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMicrosecond)->Complexity();
+
+static void BM_WorldCopy(benchmark::State& state) {
+    PhysicsWorld world;
+    buildScene(generateStressScene(StressScene::RANDOM_PILE, (uint32_t)state.range(0)), world);
+    for (auto _ : state) {
+        world.setPosition(0, world.getPosition(0) + Eigen::Vector3d{0, 1e-3, 0});
+        PhysicsWorld copy = world;
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_WorldCopy)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMicrosecond)->Complexity();
+
+static void BM_WorldSnapshotRestore(benchmark::State& state) {
+    PhysicsWorld world;
+    buildScene(generateStressScene(StressScene::RANDOM_PILE, (uint32_t)state.range(0)), world);
+    WorldSnapshot snapshot = WorldSnapshot::capture(world);
+    for (auto _ : state) {
+        snapshot.restore(world);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_WorldSnapshotRestore)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMicrosecond)->Complexity();
+
+/**
+ * Adding boxes, which all share one collider from the registry.
+ */
+static void BM_VBDAddBoxes(benchmark::State& state) {
+    for (auto _ : state) {
+        VBDSolver solver;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            solver.addBox(1.0, {1.0, 0.5 + 0.001 * (double)i, 1.0}, {2.0 * (double)i, 0, 0});
+        }
+        benchmark::DoNotOptimize(solver.world.getBodyCount());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_VBDAddBoxes)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond)->Complexity();
+
+/**
+ * A few boxes falling onto a floor of many static tiles. Static bounds are baked once, and tiles away from the boxes are culled.
+ */
+static void BM_StaticGeometryStep(benchmark::State& state) {
+    VBDSolver solver;
+    solver.sleep_settings.enabled = false;
+    solver.gravity = {0, -9.8, 0};
+    const int64_t side = state.range(0);
+    BodyDescription tile{};
+    tile.collider = ColliderRegistry::getShared().getBox();
+    tile.type = BodyType::STATIC;
+    for (int64_t x = 0; x < side; ++x) {
+        for (int64_t z = 0; z < side; ++z) {
+            tile.position = {(double)x, 0, (double)z};
+            solver.world.createBody(tile);
+        }
+    }
+    BodyDescription box{};
+    box.collider = tile.collider;
+    box.scale = {0.5, 0.5, 0.5};
+    for (int i = 0; i < 8; ++i) {
+        box.position = {0.5 + i * (double)side / 8.0, 1.5, 0.5 * (double)side};
+        solver.world.createBody(box);
+    }
+    for (auto _ : state) {
+        solver.step(0.01);
+    }
+    state.counters["bodies"] = solver.world.getBodyCount();
+    state.counters["pairs_tested"] = (double)solver.profile.pairs_tested;
+    state.SetComplexityN(side * side);
+}
+BENCHMARK(BM_StaticGeometryStep)->RangeMultiplier(2)->Range(8, 32)->Unit(benchmark::kMillisecond)->Complexity();
+
+/**
+ * A debris pile falling onto a floor, with and without a layer mask that stops debris from hitting debris.
+ * Each iteration is the first 100 steps of the fall, while the debris is still crossing. pairs_tested counts the CCD calls per step,
+ * and debris_pairs the ones of those between two pieces of debris, which the mask removes. The rest are debris against the floor.
+ */
+static void BM_FilteredDebrisStep(benchmark::State& state) {
+    auto scene = generateStressScene(StressScene::RANDOM_PILE, (uint32_t)state.range(0));
+    if(state.range(1) != 0){
+        constexpr uint32_t debris_layer = 1u << 1;
+        for (auto& body : scene.bodies) {
+            if(body.description.type != BodyType::DYNAMIC) continue;
+            body.description.collision_layer = debris_layer;
+            body.description.collision_mask = ~debris_layer;
+        }
+    }
+    constexpr int steps = 100;
+    uint64_t pairs_tested = 0;
+    uint64_t debris_pairs = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        VBDSolver solver;
+        solver.gravity = scene.gravity;
+        buildScene(scene, solver.world);
+        state.ResumeTiming();
+        for (int j = 0; j < steps; ++j) {
+            //Debris pairs are counted from the bounds of the coming step, without the gravity the step adds
+            state.PauseTiming();
+            auto& world = solver.world;
+            world.updateCurrentTransforms();
+            world.updateFutureTransforms(scene.delta_time);
+            solver.bounds.update(world);
+            for (uint32_t a = 0; a < world.getBodyCount(); ++a) {
+                for (uint32_t b = a + 1; b < world.getBodyCount(); ++b) {
+                    if(world.isDynamic(a) && world.isDynamic(b) && world.canPairCollide(a, b) && solver.bounds.overlaps(a, b)) debris_pairs++;
+                }
+            }
+            state.ResumeTiming();
+            solver.step(scene.delta_time);
+            pairs_tested += solver.profile.pairs_tested;
+        }
+    }
+    state.counters["pairs_tested"] = benchmark::Counter((double)pairs_tested / steps, benchmark::Counter::kAvgIterations);
+    state.counters["debris_pairs"] = benchmark::Counter((double)debris_pairs / steps, benchmark::Counter::kAvgIterations);
+    state.SetLabel(state.range(1) != 0 ? "filtered" : "unfiltered");
+}
+BENCHMARK(BM_FilteredDebrisStep)->ArgsProduct({{20, 40}, {0, 1}})->Unit(benchmark::kMillisecond);
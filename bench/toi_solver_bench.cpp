@@ -0,0 +1,66 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include <chrono>
+#include <cstdio>
+#include "src/Physics/TOISolver/ToiSolver.h"
+#include "src/Geometry/MeshConversions.h"
+#include "src/FileIO/ObjLoader.h"
+
+using namespace EngiGraph;
+
+/**
+ * Load a box collider centered on the origin.
+ */
+static std::shared_ptr<const Mesh> loadBox(const Eigen::Vector3f& dimensions) {
+    auto raw_mesh_cube = loadOBJ("./test_files/cube.obj");
+    for (auto& vertex : raw_mesh_cube[0].vertices) {
+        vertex.position = (vertex.position - Eigen::Vector3f{0.5,0.5,0.5}).cwiseProduct(dimensions);
+    }
+    return std::make_shared<const Mesh>(stripVisualMesh(raw_mesh_cube[0]));
+}
+
+/**
+ * Drop a grid of boxes onto a static floor, and measure steps per second.
+ */
+static double measureStepsPerSecond(TOISolver::IntegrationMode mode) {
+    TOISolver solver;
+    solver.integration_mode = mode;
+    solver.sleep_settings.enabled = false;
+
+    BodyDescription description{};
+    description.collider = loadBox({20,1,20});
+    description.mass = 0.0;
+    description.gravity = false;
+    description.position = {0,-0.5,0};
+    solver.world.createBody(description);
+
+    description.collider = loadBox({1,1,1});
+    description.mass = 1.0;
+    description.gravity = true;
+    for (int x = 0; x < 5; ++x) {
+        for (int z = 0; z < 5; ++z) {
+            description.position = {x * 2.0 - 4.0, 0.6 + 0.1 * x, z * 2.0 - 4.0};
+            solver.world.createBody(description);
+        }
+    }
+
+    const int steps = 200;
+    auto start = std::chrono::steady_clock::now();
+    for (int j = 0; j < steps; ++j) {
+        solver.step(1.0 / 60.0);
+    }
+    return steps / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Measure the throughput of the speculative integration mode. Run from the working directory.
+ * @details Time of impact mode is only timed as a baseline. It does not record its hits yet, so it never resolves a contact
+ * or moves a body, and its figure is the cost of force integration and one CCD pass, not of a working solver.
+ */
+int main() {
+    std::printf("speculative:                           %.1f steps/s\n", measureStepsPerSecond(TOISolver::IntegrationMode::SPECULATIVE));
+    std::printf("baseline(time of impact, no contacts): %.1f steps/s\n", measureStepsPerSecond(TOISolver::IntegrationMode::TIME_OF_IMPACT));
+    return 0;
+}
@@ -0,0 +1,361 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "src/Exceptions/RuntimeException.h"
+#include "src/FileIO/TrajectoryFile.h"
+#include "src/Physics/TOISolver/ToiSolver.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Profiling/Trace.h"
+#include "src/Scenes/SceneDescription.h"
+#include "src/Scenes/SceneGenerator.h"
+#include "src/Scenes/SimulationRecording.h"
+
+using namespace EngiGraph;
+
+/**
+ * Throughput of one run.
+ */
+struct RunResult {
+    uint32_t bodies = 0;
+    /**
+     * Worker threads of the solver, 0 for one per hardware thread.
+     */
+    uint32_t threads = 0;
+    double steps_per_second = 0.0;
+    StepProfile total{};
+    /**
+     * First replayed step whose state did not match the recording, or -1.
+     */
+    int64_t mismatch_step = -1;
+    /**
+     * PhysicsWorld::hashState() after the last step.
+     */
+    uint64_t state_hash = 0;
+};
+
+/**
+ * Step a solver as fast as possible and print where the time went.
+ * @param step Does one step, returns false to stop early.
+ */
+template<typename Solver, typename StepFunction> static RunResult runSteps(Solver& solver, uint64_t step_count, StepFunction&& step) {
+    RunResult result{};
+    result.bodies = solver.world.getBodyCount();
+    StepProfile& total = result.total;
+    uint64_t steps_done = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (; steps_done < step_count; ++steps_done) {
+        if(!step()) break;
+        total.accumulate(solver.profile);
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.steps_per_second = steps_done / elapsed;
+
+    std::printf("Wall time: %.3f s, %.1f steps/s\n", elapsed, result.steps_per_second);
+    std::printf("%-22s %12s %12s %8s\n", "phase", "total ms", "ms/step", "share");
+    const double steps = (double)std::max<uint64_t>(steps_done, 1);
+    for (int phase = 0; phase < StepProfile::PHASE_COUNT; ++phase) {
+        const double seconds = total.phase_seconds[phase];
+        std::printf("%-22s %12.3f %12.4f %7.1f%%\n", StepProfile::getPhaseName((StepProfile::Phase)phase), seconds * 1000.0,
+                    seconds * 1000.0 / steps, total.total_seconds > 0.0 ? 100.0 * seconds / total.total_seconds : 0.0);
+    }
+    std::printf("%-22s %12.3f %12.4f\n", "Step total", total.total_seconds * 1000.0, total.total_seconds * 1000.0 / steps);
+    std::printf("Per step: %.1f pairs tested, %.1f hits, %.1f contacts, %.2f TOI iterations, %.1f solver iterations\n",
+                total.pairs_tested / steps, total.hits / steps, total.contacts / steps, total.toi_iterations / steps, total.solver_iterations / steps);
+    result.state_hash = solver.world.hashState();
+    std::printf("State hash: %016llx\n", (unsigned long long)result.state_hash);
+    return result;
+}
+
+/**
+ * Where a run writes its output, each is skipped if null.
+ */
+struct RunOutputs {
+    SimulationRecorder* recorder = nullptr;
+    TrajectoryWriter* trajectory = nullptr;
+    /**
+     * PhysicsWorld::hashState() after every step.
+     */
+    std::vector<uint64_t>* state_hashes = nullptr;
+};
+
+/**
+ * Step a solver through a scene.
+ */
+template<typename Solver> static RunResult runScene(Solver& solver, const SceneDescription& scene, uint32_t threads, const RunOutputs& outputs) {
+    solver.gravity = scene.gravity;
+    if(threads > 0) solver.setThreadCount(threads);
+    buildScene(scene, solver.world);
+    std::printf("Bodies: %u, steps: %u, delta time: %g\n", solver.world.getBodyCount(), scene.steps, scene.delta_time);
+    if(outputs.recorder) outputs.recorder->start(solver);
+    return runSteps(solver, scene.steps, [&](){
+        if(outputs.recorder){
+            outputs.recorder->step(solver, scene.delta_time);
+        }else{
+            solver.step(scene.delta_time);
+        }
+        if(outputs.trajectory) outputs.trajectory->append(solver.world);
+        if(outputs.state_hashes) outputs.state_hashes->push_back(solver.world.hashState());
+        return true;
+    });
+}
+
+/**
+ * Run a scene with the solver it asks for.
+ * @param threads Worker threads, or 0 for one per hardware thread.
+ */
+static RunResult runScene(const SceneDescription& scene, uint32_t threads, const RunOutputs& outputs) {
+    RunResult result{};
+    if(scene.solver == SceneSolver::VBD){
+        std::printf("Solver: VBD\n");
+        VBDSolver solver;
+        result = runScene(solver, scene, threads, outputs);
+    }else{
+        std::printf("Solver: %s\n", scene.solver == SceneSolver::TOI ? "TOI" : "TOI speculative");
+        TOISolver solver;
+        if(scene.solver == SceneSolver::TOI_SPECULATIVE) solver.integration_mode = TOISolver::IntegrationMode::SPECULATIVE;
+        result = runScene(solver, scene, threads, outputs);
+    }
+    result.threads = threads;
+    return result;
+}
+
+/**
+ * Re-run a recording.
+ * @param verify Check the state hash after every step, and stop at the first mismatch.
+ */
+template<typename Solver> static RunResult replayRecording(Solver& solver, const SimulationRecording& recording, bool verify, uint32_t threads, TrajectoryWriter* trajectory) {
+    if(threads > 0) solver.setThreadCount(threads);
+    SimulationReplay replay(recording);
+    replay.start(solver);
+    std::printf("Bodies: %u, steps: %zu, edits: %zu%s\n", solver.world.getBodyCount(), recording.steps.size(), recording.edits.size(), verify ? ", verifying" : "");
+    int64_t mismatch_step = -1;
+    RunResult result = runSteps(solver, recording.steps.size(), [&](){
+        replay.step(solver);
+        if(trajectory) trajectory->append(solver.world);
+        if(verify && !replay.verify(solver.world)){
+            mismatch_step = (int64_t)replay.getStep() - 1;
+            return false;
+        }
+        return true;
+    });
+    result.mismatch_step = mismatch_step;
+    if(mismatch_step >= 0){
+        std::printf("Replay diverged from the recording at step %lld\n", (long long)mismatch_step);
+    }else if(verify){
+        std::printf("Replay matched the recording on all %zu steps\n", recording.steps.size());
+    }
+    return result;
+}
+
+static RunResult replayRecording(const SimulationRecording& recording, bool verify, uint32_t threads, TrajectoryWriter* trajectory) {
+    if(recording.solver == SceneSolver::VBD){
+        std::printf("Solver: VBD\n");
+        VBDSolver solver;
+        return replayRecording(solver, recording, verify, threads, trajectory);
+    }
+    std::printf("Solver: %s\n", recording.solver == SceneSolver::TOI ? "TOI" : "TOI speculative");
+    TOISolver solver;
+    return replayRecording(solver, recording, verify, threads, trajectory);
+}
+
+/**
+ * Find the first step where two runs of the same scene reached a different state.
+ * @return Step index, or -1 if every step matched.
+ */
+static int64_t findMismatch(const std::vector<uint64_t>& hashes_a, const std::vector<uint64_t>& hashes_b) {
+    const size_t steps = std::min(hashes_a.size(), hashes_b.size());
+    for (size_t step = 0; step < steps; ++step) {
+        if(hashes_a[step] != hashes_b[step]) return (int64_t)step;
+    }
+    return hashes_a.size() == hashes_b.size() ? -1 : (int64_t)steps;
+}
+
+static void printUsage() {
+    std::printf("Usage: EngiGraphSim <scene file> [options]\n"
+                "       EngiGraphSim --generate stacks|pile|dominoes|chains|projectiles [--bodies count[,count...]] [--seed seed] [options]\n"
+                "       EngiGraphSim --replay recording.egrec [--verify] [--threads count] [--trace trace.json] [--trajectory poses.egtrj]\n"
+                "Options: --steps count, --solver vbd|toi|speculative, --delta-time seconds, --trace trace.json, --save-scene file, --record recording.egrec,\n"
+                "         --trajectory poses.egtrj to write the pose of every body at every step, --threads count[,count...] solver threads\n"
+                "Several body counts run one after another and print a scaling table.\n"
+                "Several thread counts run the scene once each, and check that every step reached the same state hash as the first run.\n"
+                "A replay re-runs a recording bit for bit, --verify checks the state hash after every step.\n");
+}
+
+/**
+ * Stop tracing and write the trace, if tracing.
+ */
+static void finishTrace(const std::string& trace_file) {
+    if(trace_file.empty()) return;
+    setTracingEnabled(false);
+    writeChromeTrace(trace_file);
+    std::printf("Trace written to %s\n", trace_file.c_str());
+}
+
+/**
+ * Close a trajectory and report its size.
+ */
+static void finishTrajectory(TrajectoryWriter& trajectory, const std::string& trajectory_file) {
+    trajectory.close();
+    std::printf("Trajectory of %llu steps written to %s, %.1f bytes per step\n", (unsigned long long)trajectory.getStepCount(), trajectory_file.c_str(),
+                trajectory.getStepCount() > 0 ? (double)trajectory.getBytesWritten() / (double)trajectory.getStepCount() : 0.0);
+}
+
+/**
+ * Parse a comma separated list of counts.
+ */
+static std::vector<uint32_t> parseCounts(const std::string& text) {
+    std::vector<uint32_t> counts;
+    size_t begin = 0;
+    while (begin <= text.size()) {
+        size_t end = std::min(text.find(',', begin), text.size());
+        counts.push_back((uint32_t)std::stoul(text.substr(begin, end - begin)));
+        begin = end + 1;
+    }
+    return counts;
+}
+
+/**
+ * Run a scene without a window, for batch runs and profiling solvers in isolation.
+ */
+int main(int argc, char** argv) {
+    if(argc < 2){
+        printUsage();
+        return 1;
+    }
+    try {
+        std::string scene_file{}, generate{}, trace_file{}, save_file{}, solver_name{}, record_file{}, replay_file{}, trajectory_file{};
+        bool verify = false;
+        std::vector<uint32_t> body_counts{};
+        std::vector<uint32_t> thread_counts{};
+        uint32_t seed = 1;
+        int64_t steps = -1;
+        double delta_time = -1.0;
+        for (int i = 1; i < argc; ++i) {
+            const bool has_value = i + 1 < argc;
+            if(std::strcmp(argv[i], "--steps") == 0 && has_value){
+                steps = std::stoll(argv[++i]);
+            }else if(std::strcmp(argv[i], "--delta-time") == 0 && has_value){
+                delta_time = std::stod(argv[++i]);
+            }else if(std::strcmp(argv[i], "--trace") == 0 && has_value){
+                trace_file = argv[++i];
+            }else if(std::strcmp(argv[i], "--solver") == 0 && has_value){
+                solver_name = argv[++i];
+            }else if(std::strcmp(argv[i], "--generate") == 0 && has_value){
+                generate = argv[++i];
+            }else if(std::strcmp(argv[i], "--bodies") == 0 && has_value){
+                body_counts = parseCounts(argv[++i]);
+            }else if(std::strcmp(argv[i], "--threads") == 0 && has_value){
+                thread_counts = parseCounts(argv[++i]);
+            }else if(std::strcmp(argv[i], "--seed") == 0 && has_value){
+                seed = (uint32_t)std::stoul(argv[++i]);
+            }else if(std::strcmp(argv[i], "--save-scene") == 0 && has_value){
+                save_file = argv[++i];
+            }else if(std::strcmp(argv[i], "--record") == 0 && has_value){
+                record_file = argv[++i];
+            }else if(std::strcmp(argv[i], "--replay") == 0 && has_value){
+                replay_file = argv[++i];
+            }else if(std::strcmp(argv[i], "--trajectory") == 0 && has_value){
+                trajectory_file = argv[++i];
+            }else if(std::strcmp(argv[i], "--verify") == 0){
+                verify = true;
+            }else if(argv[i][0] != '-' && scene_file.empty()){
+                scene_file = argv[i];
+            }else{
+                printUsage();
+                return 1;
+            }
+        }
+        const int sources = !scene_file.empty() + !generate.empty() + !replay_file.empty();
+        const bool single_run = body_counts.size() <= 1 && thread_counts.size() <= 1;
+        if(sources != 1 || (verify && replay_file.empty()) || ((!record_file.empty() || !trajectory_file.empty()) && !single_run) ||
+           (!replay_file.empty() && thread_counts.size() > 1)){
+            printUsage();
+            return 1;
+        }
+        if(body_counts.empty()) body_counts.push_back(100);
+        if(thread_counts.empty()) thread_counts.push_back(0);
+
+        if(!trace_file.empty()){
+            setTraceThreadName("Main");
+            setTracingEnabled(true);
+        }
+
+        if(!replay_file.empty()){
+            const SimulationRecording recording = loadRecording(replay_file);
+            std::unique_ptr<TrajectoryWriter> trajectory;
+            if(!trajectory_file.empty()){
+                const double recorded_delta_time = recording.steps.empty() ? 0.0 : recording.steps[0].delta_time;
+                trajectory = std::make_unique<TrajectoryWriter>(trajectory_file, recorded_delta_time);
+            }
+            const RunResult result = replayRecording(recording, verify, thread_counts[0], trajectory.get());
+            if(trajectory) finishTrajectory(*trajectory, trajectory_file);
+            finishTrace(trace_file);
+            return result.mismatch_step >= 0 ? 2 : 0;
+        }
+
+        std::vector<RunResult> results;
+        bool threads_matched = true;
+        for (uint32_t body_count : body_counts) {
+            SceneDescription scene = generate.empty() ? loadScene(scene_file) : generateStressScene(parseStressSceneName(generate), body_count, seed);
+            if(steps >= 0) scene.steps = (uint32_t)steps;
+            if(delta_time > 0.0) scene.delta_time = delta_time;
+            //Reuse the scene parser so names match scene files
+            if(!solver_name.empty()) scene.solver = parseScene("solver " + solver_name).solver;
+            if(!save_file.empty()) saveScene(scene, save_file);
+            //Hashes of every step of the first thread count, to compare the others against
+            std::vector<uint64_t> first_hashes;
+            for (size_t run = 0; run < thread_counts.size(); ++run) {
+                if(thread_counts.size() > 1) std::printf("Threads: %u\n", thread_counts[run]);
+                SimulationRecorder recorder;
+                std::unique_ptr<TrajectoryWriter> trajectory;
+                if(!trajectory_file.empty()) trajectory = std::make_unique<TrajectoryWriter>(trajectory_file, scene.delta_time);
+                std::vector<uint64_t> hashes;
+                RunOutputs outputs{record_file.empty() ? nullptr : &recorder, trajectory.get(), thread_counts.size() > 1 ? &hashes : nullptr};
+                results.push_back(runScene(scene, thread_counts[run], outputs));
+                if(trajectory) finishTrajectory(*trajectory, trajectory_file);
+                if(!record_file.empty()){
+                    saveRecording(recorder.stop(), record_file);
+                    std::printf("Recording written to %s\n", record_file.c_str());
+                }
+                if(run == 0){
+                    first_hashes = std::move(hashes);
+                }else{
+                    const int64_t mismatch_step = findMismatch(first_hashes, hashes);
+                    if(mismatch_step >= 0){
+                        std::printf("%u threads diverged from %u threads at step %lld\n", thread_counts[run], thread_counts[0], (long long)mismatch_step);
+                        threads_matched = false;
+                    }else{
+                        std::printf("%u threads matched %u threads on all %zu steps\n", thread_counts[run], thread_counts[0], hashes.size());
+                    }
+                }
+                std::printf("\n");
+            }
+            //A scene file does not change with the body count
+            if(generate.empty()) break;
+        }
+
+        if(results.size() > 1){
+            std::printf("%10s %8s %12s %12s %12s\n", "bodies", "threads", "steps/s", "ms/step", "collision");
+            for (const auto& result : results) {
+                const double total = result.total.total_seconds;
+                const std::string threads = result.threads > 0 ? std::to_string(result.threads) : "auto";
+                std::printf("%10u %8s %12.1f %12.4f %11.1f%%\n", result.bodies, threads.c_str(), result.steps_per_second, 1000.0 / result.steps_per_second,
+                            total > 0.0 ? 100.0 * result.total.phase_seconds[StepProfile::PHASE_COLLISION] / total : 0.0);
+            }
+        }
+
+        finishTrace(trace_file);
+        if(!threads_matched) return 2;
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Error: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
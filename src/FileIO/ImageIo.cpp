@@ -5,6 +5,7 @@
 #include "ImageIo.h"
 #include "./src/Exceptions/RuntimeException.h"
 #include "FileUtils.h"
+#include "./src/Profiling/Trace.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include "STB/stb_image.h"
 #define STB_IMAGE_WRITE_IMPLEMENTATION
@@ -13,6 +14,7 @@
 namespace EngiGraph {
 
     Image<uint32_t> loadImage(const std::string &file) {
+        ENGIGRAPH_TRACE_SCOPE("loadImage");
         validateFileExistence(file);
         validateFileExtensions(file,{".jpg",".jpeg",".png", ".tga",".bmp"});
         int width, height, channel_count;
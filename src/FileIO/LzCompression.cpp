@@ -0,0 +1,126 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "LzCompression.h"
+#include <algorithm>
+#include <cstring>
+#include "src/Exceptions/RuntimeException.h"
+
+namespace EngiGraph {
+
+    namespace {
+
+        constexpr size_t MIN_MATCH = 4;
+        constexpr size_t MAX_OFFSET = 65535;
+        /**
+         * The last bytes are always literals, so the match search never reads past the end.
+         */
+        constexpr size_t END_LITERALS = 5;
+        constexpr uint32_t HASH_BITS = 14;
+        constexpr uint32_t NO_POSITION = 0xFFFFFFFF;
+
+        uint32_t read32(const uint8_t* bytes) {
+            uint32_t value;
+            std::memcpy(&value, bytes, sizeof(value));
+            return value;
+        }
+
+        /**
+         * Write the part of a length that did not fit in the token nibble.
+         */
+        void writeLengthExtension(std::vector<uint8_t>& output, size_t length) {
+            if(length < 15) return;
+            length -= 15;
+            for (; length >= 255; length -= 255) output.push_back(255);
+            output.push_back((uint8_t)length);
+        }
+
+        void writeSequence(std::vector<uint8_t>& output, const uint8_t* literals, size_t literal_length, size_t offset, size_t match_length) {
+            const size_t match_code = match_length - MIN_MATCH;
+            output.push_back((uint8_t)((std::min<size_t>(literal_length, 15) << 4) | std::min<size_t>(match_code, 15)));
+            writeLengthExtension(output, literal_length);
+            output.insert(output.end(), literals, literals + literal_length);
+            output.push_back((uint8_t)(offset & 0xFF));
+            output.push_back((uint8_t)(offset >> 8));
+            writeLengthExtension(output, match_code);
+        }
+
+        [[noreturn]] void throwCorrupt() {
+            throw RuntimeException("Compressed data is corrupt.");
+        }
+
+        size_t readLengthExtension(const uint8_t* input, size_t size, size_t& position) {
+            size_t length = 0;
+            uint8_t byte;
+            do {
+                if(position >= size) throwCorrupt();
+                byte = input[position++];
+                length += byte;
+            } while (byte == 255);
+            return length;
+        }
+
+    }
+
+    std::vector<uint8_t> compressLz(const uint8_t* input, size_t size) {
+        std::vector<uint8_t> output;
+        output.reserve(size + size / 255 + 16);
+        std::vector<uint32_t> table(1u << HASH_BITS, NO_POSITION);
+
+        size_t anchor = 0;
+        size_t position = 0;
+        const size_t match_end = size > END_LITERALS ? size - END_LITERALS : 0;
+        while (position + MIN_MATCH <= match_end) {
+            const uint32_t sequence = read32(input + position);
+            const uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_BITS);
+            const uint32_t candidate = table[hash];
+            table[hash] = (uint32_t)position;
+            if(candidate == NO_POSITION || position - candidate > MAX_OFFSET || read32(input + candidate) != sequence){
+                position++;
+                continue;
+            }
+            size_t length = MIN_MATCH;
+            while (position + length < match_end && input[candidate + length] == input[position + length]) length++;
+            writeSequence(output, input + anchor, position - anchor, position - candidate, length);
+            position += length;
+            anchor = position;
+        }
+
+        //Final literals, without a match
+        const size_t literal_length = size - anchor;
+        output.push_back((uint8_t)(std::min<size_t>(literal_length, 15) << 4));
+        writeLengthExtension(output, literal_length);
+        output.insert(output.end(), input + anchor, input + size);
+        return output;
+    }
+
+    void decompressLz(const uint8_t* input, size_t size, uint8_t* output, size_t output_size) {
+        size_t in = 0;
+        size_t out = 0;
+        while (true) {
+            if(in >= size) throwCorrupt();
+            const uint8_t token = input[in++];
+
+            size_t literal_length = token >> 4;
+            if(literal_length == 15) literal_length += readLengthExtension(input, size, in);
+            if(literal_length > size - in || literal_length > output_size - out) throwCorrupt();
+            std::memcpy(output + out, input + in, literal_length);
+            in += literal_length;
+            out += literal_length;
+            if(in == size) break;
+
+            if(size - in < 2) throwCorrupt();
+            const size_t offset = input[in] | (input[in + 1] << 8);
+            in += 2;
+            if(offset == 0 || offset > out) throwCorrupt();
+            size_t match_length = (token & 15) + MIN_MATCH;
+            if((token & 15) == 15) match_length += readLengthExtension(input, size, in);
+            if(match_length > output_size - out) throwCorrupt();
+            //Byte by byte, since a match may overlap the bytes it is producing
+            for (size_t i = 0; i < match_length; ++i, ++out) output[out] = output[out - offset];
+        }
+        if(out != output_size) throwCorrupt();
+    }
+
+} // EngiGraph
@@ -0,0 +1,34 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace EngiGraph {
+
+    /**
+     * Compress bytes with a fast LZ77 byte format.
+     * @details Each sequence is a run of literals followed by a copy of earlier output, using the LZ4 block layout:
+     * a token with both lengths, the literals, a 16 bit offset and length extension bytes. Matches are found with a single hash table,
+     * so this favours speed over ratio.
+     * @param input Bytes to compress.
+     * @param size Number of bytes.
+     * @return Compressed bytes. Can be slightly larger than the input if nothing repeats.
+     */
+    std::vector<uint8_t> compressLz(const uint8_t* input, size_t size);
+
+    /**
+     * Decompress bytes written by compressLz().
+     * @param input Compressed bytes.
+     * @param size Number of compressed bytes.
+     * @param output Buffer for the decompressed bytes.
+     * @param output_size Exact decompressed size.
+     * @throws RuntimeException Input is corrupt, or does not decompress to exactly output_size bytes.
+     */
+    void decompressLz(const uint8_t* input, size_t size, uint8_t* output, size_t output_size);
+
+} // EngiGraph
@@ -0,0 +1,77 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "MappedFile.h"
+#include "FileUtils.h"
+#include "src/Exceptions/RuntimeException.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace EngiGraph {
+
+#ifdef _WIN32
+
+    MappedFile::MappedFile(const std::string& filename) {
+        validateFileExistence(filename);
+        file_handle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(file_handle == INVALID_HANDLE_VALUE) throw RuntimeException("Could not open file: " + filename);
+        LARGE_INTEGER file_size;
+        GetFileSizeEx(file_handle, &file_size);
+        size = (size_t)file_size.QuadPart;
+        if(size == 0) return;
+        mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(mapping_handle) data = (const uint8_t*)MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+        if(!data){
+            if(mapping_handle) CloseHandle(mapping_handle);
+            CloseHandle(file_handle);
+            throw RuntimeException("Could not map file: " + filename);
+        }
+    }
+
+    MappedFile::~MappedFile() {
+        if(data) UnmapViewOfFile(data);
+        if(mapping_handle) CloseHandle(mapping_handle);
+        if(file_handle && file_handle != INVALID_HANDLE_VALUE) CloseHandle(file_handle);
+    }
+
+#else
+
+    MappedFile::MappedFile(const std::string& filename) {
+        validateFileExistence(filename);
+        const int file = open(filename.c_str(), O_RDONLY);
+        if(file < 0) throw RuntimeException("Could not open file: " + filename);
+        struct stat status{};
+        if(fstat(file, &status) != 0){
+            close(file);
+            throw RuntimeException("Could not read the size of file: " + filename);
+        }
+        size = (size_t)status.st_size;
+        if(size > 0){
+            void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+            if(mapping == MAP_FAILED){
+                close(file);
+                throw RuntimeException("Could not map file: " + filename);
+            }
+            data = (const uint8_t*)mapping;
+        }
+        //The mapping stays valid after the descriptor is closed
+        close(file);
+    }
+
+    MappedFile::~MappedFile() {
+        if(data) munmap((void*)data, size);
+    }
+
+#endif
+
+} // EngiGraph
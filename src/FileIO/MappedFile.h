@@ -0,0 +1,51 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace EngiGraph {
+
+    /**
+     * Read only memory mapping of a whole file.
+     * @details Pages are loaded by the OS on first access, so opening a huge file is instant and only the parts that are read use memory.
+     */
+    class MappedFile {
+    public:
+        /**
+         * Map a file.
+         * @param filename File to map.
+         * @throws RuntimeException File does not exist or could not be mapped.
+         */
+        explicit MappedFile(const std::string& filename);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * Get the contents. Empty files map to nullptr.
+         */
+        [[nodiscard]] const uint8_t* getData() const {
+            return data;
+        }
+
+        [[nodiscard]] size_t getSize() const {
+            return size;
+        }
+
+    private:
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        void* file_handle = nullptr;
+        void* mapping_handle = nullptr;
+#endif
+    };
+
+} // EngiGraph
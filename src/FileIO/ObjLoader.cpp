@@ -7,9 +7,11 @@
 #include "TinyOBJLoader/tiny_obj_loader.h"
 #include "FileUtils.h"
 #include "./src/Exceptions/RuntimeException.h"
+#include "./src/Profiling/Trace.h"
 namespace EngiGraph {
 
     std::vector<VisualMesh> loadOBJ(const std::string& filename){
+        ENGIGRAPH_TRACE_SCOPE("loadOBJ");
 
         validateFileExistence(filename);
         validateFileExtensions(filename,{".obj"});
@@ -0,0 +1,312 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "TrajectoryFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "LzCompression.h"
+#include "src/Exceptions/RuntimeException.h"
+#include "src/Profiling/Trace.h"
+
+namespace EngiGraph {
+
+    namespace {
+
+        constexpr char FILE_MAGIC[8] = {'E','G','T','R','J','0','0','1'};
+        constexpr char END_MAGIC[8] = {'E','G','T','R','J','E','N','D'};
+        constexpr char CHUNK_MAGIC[4] = {'C','H','N','K'};
+        constexpr uint32_t CHUNK_COMPRESSED = 1u << 0;
+
+        /**
+         * Quantized values per body per step: position xyz, then rotation xyzw.
+         */
+        constexpr uint32_t VALUES_PER_BODY = 7;
+        constexpr double ROTATION_SCALE = 32767.0;
+
+        struct FileHeader {
+            char magic[8];
+            double delta_time;
+            double position_precision;
+            uint32_t steps_per_chunk;
+            uint32_t reserved;
+        };
+
+        struct ChunkHeader {
+            char magic[4];
+            uint32_t step_count;
+            uint64_t first_step;
+            uint32_t body_count;
+            uint32_t raw_size;
+            uint32_t stored_size;
+            uint32_t flags;
+        };
+
+        struct FileFooter {
+            uint64_t chunk_count;
+            uint64_t index_offset;
+            char magic[8];
+        };
+
+        static_assert(sizeof(FileHeader) == 32 && sizeof(ChunkHeader) == 32 && sizeof(FileFooter) == 24 && sizeof(TrajectoryChunkEntry) == 16);
+
+        void writeVarint(std::vector<uint8_t>& output, int64_t value) {
+            //Zigzag, so small negative changes are small too
+            uint64_t bits = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+            while (bits >= 0x80) {
+                output.push_back((uint8_t)(bits | 0x80));
+                bits >>= 7;
+            }
+            output.push_back((uint8_t)bits);
+        }
+
+        [[noreturn]] void throwCorrupt() {
+            throw RuntimeException("Trajectory file is corrupt.");
+        }
+
+        int64_t readVarint(const uint8_t* data, size_t size, size_t& position) {
+            uint64_t bits = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                if(position >= size) throwCorrupt();
+                const uint8_t byte = data[position++];
+                bits |= (uint64_t)(byte & 0x7F) << shift;
+                if((byte & 0x80) == 0) return (int64_t)(bits >> 1) ^ -(int64_t)(bits & 1);
+            }
+            throwCorrupt();
+        }
+
+        template<typename T> T readStruct(const MappedFile& file, uint64_t offset) {
+            if(offset > file.getSize() || file.getSize() - offset < sizeof(T)) throwCorrupt();
+            T value;
+            std::memcpy(&value, file.getData() + offset, sizeof(T));
+            return value;
+        }
+
+    }
+
+    Eigen::Matrix4d TrajectoryFrame::getTransform(uint32_t index) const {
+        Eigen::Matrix4d transform = Eigen::Matrix4d::Identity();
+        transform.topLeftCorner<3,3>() = rotations[index].toRotationMatrix();
+        transform.topRightCorner<3,1>() = positions[index];
+        return transform;
+    }
+
+    TrajectoryWriter::TrajectoryWriter(const std::string& filename, double delta_time, TrajectorySettings settings) : file(filename, std::ios::binary | std::ios::trunc), settings(settings) {
+        if(!file) throw RuntimeException("Could not create trajectory file: " + filename);
+        if(settings.steps_per_chunk == 0 || !(settings.position_precision > 0.0)) throw RuntimeException("Trajectory needs at least 1 step per chunk and a positive precision.");
+        FileHeader header{};
+        std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+        header.delta_time = delta_time;
+        header.position_precision = settings.position_precision;
+        header.steps_per_chunk = settings.steps_per_chunk;
+        write(&header, sizeof(header));
+    }
+
+    TrajectoryWriter::~TrajectoryWriter() {
+        try {
+            close();
+        } catch (const std::exception&) {
+            //Chunks already written stay readable without the index
+        }
+    }
+
+    void TrajectoryWriter::append(const PhysicsWorld& world) {
+        if(!file.is_open()) throw RuntimeException("Trajectory file is already closed.");
+        const uint32_t body_count = world.getBodyCount();
+        bool same_bodies = chunk_steps > 0 && chunk_steps < settings.steps_per_chunk && body_count == chunk_handles.size();
+        for (uint32_t i = 0; same_bodies && i < body_count; ++i) {
+            same_bodies = world.getHandle(i) == chunk_handles[i];
+        }
+        if(!same_bodies){
+            flushChunk();
+            startChunk(world);
+        }
+
+        for (uint32_t i = 0; i < body_count; ++i) {
+            int64_t* last = &previous[i * VALUES_PER_BODY];
+            const double inverse_precision = 1.0 / settings.position_precision;
+            const int64_t position[3] = {std::llround(world.states.position_x[i] * inverse_precision),
+                                         std::llround(world.states.position_y[i] * inverse_precision),
+                                         std::llround(world.states.position_z[i] * inverse_precision)};
+            int64_t rotation[4] = {std::llround(world.states.rotation_x[i] * ROTATION_SCALE), std::llround(world.states.rotation_y[i] * ROTATION_SCALE),
+                                   std::llround(world.states.rotation_z[i] * ROTATION_SCALE), std::llround(world.states.rotation_w[i] * ROTATION_SCALE)};
+            //q and -q are the same rotation, keep the sign closest to the last step so the changes stay small
+            const int64_t dot = rotation[0] * last[3] + rotation[1] * last[4] + rotation[2] * last[5] + rotation[3] * last[6];
+            if(dot < 0 || (dot == 0 && rotation[3] < 0)){
+                for (auto& component : rotation) component = -component;
+            }
+            for (int k = 0; k < 3; ++k) {
+                writeVarint(chunk_data, position[k] - last[k]);
+                last[k] = position[k];
+            }
+            for (int k = 0; k < 4; ++k) {
+                writeVarint(chunk_data, rotation[k] - last[3 + k]);
+                last[3 + k] = rotation[k];
+            }
+        }
+        chunk_steps++;
+        step_count++;
+    }
+
+    void TrajectoryWriter::close() {
+        if(!file.is_open()) return;
+        flushChunk();
+        FileFooter footer{index.size(), bytes_written, {}};
+        std::memcpy(footer.magic, END_MAGIC, sizeof(END_MAGIC));
+        write(index.data(), index.size() * sizeof(TrajectoryChunkEntry));
+        write(&footer, sizeof(footer));
+        file.close();
+    }
+
+    void TrajectoryWriter::startChunk(const PhysicsWorld& world) {
+        const uint32_t body_count = world.getBodyCount();
+        chunk_handles.resize(body_count);
+        for (uint32_t i = 0; i < body_count; ++i) chunk_handles[i] = world.getHandle(i);
+        //Each chunk starts from zero, so it decodes without the chunks before it
+        previous.assign(body_count * VALUES_PER_BODY, 0);
+        chunk_data.resize(body_count * sizeof(BodyHandle));
+        std::memcpy(chunk_data.data(), chunk_handles.data(), chunk_data.size());
+    }
+
+    void TrajectoryWriter::flushChunk() {
+        if(chunk_steps == 0) return;
+        ENGIGRAPH_TRACE_SCOPE("TrajectoryWriter::flushChunk");
+        ChunkHeader header{};
+        std::memcpy(header.magic, CHUNK_MAGIC, sizeof(CHUNK_MAGIC));
+        header.step_count = chunk_steps;
+        header.first_step = step_count - chunk_steps;
+        header.body_count = (uint32_t)chunk_handles.size();
+        header.raw_size = (uint32_t)chunk_data.size();
+
+        std::vector<uint8_t> compressed;
+        if(settings.compress) compressed = compressLz(chunk_data.data(), chunk_data.size());
+        const bool use_compressed = settings.compress && compressed.size() < chunk_data.size();
+        const std::vector<uint8_t>& stored = use_compressed ? compressed : chunk_data;
+        header.stored_size = (uint32_t)stored.size();
+        header.flags = use_compressed ? CHUNK_COMPRESSED : 0;
+
+        index.push_back({header.first_step, bytes_written});
+        write(&header, sizeof(header));
+        write(stored.data(), stored.size());
+        //Flush whole chunks, so a crash never leaves half a chunk behind
+        file.flush();
+        chunk_steps = 0;
+        chunk_data.clear();
+    }
+
+    void TrajectoryWriter::write(const void* data, size_t size) {
+        file.write((const char*)data, (std::streamsize)size);
+        if(!file) throw RuntimeException("Could not write trajectory file.");
+        bytes_written += size;
+    }
+
+    TrajectoryReader::TrajectoryReader(const std::string& filename) : file(filename) {
+        const auto header = readStruct<FileHeader>(file, 0);
+        if(std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0) throw RuntimeException("Not a trajectory file, or from a different version: " + filename);
+        delta_time = header.delta_time;
+        position_precision = header.position_precision;
+        steps_per_chunk = std::max(header.steps_per_chunk, 1u);
+
+        bool has_index = false;
+        if(file.getSize() >= sizeof(FileHeader) + sizeof(FileFooter)){
+            const auto footer = readStruct<FileFooter>(file, file.getSize() - sizeof(FileFooter));
+            has_index = std::memcmp(footer.magic, END_MAGIC, sizeof(END_MAGIC)) == 0 && footer.index_offset >= sizeof(FileHeader) &&
+                        footer.chunk_count <= (file.getSize() - sizeof(FileFooter) - footer.index_offset) / sizeof(TrajectoryChunkEntry) &&
+                        footer.index_offset + footer.chunk_count * sizeof(TrajectoryChunkEntry) + sizeof(FileFooter) == file.getSize();
+            if(has_index){
+                index.resize(footer.chunk_count);
+                std::memcpy(index.data(), file.getData() + footer.index_offset, index.size() * sizeof(TrajectoryChunkEntry));
+            }
+        }
+        if(!has_index){
+            //Never closed, find the chunks that made it to disk
+            uint64_t offset = sizeof(FileHeader);
+            while (file.getSize() - offset >= sizeof(ChunkHeader)) {
+                const auto chunk_header = readStruct<ChunkHeader>(file, offset);
+                if(std::memcmp(chunk_header.magic, CHUNK_MAGIC, sizeof(CHUNK_MAGIC)) != 0) break;
+                if(chunk_header.stored_size > file.getSize() - offset - sizeof(ChunkHeader)) break;
+                index.push_back({chunk_header.first_step, offset});
+                offset += sizeof(ChunkHeader) + chunk_header.stored_size;
+            }
+        }
+        if(!index.empty()){
+            const auto last = readStruct<ChunkHeader>(file, index.back().offset);
+            step_count = last.first_step + last.step_count;
+        }
+    }
+
+    const TrajectoryFrame& TrajectoryReader::readStep(uint64_t step) {
+        if(step >= step_count) throw RuntimeException("Trajectory step out of range.");
+        const size_t chunk_index = findChunk(step);
+        if(chunk_index != chunk) loadChunk(chunk_index);
+        const uint64_t local_step = step - index[chunk].first_step;
+        if(local_step >= chunk_step_count) throwCorrupt();
+        if(local_step + 1 < cursor_step) rewindChunk();
+        while (cursor_step <= local_step) decodeStep();
+
+        frame.step = step;
+        const uint32_t body_count = frame.getBodyCount();
+        for (uint32_t i = 0; i < body_count; ++i) {
+            const int64_t* values = &current[i * VALUES_PER_BODY];
+            frame.positions[i] = Eigen::Vector3d((double)values[0], (double)values[1], (double)values[2]) * position_precision;
+            frame.rotations[i] = Eigen::Quaterniond((double)values[6], (double)values[3], (double)values[4], (double)values[5]).normalized();
+        }
+        return frame;
+    }
+
+    size_t TrajectoryReader::findChunk(uint64_t step) const {
+        //Full chunks put a step at a fixed chunk
+        const uint64_t guess = step / steps_per_chunk;
+        if(guess < index.size() && index[guess].first_step <= step && (guess + 1 == index.size() || index[guess + 1].first_step > step)){
+            return guess;
+        }
+        auto after = std::upper_bound(index.begin(), index.end(), step, [](uint64_t value, const TrajectoryChunkEntry& entry){ return value < entry.first_step; });
+        if(after == index.begin()) throwCorrupt();
+        return (size_t)(after - index.begin()) - 1;
+    }
+
+    void TrajectoryReader::loadChunk(size_t chunk_index) {
+        ENGIGRAPH_TRACE_SCOPE("TrajectoryReader::loadChunk");
+        chunk = SIZE_MAX;
+        const uint64_t offset = index[chunk_index].offset;
+        const auto header = readStruct<ChunkHeader>(file, offset);
+        if(std::memcmp(header.magic, CHUNK_MAGIC, sizeof(CHUNK_MAGIC)) != 0) throwCorrupt();
+        if(header.stored_size > file.getSize() - offset - sizeof(ChunkHeader)) throwCorrupt();
+        if(header.raw_size < (uint64_t)header.body_count * sizeof(BodyHandle)) throwCorrupt();
+        const uint8_t* stored = file.getData() + offset + sizeof(ChunkHeader);
+        if(header.flags & CHUNK_COMPRESSED){
+            decompressed.resize(header.raw_size);
+            decompressLz(stored, header.stored_size, decompressed.data(), decompressed.size());
+            chunk_data = decompressed.data();
+        }else{
+            if(header.stored_size != header.raw_size) throwCorrupt();
+            decompressed.clear();
+            chunk_data = stored;
+        }
+        chunk_size = header.raw_size;
+        chunk_step_count = header.step_count;
+
+        frame.handles.resize(header.body_count);
+        std::memcpy(frame.handles.data(), chunk_data, header.body_count * sizeof(BodyHandle));
+        frame.positions.resize(header.body_count);
+        frame.rotations.resize(header.body_count);
+        poses_offset = header.body_count * sizeof(BodyHandle);
+        chunk = chunk_index;
+        rewindChunk();
+    }
+
+    void TrajectoryReader::rewindChunk() {
+        cursor = poses_offset;
+        cursor_step = 0;
+        current.assign(frame.handles.size() * VALUES_PER_BODY, 0);
+    }
+
+    void TrajectoryReader::decodeStep() {
+        for (auto& value : current) {
+            value += readVarint(chunk_data, chunk_size, cursor);
+        }
+        cursor_step++;
+    }
+
+} // EngiGraph
@@ -0,0 +1,202 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+#include "src/Physics/World/PhysicsWorld.h"
+
+namespace EngiGraph {
+
+    /**
+     * Options for writing a trajectory.
+     */
+    struct TrajectorySettings {
+        /**
+         * Most steps per chunk. Longer chunks compress better, but seeking decodes up to a whole chunk.
+         */
+        uint32_t steps_per_chunk = 64;
+        /**
+         * Positions are rounded to multiples of this.
+         */
+        double position_precision = 1e-4;
+        /**
+         * LZ compress each chunk. Chunks that do not get smaller are stored as is.
+         */
+        bool compress = true;
+    };
+
+    /**
+     * Poses of all bodies at one step.
+     */
+    struct TrajectoryFrame {
+        uint64_t step = 0;
+        std::vector<BodyHandle> handles{};
+        std::vector<Eigen::Vector3d> positions{};
+        std::vector<Eigen::Quaterniond> rotations{};
+
+        [[nodiscard]] uint32_t getBodyCount() const {
+            return (uint32_t)handles.size();
+        }
+
+        /**
+         * Get the transform of a body.
+         */
+        [[nodiscard]] Eigen::Matrix4d getTransform(uint32_t index) const;
+    };
+
+    /**
+     * Where a chunk of a trajectory starts.
+     */
+    struct TrajectoryChunkEntry {
+        uint64_t first_step = 0;
+        /**
+         * Byte offset of the chunk header in the file.
+         */
+        uint64_t offset = 0;
+    };
+
+    /**
+     * Appends the pose of every body at every step to a trajectory file.
+     * @details The file is a header followed by chunks of steps, then an index of the chunks on close. Each chunk starts with the handles
+     * of its bodies and stores every pose as the change from the step before, quantized and variable length encoded,
+     * so resting bodies cost a few bytes per step before compression. A chunk ends early when bodies are added or removed.
+     * @details Chunks decode on their own, and are written whole, so a file cut short by a crash is still readable up to its last chunk.
+     */
+    class TrajectoryWriter {
+    public:
+        /**
+         * Create a trajectory file, replacing any existing file.
+         * @param filename File to write.
+         * @param delta_time Length of a step, stored for playback.
+         * @param settings Chunking, precision and compression.
+         * @throws RuntimeException File could not be created.
+         */
+        TrajectoryWriter(const std::string& filename, double delta_time, TrajectorySettings settings = {});
+
+        /**
+         * Closes the file if close() was not called.
+         */
+        ~TrajectoryWriter();
+
+        TrajectoryWriter(const TrajectoryWriter&) = delete;
+        TrajectoryWriter& operator=(const TrajectoryWriter&) = delete;
+
+        /**
+         * Append the current poses of all bodies as the next step.
+         * @throws RuntimeException File is closed or could not be written.
+         */
+        void append(const PhysicsWorld& world);
+
+        /**
+         * Write the last chunk and the index.
+         * @throws RuntimeException File could not be written.
+         */
+        void close();
+
+        [[nodiscard]] uint64_t getStepCount() const {
+            return step_count;
+        }
+
+        /**
+         * Get the size of the file so far, excluding the chunk being built.
+         */
+        [[nodiscard]] uint64_t getBytesWritten() const {
+            return bytes_written;
+        }
+
+    private:
+        std::ofstream file;
+        TrajectorySettings settings;
+        uint64_t step_count = 0;
+        uint64_t bytes_written = 0;
+        std::vector<TrajectoryChunkEntry> index{};
+
+        //Chunk being built
+        uint32_t chunk_steps = 0;
+        std::vector<BodyHandle> chunk_handles{};
+        /**
+         * Quantized pose of each body at the last step, 7 values per body.
+         */
+        std::vector<int64_t> previous{};
+        std::vector<uint8_t> chunk_data{};
+
+        void startChunk(const PhysicsWorld& world);
+        void flushChunk();
+        void write(const void* data, size_t size);
+    };
+
+    /**
+     * Reads a trajectory file written by TrajectoryWriter, through a memory mapping.
+     * @details Finding the chunk of a step is O(1) when chunks are full, and a binary search over the index otherwise.
+     * Within a chunk, stepping forward continues from the last decoded step, so playing a trajectory in order decodes each step once.
+     */
+    class TrajectoryReader {
+    public:
+        /**
+         * Open a trajectory file.
+         * @details Files without an index, from a writer that never closed, are scanned chunk by chunk instead.
+         * @param filename File to open.
+         * @throws RuntimeException File is missing or not a trajectory.
+         */
+        explicit TrajectoryReader(const std::string& filename);
+
+        [[nodiscard]] uint64_t getStepCount() const {
+            return step_count;
+        }
+
+        [[nodiscard]] double getDeltaTime() const {
+            return delta_time;
+        }
+
+        [[nodiscard]] size_t getChunkCount() const {
+            return index.size();
+        }
+
+        /**
+         * Decode the poses of a step.
+         * @param step Step to read.
+         * @throws RuntimeException Step out of range, or chunk is corrupt.
+         * @return Poses, valid until the next read.
+         */
+        const TrajectoryFrame& readStep(uint64_t step);
+
+    private:
+        MappedFile file;
+        double delta_time = 0.0;
+        double position_precision = 0.0;
+        uint32_t steps_per_chunk = 0;
+        uint64_t step_count = 0;
+        std::vector<TrajectoryChunkEntry> index{};
+
+        //Decoding state of the current chunk
+        size_t chunk = SIZE_MAX;
+        uint32_t chunk_step_count = 0;
+        /**
+         * Decompressed chunk, empty if the chunk is stored uncompressed and read straight from the mapping.
+         */
+        std::vector<uint8_t> decompressed{};
+        const uint8_t* chunk_data = nullptr;
+        size_t chunk_size = 0;
+        size_t poses_offset = 0;
+        /**
+         * Next undecoded byte and step in the chunk.
+         */
+        size_t cursor = 0;
+        uint32_t cursor_step = 0;
+        std::vector<int64_t> current{};
+        TrajectoryFrame frame{};
+
+        [[nodiscard]] size_t findChunk(uint64_t step) const;
+        void loadChunk(size_t chunk_index);
+        void rewindChunk();
+        void decodeStep();
+    };
+
+} // EngiGraph
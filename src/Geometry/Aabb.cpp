@@ -0,0 +1,26 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "Aabb.h"
+
+namespace EngiGraph {
+
+    Aabb Aabb::transformed(const Eigen::Matrix4d& transform) const {
+        if(isEmpty()) return {};
+        //Each output extent is the sum of the extents of the rotated and scaled axes
+        const Eigen::Matrix3d linear = transform.topLeftCorner<3,3>();
+        const Eigen::Vector3d center = linear * (0.5 * (minimum + maximum)) + transform.topRightCorner<3,1>();
+        const Eigen::Vector3d extent = linear.cwiseAbs() * (0.5 * (maximum - minimum));
+        return {center - extent, center + extent};
+    }
+
+    Aabb computeBounds(const Mesh& mesh) {
+        Aabb bounds{};
+        for (const auto& vertex : mesh.vertices) {
+            bounds.extend(vertex.cast<double>());
+        }
+        return bounds;
+    }
+
+} // EngiGraph
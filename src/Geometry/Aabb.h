@@ -0,0 +1,86 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <algorithm>
+#include <limits>
+#include "Mesh.h"
+
+namespace EngiGraph {
+
+    /**
+     * Axis aligned bounding box.
+     */
+    struct Aabb {
+        /**
+         * Starts out empty, so extending it by a point gives the bounds of that point.
+         */
+        Eigen::Vector3d minimum = Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity());
+        Eigen::Vector3d maximum = Eigen::Vector3d::Constant(-std::numeric_limits<double>::infinity());
+
+        void extend(const Eigen::Vector3d& point) {
+            minimum = minimum.cwiseMin(point);
+            maximum = maximum.cwiseMax(point);
+        }
+
+        void extend(const Aabb& other) {
+            minimum = minimum.cwiseMin(other.minimum);
+            maximum = maximum.cwiseMax(other.maximum);
+        }
+
+        /**
+         * Check if two boxes overlap or touch.
+         */
+        [[nodiscard]] bool overlaps(const Aabb& other) const {
+            return (minimum.array() <= other.maximum.array()).all() && (other.minimum.array() <= maximum.array()).all();
+        }
+
+        [[nodiscard]] bool isEmpty() const {
+            return (minimum.array() > maximum.array()).any();
+        }
+
+        /**
+         * Check if a ray segment touches the box.
+         * @param origin Start of the ray.
+         * @param inverse_direction One over each component of the direction. Use a large finite value for zero components, so no NaN comes up.
+         * @param max_distance Length of the segment, in multiples of the direction.
+         */
+        [[nodiscard]] bool intersectsRay(const Eigen::Vector3d& origin, const Eigen::Vector3d& inverse_direction, double max_distance) const {
+            double enter = 0.0;
+            double exit = max_distance;
+            for (int axis = 0; axis < 3; ++axis) {
+                const double near = (minimum[axis] - origin[axis]) * inverse_direction[axis];
+                const double far = (maximum[axis] - origin[axis]) * inverse_direction[axis];
+                enter = std::max(enter, std::min(near, far));
+                exit = std::min(exit, std::max(near, far));
+            }
+            return enter <= exit;
+        }
+
+        /**
+         * Get the bounds of this box after a transform. The result contains the whole transformed box, so it may be larger than needed.
+         * @param transform Affine transform.
+         */
+        [[nodiscard]] Aabb transformed(const Eigen::Matrix4d& transform) const;
+    };
+
+    /**
+     * Get the bounds of a local box moving between two transforms.
+     * @details Points that move in straight lines between the transforms, as in CCD, stay inside this box.
+     */
+    inline Aabb sweptBounds(const Aabb& local_bounds, const Eigen::Matrix4d& initial, const Eigen::Matrix4d& final) {
+        Aabb swept = local_bounds.transformed(initial);
+        if(final != initial) swept.extend(local_bounds.transformed(final));
+        return swept;
+    }
+
+    /**
+     * Get the bounds of the vertices of a mesh.
+     * @return Empty box for a mesh without vertices.
+     */
+    Aabb computeBounds(const Mesh& mesh);
+
+} // EngiGraph
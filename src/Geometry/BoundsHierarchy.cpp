@@ -0,0 +1,42 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "BoundsHierarchy.h"
+#include <algorithm>
+#include <numeric>
+
+namespace EngiGraph {
+
+    BoundsHierarchy::BoundsHierarchy(std::vector<Aabb> item_bounds) : item_bounds(std::move(item_bounds)) {
+        if(this->item_bounds.empty()) return;
+        ordered_items.resize(this->item_bounds.size());
+        std::iota(ordered_items.begin(), ordered_items.end(), 0u);
+        nodes.reserve(2 * this->item_bounds.size() / LEAF_SIZE + 1);
+        buildNode(0, (uint32_t)this->item_bounds.size());
+    }
+
+    void BoundsHierarchy::buildNode(uint32_t first, uint32_t count) {
+        const auto node_index = (uint32_t)nodes.size();
+        nodes.emplace_back();
+        Aabb bounds{};
+        for (uint32_t i = first; i < first + count; ++i) bounds.extend(item_bounds[ordered_items[i]]);
+        nodes[node_index].bounds = bounds;
+        if(count <= LEAF_SIZE){
+            nodes[node_index].first = first;
+            nodes[node_index].count = count;
+            return;
+        }
+        //Split at the median item center along the longest axis
+        Eigen::Index axis;
+        (bounds.maximum - bounds.minimum).maxCoeff(&axis);
+        auto begin = ordered_items.begin() + first;
+        std::nth_element(begin, begin + count / 2, begin + count, [&](uint32_t a, uint32_t b){
+            return item_bounds[a].minimum[axis] + item_bounds[a].maximum[axis] < item_bounds[b].minimum[axis] + item_bounds[b].maximum[axis];
+        });
+        buildNode(first, count / 2);
+        nodes[node_index].second_child = (uint32_t)nodes.size();
+        buildNode(first + count / 2, count - count / 2);
+    }
+
+} // EngiGraph
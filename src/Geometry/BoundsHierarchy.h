@@ -0,0 +1,96 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Aabb.h"
+
+namespace EngiGraph {
+
+    /**
+     * Bounding box hierarchy over a list of items, like the children of a collider or the triangles of a mesh.
+     * @details Built top down, splitting at the median item center along the longest axis, so it is balanced. Items keep their own bounds,
+     * so a traversal can test an item before visiting it. Immutable once built.
+     */
+    class BoundsHierarchy {
+    public:
+        /**
+         * Items per leaf.
+         */
+        static constexpr uint32_t LEAF_SIZE = 2;
+
+        BoundsHierarchy() = default;
+
+        /**
+         * Build a hierarchy.
+         * @param item_bounds Bounds of each item, indexed by item.
+         */
+        explicit BoundsHierarchy(std::vector<Aabb> item_bounds);
+
+        [[nodiscard]] size_t getItemCount() const {
+            return item_bounds.size();
+        }
+
+        [[nodiscard]] const Aabb& getItemBounds(uint32_t item) const {
+            return item_bounds[item];
+        }
+
+        /**
+         * Get the bounds of all items.
+         */
+        [[nodiscard]] Aabb getBounds() const {
+            return nodes.empty() ? Aabb{} : nodes[0].bounds;
+        }
+
+        /**
+         * Visit every item whose bounds and enclosing nodes pass a test.
+         * @param test Called with the bounds of nodes and items, returns false to skip them. May change between calls, like a ray that gets shorter.
+         * @param visit Called with the index of each item that passes, returns false to stop.
+         */
+        template<typename Test, typename Visit> void traverse(Test&& test, Visit&& visit) const {
+            if(nodes.empty()) return;
+            //Depth is about log2 of the item count, so a fixed stack is plenty
+            uint32_t stack[64];
+            uint32_t stack_size = 0;
+            stack[stack_size++] = 0;
+            while (stack_size > 0) {
+                const uint32_t node_index = stack[--stack_size];
+                const Node& node = nodes[node_index];
+                if(!test(node.bounds)) continue;
+                if(node.count == 0){
+                    stack[stack_size++] = node.second_child;
+                    stack[stack_size++] = node_index + 1;
+                    continue;
+                }
+                for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                    const uint32_t item = ordered_items[i];
+                    if(test(item_bounds[item]) && !visit(item)) return;
+                }
+            }
+        }
+
+    private:
+        /**
+         * Leaves have a count of items. Inner nodes have their first child right after them, and their second at second_child.
+         */
+        struct Node {
+            Aabb bounds{};
+            uint32_t first = 0;
+            uint32_t count = 0;
+            uint32_t second_child = 0;
+        };
+
+        std::vector<Aabb> item_bounds{};
+        std::vector<Node> nodes{};
+        /**
+         * Item indices in hierarchy order, each leaf covers a range of it.
+         */
+        std::vector<uint32_t> ordered_items{};
+
+        void buildNode(uint32_t first, uint32_t count);
+    };
+
+} // EngiGraph
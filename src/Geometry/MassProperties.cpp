@@ -0,0 +1,115 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "MassProperties.h"
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include "src/Profiling/Trace.h"
+
+namespace EngiGraph {
+
+    namespace {
+
+        /**
+         * Triangles per chunk. Meshes with more than one chunk are summed in parallel.
+         */
+        constexpr uint32_t TRIANGLES_PER_CHUNK = 8192;
+
+        /**
+         * Mass, first and second moment about the origin. The second moment is symmetric, so only 6 entries are kept.
+         */
+        struct Moments {
+            double mass = 0.0;
+            double first[3] = {0, 0, 0};
+            double xx = 0, yy = 0, zz = 0, xy = 0, xz = 0, yz = 0;
+        };
+
+        void addTriangles(const Mesh& mesh, MassModel model, const Eigen::Vector3d& scale, uint32_t first_triangle, uint32_t last_triangle, Moments& moments) {
+            Moments sum{};
+            for (uint32_t j = first_triangle; j < last_triangle; ++j) {
+                const Eigen::Vector3d a = mesh.vertices[mesh.triangle_indices[j * 3 + 0]].cast<double>().cwiseProduct(scale);
+                const Eigen::Vector3d b = mesh.vertices[mesh.triangle_indices[j * 3 + 1]].cast<double>().cwiseProduct(scale);
+                const Eigen::Vector3d c = mesh.vertices[mesh.triangle_indices[j * 3 + 2]].cast<double>().cwiseProduct(scale);
+                const Eigen::Vector3d s = a + b + c;
+                double weight, first_weight, second_weight;
+                if(model == MassModel::SOLID){
+                    //Signed tetrahedron with the origin as its fourth vertex
+                    weight = a.dot(b.cross(c)) / 6.0;
+                    first_weight = weight / 4.0;
+                    second_weight = weight / 20.0;
+                }else{
+                    weight = 0.5 * (b - a).cross(c - a).norm();
+                    first_weight = weight / 3.0;
+                    second_weight = weight / 12.0;
+                }
+                //Integral of x * x^T is weight * (a a^T + b b^T + c c^T + s s^T) / 20 for tetrahedra and / 12 for triangles
+                sum.mass += weight;
+                sum.first[0] += first_weight * s.x();
+                sum.first[1] += first_weight * s.y();
+                sum.first[2] += first_weight * s.z();
+                sum.xx += second_weight * (a.x() * a.x() + b.x() * b.x() + c.x() * c.x() + s.x() * s.x());
+                sum.yy += second_weight * (a.y() * a.y() + b.y() * b.y() + c.y() * c.y() + s.y() * s.y());
+                sum.zz += second_weight * (a.z() * a.z() + b.z() * b.z() + c.z() * c.z() + s.z() * s.z());
+                sum.xy += second_weight * (a.x() * a.y() + b.x() * b.y() + c.x() * c.y() + s.x() * s.y());
+                sum.xz += second_weight * (a.x() * a.z() + b.x() * b.z() + c.x() * c.z() + s.x() * s.z());
+                sum.yz += second_weight * (a.y() * a.z() + b.y() * b.z() + c.y() * c.z() + s.y() * s.z());
+            }
+            moments = sum;
+        }
+
+        tf::Executor& getExecutor() {
+            static tf::Executor executor;
+            return executor;
+        }
+
+    }
+
+    MassProperties MassProperties::scaled(MassModel model, double density, const Eigen::Vector3d& scale) const {
+        //Solid mass grows with volume, shell mass with area
+        const double mass_scale = density * (model == MassModel::SOLID ? scale.prod() : scale.x() * scale.x());
+        MassProperties result{};
+        result.mass = mass * mass_scale;
+        result.center_of_mass = center_of_mass.cwiseProduct(scale);
+        result.second_moment = mass_scale * scale.asDiagonal() * second_moment * scale.asDiagonal();
+        return result;
+    }
+
+    MassProperties computeMassProperties(const Mesh& mesh, MassModel model, const Eigen::Vector3d& scale, bool parallel) {
+        ENGIGRAPH_TRACE_SCOPE("computeMassProperties");
+        const uint32_t triangle_count = (uint32_t)mesh.triangle_indices.size() / 3;
+        const uint32_t chunk_count = (triangle_count + TRIANGLES_PER_CHUNK - 1) / TRIANGLES_PER_CHUNK;
+        std::vector<Moments> chunks(chunk_count);
+        auto sum_chunk = [&](uint32_t chunk){
+            addTriangles(mesh, model, scale, chunk * TRIANGLES_PER_CHUNK, std::min(triangle_count, (chunk + 1) * TRIANGLES_PER_CHUNK), chunks[chunk]);
+        };
+        if(parallel && chunk_count > 1){
+            tf::Taskflow taskflow;
+            taskflow.for_each_index(0u, chunk_count, 1u, sum_chunk);
+            getExecutor().run(taskflow).wait();
+        }else{
+            for (uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+                sum_chunk(chunk);
+            }
+        }
+
+        double mass = 0.0;
+        Eigen::Vector3d first = {0,0,0};
+        Eigen::Matrix3d second = Eigen::Matrix3d::Zero();
+        for (const auto& chunk : chunks) {
+            mass += chunk.mass;
+            first += Eigen::Vector3d{chunk.first[0], chunk.first[1], chunk.first[2]};
+            second += (Eigen::Matrix3d() << chunk.xx, chunk.xy, chunk.xz,
+                                            chunk.xy, chunk.yy, chunk.yz,
+                                            chunk.xz, chunk.yz, chunk.zz).finished();
+        }
+        MassProperties properties{};
+        if(mass == 0.0) return properties;
+        properties.mass = mass;
+        properties.center_of_mass = first / mass;
+        //Parallel axis theorem, moving the second moment to the center of mass
+        properties.second_moment = second - mass * properties.center_of_mass * properties.center_of_mass.transpose();
+        return properties;
+    }
+
+} // EngiGraph
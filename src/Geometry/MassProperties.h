@@ -0,0 +1,70 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include "Mesh.h"
+
+namespace EngiGraph {
+
+    /**
+     * How mass is spread over a mesh.
+     */
+    enum class MassModel {
+        /**
+         * Mass fills the volume enclosed by the mesh. The mesh must be closed, with faces wound counter-clockwise seen from outside.
+         */
+        SOLID,
+        /**
+         * Mass lies on the surface of the mesh, like thin panels. Works for open meshes.
+         */
+        SHELL
+    };
+
+    /**
+     * Mass, center of mass and inertia of a body.
+     */
+    struct MassProperties {
+        /**
+         * Total mass. Volume or surface area for unit density.
+         */
+        double mass = 0.0;
+        Eigen::Vector3d center_of_mass = {0,0,0};
+        /**
+         * Integral of x * x^T over the mass, with x relative to the center of mass.
+         * @details Unlike the inertia tensor, this scales simply with non-uniform scale.
+         */
+        Eigen::Matrix3d second_moment = Eigen::Matrix3d::Zero();
+
+        /**
+         * Get the inertia tensor about the center of mass.
+         */
+        [[nodiscard]] Eigen::Matrix3d getInertiaTensor() const {
+            return second_moment.trace() * Eigen::Matrix3d::Identity() - second_moment;
+        }
+
+        /**
+         * Get the properties after scaling the mesh and its density, without looking at the mesh again.
+         * @param model Model the properties were computed with.
+         * @param density Multiplies the mass.
+         * @param scale Scale along each local axis. Must be uniform for MassModel::SHELL, since surface area does not scale simply otherwise.
+         * @return Scaled properties.
+         */
+        [[nodiscard]] MassProperties scaled(MassModel model, double density, const Eigen::Vector3d& scale = {1,1,1}) const;
+    };
+
+    /**
+     * Compute the mass properties of a mesh with unit density, in a single pass over its triangles.
+     * @details Solid meshes are split into tetrahedra from the origin and integrated with the divergence theorem. Shells integrate each triangle exactly.
+     * @details Large meshes are summed in parallel, in fixed chunks that are combined in order, so the result does not depend on thread timing.
+     * @param mesh Mesh to integrate.
+     * @param model Solid or shell.
+     * @param scale Scale applied to the vertices first.
+     * @param parallel Allow summing large meshes on several threads.
+     * @return Properties. Mass is zero for an empty mesh, and negative for a solid mesh wound inside out.
+     */
+    MassProperties computeMassProperties(const Mesh& mesh, MassModel model, const Eigen::Vector3d& scale = {1,1,1}, bool parallel = true);
+
+} // EngiGraph
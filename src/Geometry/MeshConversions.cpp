@@ -5,7 +5,7 @@
 #include "MeshConversions.h"
 #include "MeshUtilities.h"
 namespace EngiGraph {
-    Mesh stripVisualMesh(const VisualMesh &input_mesh) {
+    Mesh stripVisualMesh(const VisualMesh &input_mesh, float combine_delta) {
         Mesh mesh;
         mesh.triangle_indices = input_mesh.indices;
 
@@ -14,6 +14,6 @@ namespace EngiGraph {
             mesh.vertices.push_back(vertex.position);
         }
 
-        return reduceMesh(mesh);
+        return reduceMesh(mesh, combine_delta);
     }
 } // EngiGraph
\ No newline at end of file
@@ -10,8 +10,9 @@ namespace EngiGraph {
     /**
      * Removes visual data(normals and texture coordinates) and reduces visual mesh to valid base mesh.
      * @param input_mesh Input mesh.
+     * @param combine_delta Maximum distance from which vertices are considered to be equal.
      * @return Geometry only mesh with unique vertices.
      */
-    Mesh stripVisualMesh(const VisualMesh& input_mesh);
+    Mesh stripVisualMesh(const VisualMesh& input_mesh, float combine_delta = 0.001f);
 
 } // EngiGraph
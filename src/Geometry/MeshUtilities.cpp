@@ -4,10 +4,13 @@
 
 #include <unordered_set>
 #include "MeshUtilities.h"
+#include "src/Profiling/Trace.h"
+#include "src/Exceptions/RuntimeException.h"
 
 namespace EngiGraph {
 
     Mesh reduceMesh(const Mesh &input, float combine_delta) {
+        ENGIGRAPH_TRACE_SCOPE("reduceMesh");
         std::vector<Eigen::Vector3f> vertices;
         std::map<uint32_t,uint32_t> vertex_mappings;
 
@@ -61,4 +64,40 @@ namespace EngiGraph {
         return {vertices,indices, edge_indices};
     }
 
+    Mesh makeBoxMesh(const Eigen::Vector3f& dimensions) {
+        Mesh box;
+        //Corner j has x, y and z set by bits 2, 1 and 0
+        for (uint32_t j = 0; j < 8; ++j) {
+            Eigen::Vector3f corner{(float)((j >> 2) & 1), (float)((j >> 1) & 1), (float)(j & 1)};
+            box.vertices.emplace_back((corner - Eigen::Vector3f{0.5f, 0.5f, 0.5f}).cwiseProduct(dimensions));
+        }
+        //Same winding as test_files/cube.obj
+        box.triangle_indices = {0,6,4, 0,2,6, 0,3,2, 0,1,3, 2,7,6, 2,3,7, 4,6,7, 4,7,5, 0,4,5, 0,5,1, 1,5,7, 1,7,3};
+        return reduceMesh(box);
+    }
+
+    Mesh makeTorusMesh(float major_radius, float minor_radius, uint32_t rings, uint32_t sides) {
+        if(rings < 3 || sides < 3) throw RuntimeException("A torus needs at least 3 rings and 3 sides.");
+        Mesh torus;
+        const double ring_step = 2.0 * M_PI / rings;
+        const double side_step = 2.0 * M_PI / sides;
+        for (uint32_t ring = 0; ring < rings; ++ring) {
+            for (uint32_t side = 0; side < sides; ++side) {
+                const double distance = major_radius + minor_radius * std::cos(side * side_step);
+                torus.vertices.emplace_back((float)(distance * std::cos(ring * ring_step)), (float)(minor_radius * std::sin(side * side_step)), (float)(distance * std::sin(ring * ring_step)));
+            }
+        }
+        //Vertices are built unique, so this is cheaper than reduceMesh()
+        auto index = [&](uint32_t ring, uint32_t side){ return (ring % rings) * sides + side % sides; };
+        for (uint32_t ring = 0; ring < rings; ++ring) {
+            for (uint32_t side = 0; side < sides; ++side) {
+                const uint32_t a = index(ring, side), b = index(ring + 1, side), c = index(ring + 1, side + 1), d = index(ring, side + 1);
+                torus.triangle_indices.insert(torus.triangle_indices.end(), {a, d, c, a, c, b});
+                //Along the ring, around the tube, and the quad diagonal
+                torus.edge_indices.insert(torus.edge_indices.end(), {a, b, a, d, a, c});
+            }
+        }
+        return torus;
+    }
+
 } // EngiGraph
\ No newline at end of file
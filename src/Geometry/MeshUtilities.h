@@ -17,4 +17,22 @@ namespace EngiGraph {
      */
     Mesh reduceMesh(const Mesh& input, float combine_delta = 0.001f);
 
+    /**
+     * Generate a box mesh centered on the origin.
+     * @param dimensions Side lengths of the box.
+     * @return Box with unique vertices and edges.
+     */
+    Mesh makeBoxMesh(const Eigen::Vector3f& dimensions);
+
+    /**
+     * Generate a torus mesh centered on the origin, around the y axis.
+     * @param major_radius Distance from the center to the middle of the tube.
+     * @param minor_radius Radius of the tube.
+     * @param rings Segments around the y axis. At least 3.
+     * @param sides Segments around the tube. At least 3.
+     * @throws RuntimeException Too few segments.
+     * @return Torus with unique vertices and edges, faces wound counter-clockwise seen from outside.
+     */
+    Mesh makeTorusMesh(float major_radius, float minor_radius, uint32_t rings = 16, uint32_t sides = 8);
+
 } // EngiGraph
@@ -0,0 +1,246 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "BodyCollision.h"
+#include <algorithm>
+
+namespace EngiGraph {
+
+    namespace {
+
+        /**
+         * A mesh moving over the step, either a whole body or a child of a compound.
+         */
+        struct MovingPiece {
+            const Mesh* mesh;
+            Eigen::Matrix4d initial;
+            Eigen::Matrix4d final;
+            Aabb bounds;
+        };
+
+        /**
+         * Gather the pieces of a body that may reach a box during the step.
+         */
+        void gatherPieces(const PhysicsWorld& world, const CollisionBounds& bounds, uint32_t body, const Aabb& other_bounds, std::vector<MovingPiece>& pieces) {
+            const Eigen::Matrix4d& initial = world.current_transforms[body];
+            const Eigen::Matrix4d& final = world.future_transforms[body];
+            const auto& compound = world.compound_colliders[body];
+            if(!compound){
+                pieces.push_back({world.colliders[body].get(), initial, final, bounds.getBounds(body)});
+                return;
+            }
+            std::vector<uint32_t> children;
+            compound->queryChildren(initial, final, other_bounds, children);
+            const Eigen::Vector3d margin = Eigen::Vector3d::Constant(CollisionBounds::MARGIN);
+            for (uint32_t child : children) {
+                const CompoundChild& piece = compound->getChildren()[child];
+                Aabb swept = sweptBounds(compound->getChildBounds(child), initial, final);
+                swept.minimum -= margin;
+                swept.maximum += margin;
+                pieces.push_back({piece.mesh.get(), initial * piece.local_transform, final * piece.local_transform, swept});
+            }
+        }
+
+        /**
+         * Cut the triangles of a static mesh that may reach a box out of it, along with their vertices and edges.
+         * @details Vertices, triangles and edges keep their order, so CCD against the patch finds the same hits in the same order.
+         * @param triangles World space hierarchy over the triangles of the mesh.
+         * @return False if every triangle may reach the box, so the whole mesh should be used.
+         */
+        bool cutStaticPatch(const Mesh& mesh, const BoundsHierarchy& triangles, const Aabb& other_bounds, Mesh& patch) {
+            std::vector<uint32_t> found;
+            triangles.traverse([&](const Aabb& node_bounds){
+                return node_bounds.overlaps(other_bounds);
+            }, [&](uint32_t triangle){
+                found.push_back(triangle);
+                return true;
+            });
+            if(found.size() == triangles.getItemCount()) return false;
+            std::sort(found.begin(), found.end());
+            constexpr uint32_t unused = 0xFFFFFFFF;
+            std::vector<uint32_t> patch_vertices(mesh.vertices.size(), unused);
+            for (uint32_t triangle : found) {
+                for (int corner = 0; corner < 3; ++corner) {
+                    patch_vertices[mesh.triangle_indices[triangle * 3 + corner]] = 0;
+                }
+            }
+            for (uint32_t vertex = 0; vertex < mesh.vertices.size(); ++vertex) {
+                if(patch_vertices[vertex] == unused) continue;
+                patch_vertices[vertex] = patch.vertices.size();
+                patch.vertices.push_back(mesh.vertices[vertex]);
+            }
+            patch.triangle_indices.reserve(found.size() * 3);
+            for (uint32_t triangle : found) {
+                for (int corner = 0; corner < 3; ++corner) {
+                    patch.triangle_indices.push_back(patch_vertices[mesh.triangle_indices[triangle * 3 + corner]]);
+                }
+            }
+            for (size_t edge = 0; edge < mesh.edge_indices.size(); edge += 2) {
+                const uint32_t start = patch_vertices[mesh.edge_indices[edge]];
+                const uint32_t end = patch_vertices[mesh.edge_indices[edge + 1]];
+                if(start != unused && end != unused) patch.edge_indices.insert(patch.edge_indices.end(), {start, end});
+            }
+            return true;
+        }
+
+        /**
+         * Keep the earliest hits over several pieces, with the same time tolerance linearCCD uses.
+         */
+        void keepEarliest(std::vector<CCDHit>& hits, std::vector<CCDHit>&& piece_hits) {
+            constexpr double time_delta = 0.00001;
+            if(piece_hits.empty()) return;
+            const double time = piece_hits.front().time;
+            if(hits.empty() || time < hits.front().time - time_delta){
+                hits = std::move(piece_hits);
+            }else if(time < hits.front().time + time_delta){
+                hits.insert(hits.end(), piece_hits.begin(), piece_hits.end());
+            }
+        }
+
+        /**
+         * Run CCD between a height field body and another body.
+         * @return Earliest hits, with normals from the height field to the other body.
+         */
+        std::vector<CCDHit> collideHeightField(const PhysicsWorld& world, const CollisionBounds& bounds, uint32_t field_body, uint32_t other_body) {
+            const HeightField& field = *world.height_fields[field_body];
+            const Eigen::Matrix4d& field_initial = world.current_transforms[field_body];
+            const Eigen::Matrix4d& field_final = world.future_transforms[field_body];
+            const Eigen::Matrix4d field_initial_inverse = field_initial.inverse();
+            std::vector<MovingPiece> pieces;
+            gatherPieces(world, bounds, other_body, bounds.getBounds(field_body), pieces);
+            std::vector<CCDHit> hits;
+            for (const auto& piece : pieces) {
+                //Points of the piece move in straight lines relative to the field, so both ends of the step bound its footprint
+                Aabb footprint = piece.bounds.transformed(field_initial_inverse);
+                if(field_final != field_initial) footprint.extend(piece.bounds.transformed(field_final.inverse()));
+                HeightField::CellRange cells;
+                if(!field.findCells(footprint, cells)) continue;
+                const Mesh patch = field.buildPatch(cells);
+                keepEarliest(hits, linearCCD(patch, *piece.mesh, field_initial, piece.initial, field_final, piece.final));
+            }
+            return hits;
+        }
+
+        /**
+         * Run CCD between a signed distance field body and the vertices of another body.
+         * @details Each vertex moves in a straight line through the space of the field, and is marched along it by its distance to the surface,
+         * which can never step past the surface. Hits are where a vertex comes within a small tolerance of the surface.
+         * If the march runs out of steps with the end of the path touching the surface, the hit is found by bisection instead.
+         * @return Earliest hits, with normals from the field to the other body.
+         */
+        std::vector<CCDHit> collideSignedDistanceField(const PhysicsWorld& world, const CollisionBounds& bounds, uint32_t field_body, uint32_t other_body) {
+            constexpr uint32_t max_march_steps = 32;
+            const SignedDistanceField& field = *world.signed_distance_fields[field_body];
+            //Distances are in the space of the field, before the body scale
+            const double tolerance = 0.05 * field.getCellSize();
+            const Eigen::Matrix4d& field_initial = world.current_transforms[field_body];
+            const Eigen::Matrix4d& field_final = world.future_transforms[field_body];
+            const Eigen::Matrix4d field_initial_inverse = field_initial.inverse();
+            const Eigen::Matrix4d field_final_inverse = field_final == field_initial ? field_initial_inverse : field_final.inverse();
+            std::vector<MovingPiece> pieces;
+            gatherPieces(world, bounds, other_body, bounds.getBounds(field_body), pieces);
+            std::vector<CCDHit> hits;
+            for (const auto& piece : pieces) {
+                Aabb footprint = piece.bounds.transformed(field_initial_inverse);
+                if(field_final != field_initial) footprint.extend(piece.bounds.transformed(field_final_inverse));
+                if(!footprint.overlaps(field.getBounds())) continue;
+                const Eigen::Matrix4d to_field_initial = field_initial_inverse * piece.initial;
+                const Eigen::Matrix4d to_field_final = field_final_inverse * piece.final;
+                for (const auto& vertex : piece.mesh->vertices) {
+                    const Eigen::Vector4d local_vertex = vertex.cast<double>().homogeneous();
+                    const Eigen::Vector3d start = (to_field_initial * local_vertex).head<3>();
+                    const Eigen::Vector3d path = (to_field_final * local_vertex).head<3>() - start;
+                    const double length = path.norm();
+                    double time = 0.0;
+                    bool touching = false;
+                    uint32_t step = 0;
+                    for (; step < max_march_steps; ++step) {
+                        const double distance = field.getDistance(start + time * path);
+                        if(distance <= tolerance){
+                            touching = true;
+                            break;
+                        }
+                        //The rest of the path is shorter than the distance to the surface
+                        if(length * (1.0 - time) < distance - tolerance) break;
+                        time = std::min(1.0, time + distance / length);
+                    }
+                    if(step == max_march_steps && field.getDistance(start + path) <= tolerance){
+                        //Grazing paths and band clamped distances shrink the steps, so the march can run out before reaching the surface.
+                        //The end of the path is touching, so bisect between the last point outside and the end.
+                        double outside_time = time;
+                        double inside_time = 1.0;
+                        for (uint32_t bisection = 0; bisection < max_march_steps; ++bisection) {
+                            const double middle_time = 0.5 * (outside_time + inside_time);
+                            (field.getDistance(start + middle_time * path) <= tolerance ? inside_time : outside_time) = middle_time;
+                        }
+                        time = inside_time;
+                        touching = true;
+                    }
+                    if(!touching) continue;
+                    const Eigen::Vector3d point = start + time * path;
+                    Eigen::Vector3d gradient;
+                    (void)field.getDistance(point, gradient);
+                    //Vertices already leaving the surface are free to go
+                    if(gradient.dot(path) >= 0.0 && gradient.squaredNorm() > 0.0) continue;
+                    const Eigen::Matrix4d field_at_hit = (1.0 - time) * field_initial + time * field_final;
+                    //Gradients turn into world normals with the inverse transpose of the field transform
+                    Eigen::Vector3d normal = field_at_hit.topLeftCorner<3,3>().inverse().transpose() * gradient;
+                    //Deeper than the band the field is flat, so push back against the motion instead
+                    if(normal.squaredNorm() == 0.0) normal = -(field_at_hit.topLeftCorner<3,3>() * path);
+                    if(normal.squaredNorm() == 0.0) continue;
+                    keepEarliest(hits, {CCDHit{time, (field_at_hit * point.homogeneous()).head<3>(), normal.normalized()}});
+                }
+            }
+            return hits;
+        }
+
+    }
+
+    std::vector<CCDHit> collideBodies(const PhysicsWorld& world, const CollisionBounds& bounds, uint32_t body_a, uint32_t body_b) {
+        auto is_field = [&](uint32_t body){
+            return world.height_fields[body] || world.signed_distance_fields[body];
+        };
+        if(!world.compound_colliders[body_a] && !world.compound_colliders[body_b] && !is_field(body_a) && !is_field(body_b)){
+            //Triangles of a large static mesh far from the other body can never be hit
+            Mesh patches[2];
+            const Mesh* meshes[2] = {world.colliders[body_a].get(), world.colliders[body_b].get()};
+            const uint32_t bodies[2] = {body_a, body_b};
+            for (int side = 0; side < 2; ++side) {
+                const BoundsHierarchy* triangles = bounds.getStaticTriangles(bodies[side]);
+                if(triangles == nullptr || !cutStaticPatch(*meshes[side], *triangles, bounds.getBounds(bodies[1 - side]), patches[side])) continue;
+                if(patches[side].triangle_indices.empty()) return {};
+                meshes[side] = &patches[side];
+            }
+            return linearCCD(*meshes[0], *meshes[1], world.current_transforms[body_a], world.current_transforms[body_b],
+                             world.future_transforms[body_a], world.future_transforms[body_b]);
+        }
+        if(is_field(body_a) || is_field(body_b)){
+            //Field bodies are never dynamic, so two of them never collide
+            if(is_field(body_a) && is_field(body_b)) return {};
+            const bool flip = !is_field(body_a);
+            const uint32_t field_body = flip ? body_b : body_a;
+            const uint32_t other_body = flip ? body_a : body_b;
+            std::vector<CCDHit> hits = world.height_fields[field_body] ? collideHeightField(world, bounds, field_body, other_body)
+                                                                       : collideSignedDistanceField(world, bounds, field_body, other_body);
+            if(flip){
+                for (auto& hit : hits) hit.normal_a_to_b = -hit.normal_a_to_b;
+            }
+            return hits;
+        }
+        std::vector<MovingPiece> pieces_a;
+        std::vector<MovingPiece> pieces_b;
+        gatherPieces(world, bounds, body_a, bounds.getBounds(body_b), pieces_a);
+        gatherPieces(world, bounds, body_b, bounds.getBounds(body_a), pieces_b);
+
+        std::vector<CCDHit> hits;
+        for (const auto& piece_a : pieces_a) {
+            for (const auto& piece_b : pieces_b) {
+                if(!piece_a.bounds.overlaps(piece_b.bounds)) continue;
+                keepEarliest(hits, linearCCD(*piece_a.mesh, *piece_b.mesh, piece_a.initial, piece_b.initial, piece_a.final, piece_b.final));
+            }
+        }
+        return hits;
+    }
+
+} // EngiGraph
@@ -0,0 +1,28 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <vector>
+#include "CollisionBounds.h"
+#include "LinearPointCcd.h"
+
+namespace EngiGraph {
+
+    /**
+     * Run CCD between two bodies over a step, from their current to their future collider transforms.
+     * @details Bodies with a single mesh are tested with linearCCD() directly. Static meshes are cut down to the triangles whose world bounds,
+     * baked by CollisionBounds, reach the other body over the step. For compound bodies, only children whose bounds over the step
+     * reach the other body are gathered, and only pairs of those whose bounds overlap are tested. As with linearCCD(), the earliest hits are returned.
+     * @details Against a height field, each piece is tested with linearCCD() against a patch of only the cells under its bounds over the step.
+     * @details Against a signed distance field, only the vertices of the other body are tested, each with a few field lookups.
+     * Edges of the other body can still cut into sharp corners of the field between its vertices.
+     * @param world World with up to date transforms.
+     * @param bounds Bounds of every body over the step, from CollisionBounds::update().
+     * @param body_a,body_b Dense indices.
+     * @return Earliest hits, with normals from a to b.
+     */
+    std::vector<CCDHit> collideBodies(const PhysicsWorld& world, const CollisionBounds& bounds, uint32_t body_a, uint32_t body_b);
+
+} // EngiGraph
@@ -0,0 +1,44 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <memory>
+#include "src/Geometry/Aabb.h"
+#include "src/Geometry/BoundsHierarchy.h"
+#include "src/Geometry/Mesh.h"
+
+namespace EngiGraph {
+
+    /**
+     * Collision data built from the collider of a body by CollisionBounds, and kept by the world along with the body.
+     * @details Static bodies also get their world space data baked, which stays valid until their collider or transform changes.
+     * @details Immutable once built, so copies of a world can share it.
+     */
+    struct ColliderBake {
+        /**
+         * Collider the data was built from.
+         */
+        std::shared_ptr<const Mesh> collider{};
+        /**
+         * Bounds of the collider in collider space.
+         */
+        Aabb local_bounds{};
+        /**
+         * True if the world space data below was baked, for a static body at static_transform.
+         */
+        bool is_static = false;
+        Eigen::Matrix4d static_transform = Eigen::Matrix4d::Identity();
+        /**
+         * World bounds of the collider, with the CollisionBounds margin.
+         */
+        Aabb static_bounds{};
+        /**
+         * Hierarchy over the triangles of the collider in world space, with the CollisionBounds margin. Item i is triangle i.
+         * @details Only baked for plain mesh colliders, null for compounds and fields.
+         */
+        std::shared_ptr<const BoundsHierarchy> static_triangles{};
+    };
+
+} // EngiGraph
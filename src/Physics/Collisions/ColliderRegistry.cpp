@@ -0,0 +1,193 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "ColliderRegistry.h"
+#include "src/FileIO/ImageIo.h"
+#include "src/FileIO/ObjLoader.h"
+#include "src/Geometry/MeshConversions.h"
+#include "src/Geometry/MeshUtilities.h"
+#include "src/Profiling/Trace.h"
+
+namespace EngiGraph {
+
+    ColliderRegistry& ColliderRegistry::getShared() {
+        static ColliderRegistry registry;
+        return registry;
+    }
+
+    std::shared_ptr<const Mesh> ColliderRegistry::getBox() {
+        return getOrCook({"builtin:box", {}}, [](){
+            return makeBoxMesh({1.0f, 1.0f, 1.0f});
+        });
+    }
+
+    std::shared_ptr<const Mesh> ColliderRegistry::getTorus(float major_radius, float minor_radius, uint32_t rings, uint32_t sides) {
+        return getOrCook({"builtin:torus", {major_radius, minor_radius, (float)rings, (float)sides}}, [=](){
+            return makeTorusMesh(major_radius, minor_radius, rings, sides);
+        });
+    }
+
+    std::shared_ptr<const Mesh> ColliderRegistry::loadMesh(const std::string& filename, float weld_distance) {
+        return getOrCook({filename, {weld_distance}}, [&](){
+            Mesh combined{};
+            for (const auto& visual_mesh : loadOBJ(filename)) {
+                Mesh shape = stripVisualMesh(visual_mesh, weld_distance);
+                const uint32_t offset = (uint32_t)combined.vertices.size();
+                combined.vertices.insert(combined.vertices.end(), shape.vertices.begin(), shape.vertices.end());
+                for (uint32_t index : shape.triangle_indices) combined.triangle_indices.push_back(index + offset);
+                for (uint32_t index : shape.edge_indices) combined.edge_indices.push_back(index + offset);
+            }
+            return combined;
+        });
+    }
+
+    std::shared_ptr<const CompoundCollider> ColliderRegistry::loadCompound(const std::string& filename, float weld_distance) {
+        const ColliderKey key{filename, {weld_distance}};
+        {
+            std::lock_guard lock(mutex);
+            auto found = compounds.find(key);
+            if(found != compounds.end()){
+                if(auto compound = found->second.lock()) return compound;
+            }
+        }
+        //Children go through getOrCook, which takes the lock itself
+        ENGIGRAPH_TRACE_SCOPE("ColliderRegistry::loadCompound");
+        const std::vector<VisualMesh> shapes = loadOBJ(filename);
+        std::vector<CompoundChild> children;
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            children.push_back({getOrCook({filename + "#" + std::to_string(i), {weld_distance}}, [&](){
+                return stripVisualMesh(shapes[i], weld_distance);
+            })});
+        }
+        auto compound = std::make_shared<const CompoundCollider>(std::move(children));
+        std::lock_guard lock(mutex);
+        //Another thread may have loaded it meanwhile, keep the first so bodies share it
+        if(auto existing = compounds[key].lock()) return existing;
+        compounds[key] = compound;
+        return compound;
+    }
+
+    std::shared_ptr<const HeightField> ColliderRegistry::loadHeightField(const std::string& filename) {
+        const ColliderKey key{filename};
+        {
+            std::lock_guard lock(mutex);
+            auto found = height_fields.find(key);
+            if(found != height_fields.end()){
+                if(auto height_field = found->second.lock()) return height_field;
+            }
+        }
+        ENGIGRAPH_TRACE_SCOPE("ColliderRegistry::loadHeightField");
+        auto height_field = HeightField::fromImage(loadImage(filename));
+        std::lock_guard lock(mutex);
+        //Another thread may have loaded it meanwhile, keep the first so bodies share it
+        if(auto existing = height_fields[key].lock()) return existing;
+        height_fields[key] = height_field;
+        cook_count++;
+        return height_field;
+    }
+
+    std::shared_ptr<const Mesh> ColliderRegistry::getOrCook(const ColliderKey& key, const std::function<Mesh()>& cook) {
+        {
+            std::lock_guard lock(mutex);
+            auto found = colliders.find(key);
+            if(found != colliders.end()){
+                if(auto collider = found->second.lock()) return collider;
+            }
+        }
+        //Cook without the lock, so a slow file load does not block other threads
+        std::shared_ptr<const Mesh> collider;
+        {
+            ENGIGRAPH_TRACE_SCOPE("ColliderRegistry::cook");
+            collider = std::make_shared<const Mesh>(cook());
+        }
+        std::lock_guard lock(mutex);
+        //Another thread may have cooked it meanwhile, keep the first so bodies share it
+        if(auto existing = colliders[key].lock()) return existing;
+        colliders[key] = collider;
+        cook_count++;
+        return collider;
+    }
+
+    MassProperties ColliderRegistry::getMassProperties(const std::shared_ptr<const Mesh>& collider, MassModel model, double density, const Eigen::Vector3d& scale) {
+        const bool uniform = scale.x() == scale.y() && scale.x() == scale.z();
+        if(model == MassModel::SHELL && !uniform){
+            return computeMassProperties(*collider, model, scale).scaled(model, density);
+        }
+        const auto key = std::make_pair(collider.get(), model);
+        //False if never computed, or the address was reused
+        auto is_cached = [&](const CachedMassProperties& cached){
+            return !cached.collider.owner_before(collider) && !collider.owner_before(cached.collider);
+        };
+        {
+            std::lock_guard lock(mutex);
+            auto found = mass_properties.find(key);
+            if(found != mass_properties.end() && is_cached(found->second)) return found->second.properties.scaled(model, density, scale);
+        }
+        //Compute without the lock, since big meshes are reduced in parallel and would block other threads meanwhile
+        const MassProperties properties = computeMassProperties(*collider, model);
+        std::lock_guard lock(mutex);
+        auto& cached = mass_properties[key];
+        if(!is_cached(cached)){
+            //Drop entries of freed colliders while here
+            for (auto it = mass_properties.begin(); it != mass_properties.end();) {
+                it = (it->second.collider.expired() && &it->second != &cached) ? mass_properties.erase(it) : std::next(it);
+            }
+            cached.collider = collider;
+            cached.properties = properties;
+        }
+        return cached.properties.scaled(model, density, scale);
+    }
+
+    std::shared_ptr<const BoundsHierarchy> ColliderRegistry::getTriangleHierarchy(const std::shared_ptr<const Mesh>& collider) {
+        std::lock_guard lock(mutex);
+        auto& cached = triangle_hierarchies[collider.get()];
+        if(cached.collider.owner_before(collider) || collider.owner_before(cached.collider)){
+            for (auto it = triangle_hierarchies.begin(); it != triangle_hierarchies.end();) {
+                it = (it->second.collider.expired() && &it->second != &cached) ? triangle_hierarchies.erase(it) : std::next(it);
+            }
+            std::vector<Aabb> triangle_bounds(collider->triangle_indices.size() / 3);
+            for (size_t triangle = 0; triangle < triangle_bounds.size(); ++triangle) {
+                for (int corner = 0; corner < 3; ++corner) {
+                    triangle_bounds[triangle].extend(collider->vertices[collider->triangle_indices[triangle * 3 + corner]].cast<double>());
+                }
+            }
+            cached.collider = collider;
+            cached.hierarchy = std::make_shared<const BoundsHierarchy>(std::move(triangle_bounds));
+        }
+        return cached.hierarchy;
+    }
+
+    std::shared_ptr<const SignedDistanceField> ColliderRegistry::getSignedDistanceField(const std::shared_ptr<const Mesh>& collider, double cell_size, uint32_t band_cells) {
+        const auto key = std::make_tuple(collider.get(), cell_size, band_cells);
+        auto is_cached = [&](const CachedSignedDistanceField& cached){
+            return cached.field && !cached.collider.owner_before(collider) && !collider.owner_before(cached.collider);
+        };
+        {
+            std::lock_guard lock(mutex);
+            auto found = signed_distance_fields.find(key);
+            if(found != signed_distance_fields.end() && is_cached(found->second)) return found->second.field;
+        }
+        auto field = SignedDistanceField::bake(*collider, cell_size, band_cells);
+        std::lock_guard lock(mutex);
+        auto& cached = signed_distance_fields[key];
+        //Another thread may have baked it meanwhile, keep the first so bodies share it
+        if(is_cached(cached)) return cached.field;
+        for (auto it = signed_distance_fields.begin(); it != signed_distance_fields.end();) {
+            it = (it->second.collider.expired() && &it->second != &cached) ? signed_distance_fields.erase(it) : std::next(it);
+        }
+        cached.collider = collider;
+        cached.field = field;
+        cook_count++;
+        return field;
+    }
+
+    size_t ColliderRegistry::getLiveCount() {
+        std::lock_guard lock(mutex);
+        for (auto it = colliders.begin(); it != colliders.end();) {
+            it = it->second.expired() ? colliders.erase(it) : std::next(it);
+        }
+        return colliders.size();
+    }
+
+} // EngiGraph
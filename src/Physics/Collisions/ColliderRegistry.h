@@ -0,0 +1,192 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include "src/Geometry/BoundsHierarchy.h"
+#include "src/Geometry/MassProperties.h"
+#include "src/Geometry/Mesh.h"
+#include "CompoundCollider.h"
+#include "HeightField.h"
+#include "SignedDistanceField.h"
+
+namespace EngiGraph {
+
+    /**
+     * Identifies a cooked collider: where its geometry came from, and how it was processed.
+     */
+    struct ColliderKey {
+        /**
+         * File name, or the name of a built in shape.
+         */
+        std::string source{};
+        /**
+         * Cooking parameters, like shape sizes and the weld distance. Unused values are zero.
+         */
+        std::array<float, 4> parameters{};
+
+        bool operator<(const ColliderKey& other) const {
+            return std::tie(source, parameters) < std::tie(other.source, other.parameters);
+        }
+    };
+
+    /**
+     * Hands out immutable colliders, cooking each source once and sharing it between every body that uses it.
+     * @details Colliders are reference counted by the bodies holding them, and are freed once the last one is gone.
+     * The registry only keeps weak references, so it never keeps a collider alive by itself.
+     * @details Sizes that are a plain scale of a shape, like box dimensions, should be set as the body scale, not cooked into the collider.
+     * @details Safe to use from several threads.
+     */
+    class ColliderRegistry {
+    public:
+        /**
+         * Get the registry shared by the whole program.
+         */
+        static ColliderRegistry& getShared();
+
+        /**
+         * Get a unit box centered on the origin. Set the box size as the body scale.
+         */
+        std::shared_ptr<const Mesh> getBox();
+
+        /**
+         * Get a torus around the y axis.
+         * @param major_radius Distance from the center to the middle of the tube.
+         * @param minor_radius Radius of the tube.
+         * @param rings Segments around the y axis. At least 3.
+         * @param sides Segments around the tube. At least 3.
+         * @throws RuntimeException Too few segments.
+         */
+        std::shared_ptr<const Mesh> getTorus(float major_radius, float minor_radius, uint32_t rings = 16, uint32_t sides = 8);
+
+        /**
+         * Get the collider of an OBJ file, with all of its shapes combined into one.
+         * @param filename OBJ file.
+         * @param weld_distance Vertices closer than this are merged.
+         * @throws RuntimeException Problem loading the file.
+         */
+        std::shared_ptr<const Mesh> loadMesh(const std::string& filename, float weld_distance = 0.001f);
+
+        /**
+         * Get a compound collider of an OBJ file, with one child per shape.
+         * @details Children are cooked and shared like other colliders, so the same file loaded as a compound twice shares everything.
+         * @param filename OBJ file.
+         * @param weld_distance Vertices of a shape closer than this are merged.
+         * @throws RuntimeException Problem loading the file, or the file has no shapes.
+         */
+        std::shared_ptr<const CompoundCollider> loadCompound(const std::string& filename, float weld_distance = 0.001f);
+
+        /**
+         * Get the height field of an image, from its red channel.
+         * @details Samples are spaced 1 apart, and a red value of 255 is at height 1. Set the spacing and height range as the body scale.
+         * @param filename Image file.
+         * @throws RuntimeException Problem loading the image, or it is smaller than 2 by 2 pixels.
+         */
+        std::shared_ptr<const HeightField> loadHeightField(const std::string& filename);
+
+        /**
+         * Get a collider, cooking it if no body holds one with the same key.
+         * @param key Source and cooking parameters. Must fully determine the result of cook.
+         * @details Cooking runs without the registry lock. If two threads cook the same key at once, both get the collider stored first.
+         * @param cook Builds the collider.
+         * @throws Anything cook throws. Nothing is stored then.
+         */
+        std::shared_ptr<const Mesh> getOrCook(const ColliderKey& key, const std::function<Mesh()>& cook);
+
+        /**
+         * Get the mass properties of a collider, computing them once per collider and model and scaling the cached result.
+         * @details Works for any collider, not only ones from this registry. Shells with non-uniform scale can not be scaled
+         * from the cached result, and are computed from the mesh every time. Computing happens outside the lock, so other threads can keep
+         * using the registry meanwhile.
+         * @param collider Collider.
+         * @param model Solid or shell.
+         * @param density Mass per unit volume for solids, or per unit area for shells.
+         * @param scale Body scale.
+         * @return Properties.
+         */
+        MassProperties getMassProperties(const std::shared_ptr<const Mesh>& collider, MassModel model, double density = 1.0, const Eigen::Vector3d& scale = {1,1,1});
+
+        /**
+         * Get a hierarchy over the triangles of a collider in collider space, building it once per collider.
+         * @details Works for any collider, not only ones from this registry. Item i of the hierarchy is triangle i.
+         * @param collider Collider.
+         * @return Hierarchy, shared with every other caller for the same collider.
+         */
+        std::shared_ptr<const BoundsHierarchy> getTriangleHierarchy(const std::shared_ptr<const Mesh>& collider);
+
+        /**
+         * Get the signed distance field of a collider in collider space, baking it once per collider and resolution.
+         * @details Works for any closed collider, not only ones from this registry. Baking happens outside the lock, so other threads can keep
+         * using the registry meanwhile.
+         * @param collider Collider.
+         * @param cell_size Distance between samples, in collider space.
+         * @param band_cells Half width of the band, in cells.
+         * @throws RuntimeException Same as SignedDistanceField::bake().
+         * @return Field, shared with every other caller for the same collider and resolution.
+         */
+        std::shared_ptr<const SignedDistanceField> getSignedDistanceField(const std::shared_ptr<const Mesh>& collider, double cell_size, uint32_t band_cells = 3);
+
+        /**
+         * Get the number of colliders still held by someone.
+         */
+        [[nodiscard]] size_t getLiveCount();
+
+        /**
+         * Get the number of times a collider was cooked and stored.
+         * @details Cooks that lose a race with another thread for the same key are not counted.
+         */
+        [[nodiscard]] uint64_t getCookCount() const {
+            return cook_count.load();
+        }
+
+    private:
+        struct CachedMassProperties {
+            /**
+             * Detects a new collider at the address of a freed one.
+             */
+            std::weak_ptr<const Mesh> collider{};
+            MassProperties properties{};
+        };
+
+        std::mutex mutex;
+        std::map<ColliderKey, std::weak_ptr<const Mesh>> colliders{};
+        std::map<ColliderKey, std::weak_ptr<const CompoundCollider>> compounds{};
+        std::map<ColliderKey, std::weak_ptr<const HeightField>> height_fields{};
+        /**
+         * Unit density properties, by collider address and model.
+         */
+        std::map<std::pair<const Mesh*, MassModel>, CachedMassProperties> mass_properties{};
+        struct CachedTriangleHierarchy {
+            /**
+             * Detects a new collider at the address of a freed one.
+             */
+            std::weak_ptr<const Mesh> collider{};
+            std::shared_ptr<const BoundsHierarchy> hierarchy{};
+        };
+
+        std::map<const Mesh*, CachedTriangleHierarchy> triangle_hierarchies{};
+        struct CachedSignedDistanceField {
+            /**
+             * Detects a new collider at the address of a freed one.
+             */
+            std::weak_ptr<const Mesh> collider{};
+            std::shared_ptr<const SignedDistanceField> field{};
+        };
+
+        /**
+         * By collider address, cell size and band.
+         */
+        std::map<std::tuple<const Mesh*, double, uint32_t>, CachedSignedDistanceField> signed_distance_fields{};
+        std::atomic<uint64_t> cook_count = 0;
+    };
+
+} // EngiGraph
@@ -0,0 +1,64 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "CollisionBounds.h"
+#include "src/Profiling/Trace.h"
+
+namespace EngiGraph {
+
+    void CollisionBounds::update(PhysicsWorld& world) {
+        ENGIGRAPH_TRACE_SCOPE("CollisionBounds::update");
+        const uint32_t body_count = world.getBodyCount();
+        bounds.resize(body_count);
+        static_triangles.assign(body_count, nullptr);
+        const Eigen::Vector3d margin = Eigen::Vector3d::Constant(MARGIN);
+        for (uint32_t j = 0; j < body_count; ++j) {
+            auto& bake = world.collider_bakes[j];
+            if(!bake || bake->collider != world.colliders[j]){
+                auto local_bake = std::make_shared<ColliderBake>();
+                local_bake->collider = world.colliders[j];
+                local_bake->local_bounds = computeBounds(*local_bake->collider);
+                bake = std::move(local_bake);
+            }
+
+            if(world.hasFlag(j, BODY_FLAG_STATIC)){
+                const Eigen::Matrix4d& transform = world.current_transforms[j];
+                if(!bake->is_static || bake->static_transform != transform){
+                    auto static_bake = std::make_shared<ColliderBake>();
+                    static_bake->collider = bake->collider;
+                    static_bake->local_bounds = bake->local_bounds;
+                    static_bake->is_static = true;
+                    static_bake->static_transform = transform;
+                    static_bake->static_bounds = bake->local_bounds.transformed(transform);
+                    static_bake->static_bounds.minimum -= margin;
+                    static_bake->static_bounds.maximum += margin;
+                    //Fields and compounds are collided by their own structures, not the triangles of their collider
+                    if(!world.compound_colliders[j] && !world.height_fields[j] && !world.signed_distance_fields[j]){
+                        const Mesh& mesh = *bake->collider;
+                        std::vector<Aabb> triangle_bounds(mesh.triangle_indices.size() / 3);
+                        for (size_t triangle = 0; triangle < triangle_bounds.size(); ++triangle) {
+                            for (int corner = 0; corner < 3; ++corner) {
+                                const Eigen::Vector3d vertex = mesh.vertices[mesh.triangle_indices[triangle * 3 + corner]].cast<double>();
+                                triangle_bounds[triangle].extend((transform * vertex.homogeneous()).head<3>());
+                            }
+                            triangle_bounds[triangle].minimum -= margin;
+                            triangle_bounds[triangle].maximum += margin;
+                        }
+                        static_bake->static_triangles = std::make_shared<const BoundsHierarchy>(std::move(triangle_bounds));
+                    }
+                    bake = std::move(static_bake);
+                    static_bake_count++;
+                }
+                bounds[j] = bake->static_bounds;
+                static_triangles[j] = bake->static_triangles.get();
+                continue;
+            }
+            Aabb swept = sweptBounds(bake->local_bounds, world.current_transforms[j], world.future_transforms[j]);
+            swept.minimum -= margin;
+            swept.maximum += margin;
+            bounds[j] = swept;
+        }
+    }
+
+} // EngiGraph
@@ -0,0 +1,73 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <vector>
+#include "src/Geometry/Aabb.h"
+#include "src/Physics/World/PhysicsWorld.h"
+
+namespace EngiGraph {
+
+    /**
+     * World space bounds of every body over a step, to skip CCD for pairs that can not touch.
+     * @details Each body is bounded over its whole motion, from its current to its future collider transform. CCD moves vertices
+     * in straight lines between those, so pairs with separate bounds can never hit, and skipping them does not change the result.
+     * @details Local collider bounds are kept per body in PhysicsWorld::collider_bakes. Static bodies also keep their world bounds, and a
+     * hierarchy over their triangles in world space for collideBodies(), which are only rebuilt when their collider or transform changes.
+     * A world of static geometry is baked once.
+     */
+    class CollisionBounds {
+    public:
+        /**
+         * Extra space around every box, so rounding can not separate bodies that CCD finds touching.
+         */
+        static constexpr double MARGIN = 1e-6;
+
+        /**
+         * Bound every body over the step described by the current and future transforms of a world.
+         * @param world World, whose collider bakes are built where missing or out of date.
+         */
+        void update(PhysicsWorld& world);
+
+        /**
+         * Check if two bodies may touch during the step.
+         * @param body_a,body_b Dense indices.
+         */
+        [[nodiscard]] bool overlaps(uint32_t body_a, uint32_t body_b) const {
+            return bounds[body_a].overlaps(bounds[body_b]);
+        }
+
+        /**
+         * Get the bounds of a body over the step.
+         */
+        [[nodiscard]] const Aabb& getBounds(uint32_t index) const {
+            return bounds[index];
+        }
+
+        /**
+         * Get the world space hierarchy over the triangles of a static body.
+         * @return Hierarchy, or null for other bodies. Valid until the next update().
+         */
+        [[nodiscard]] const BoundsHierarchy* getStaticTriangles(uint32_t index) const {
+            return static_triangles[index];
+        }
+
+        /**
+         * Get the number of times the world data of a static body was built.
+         */
+        [[nodiscard]] uint64_t getStaticBakeCount() const {
+            return static_bake_count;
+        }
+
+    private:
+        /**
+         * Indexed by dense index.
+         */
+        std::vector<Aabb> bounds{};
+        std::vector<const BoundsHierarchy*> static_triangles{};
+        uint64_t static_bake_count = 0;
+    };
+
+} // EngiGraph
@@ -0,0 +1,38 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "CompoundCollider.h"
+#include "src/Exceptions/RuntimeException.h"
+
+namespace EngiGraph {
+
+    CompoundCollider::CompoundCollider(std::vector<CompoundChild> children) : children(std::move(children)) {
+        if(this->children.empty()) throw RuntimeException("Compound collider needs at least one child.");
+        Mesh merged{};
+        std::vector<Aabb> child_bounds{};
+        for (const auto& child : this->children) {
+            if(!child.mesh) throw RuntimeException("Compound collider child has no mesh.");
+            child_bounds.push_back(computeBounds(*child.mesh).transformed(child.local_transform));
+            const uint32_t offset = (uint32_t)merged.vertices.size();
+            for (const auto& vertex : child.mesh->vertices) {
+                merged.vertices.push_back((child.local_transform * vertex.cast<double>().homogeneous()).head<3>().cast<float>());
+            }
+            for (uint32_t index : child.mesh->triangle_indices) merged.triangle_indices.push_back(index + offset);
+            for (uint32_t index : child.mesh->edge_indices) merged.edge_indices.push_back(index + offset);
+        }
+        merged_mesh = std::make_shared<const Mesh>(std::move(merged));
+
+        hierarchy = BoundsHierarchy(std::move(child_bounds));
+    }
+
+    void CompoundCollider::queryChildren(const Eigen::Matrix4d& initial, const Eigen::Matrix4d& final, const Aabb& bounds, std::vector<uint32_t>& found) const {
+        hierarchy.traverse([&](const Aabb& node_bounds){
+            return sweptBounds(node_bounds, initial, final).overlaps(bounds);
+        }, [&](uint32_t child){
+            found.push_back(child);
+            return true;
+        });
+    }
+
+} // EngiGraph
@@ -0,0 +1,80 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "src/Geometry/BoundsHierarchy.h"
+#include "src/Geometry/Mesh.h"
+
+namespace EngiGraph {
+
+    /**
+     * A piece of a compound collider.
+     */
+    struct CompoundChild {
+        /**
+         * Geometry of the piece. Primitives like the registry box can be shared between children and sized by the local transform.
+         */
+        std::shared_ptr<const Mesh> mesh{};
+        /**
+         * Transform from the piece to the collider, may include scale.
+         */
+        Eigen::Matrix4d local_transform = Eigen::Matrix4d::Identity();
+    };
+
+    /**
+     * Collider made of several meshes, so a body with separate parts does not need one large concave mesh.
+     * @details Children are kept in a small bounding box hierarchy in collider space. During a step, a node is bounded over the
+     * motion of the body by its box at the current and future transforms, so only children that can reach the other body are tested.
+     * @details Immutable once built, so it can be shared between bodies like a Mesh.
+     */
+    class CompoundCollider {
+    public:
+        /**
+         * Build a compound collider.
+         * @param children Pieces of the collider.
+         * @throws RuntimeException No children, or a child without a mesh.
+         */
+        explicit CompoundCollider(std::vector<CompoundChild> children);
+
+        [[nodiscard]] const std::vector<CompoundChild>& getChildren() const {
+            return children;
+        }
+
+        [[nodiscard]] size_t getChildCount() const {
+            return children.size();
+        }
+
+        /**
+         * Get the bounds of a child in collider space.
+         */
+        [[nodiscard]] const Aabb& getChildBounds(uint32_t child) const {
+            return hierarchy.getItemBounds(child);
+        }
+
+        /**
+         * Get all children combined into one mesh in collider space.
+         * @details Bodies hold this as their collider, for bounds, mass properties and drawing. Collisions use the children.
+         */
+        [[nodiscard]] const std::shared_ptr<const Mesh>& getMergedMesh() const {
+            return merged_mesh;
+        }
+
+        /**
+         * Find the children that may touch a box while the collider moves over a step.
+         * @param initial,final Collider transforms at the start and end of the step.
+         * @param bounds World space box.
+         * @param found Indices of the children are appended to this.
+         */
+        void queryChildren(const Eigen::Matrix4d& initial, const Eigen::Matrix4d& final, const Aabb& bounds, std::vector<uint32_t>& found) const;
+
+    private:
+        std::vector<CompoundChild> children{};
+        std::shared_ptr<const Mesh> merged_mesh{};
+        BoundsHierarchy hierarchy{};
+    };
+
+} // EngiGraph
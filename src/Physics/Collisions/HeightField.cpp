@@ -0,0 +1,109 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "HeightField.h"
+#include <algorithm>
+#include <cmath>
+#include "src/Exceptions/RuntimeException.h"
+
+namespace EngiGraph {
+
+    HeightField::HeightField(uint32_t columns, uint32_t rows, std::vector<float> heights, const Eigen::Vector2d& spacing) :
+            columns(columns), rows(rows), heights(std::move(heights)), spacing(spacing) {
+        if(columns < 2 || rows < 2) throw RuntimeException("Height field needs at least 2 samples along each axis.");
+        if(this->heights.size() != (size_t)columns * rows) throw RuntimeException("Height field has the wrong number of heights.");
+        if(!(spacing.x() > 0.0 && spacing.y() > 0.0)) throw RuntimeException("Height field spacing must be positive.");
+        origin = -0.5 * Eigen::Vector2d{spacing.x() * (columns - 1), spacing.y() * (rows - 1)};
+
+        float minimum_height = this->heights[0];
+        float maximum_height = this->heights[0];
+        for (float height : this->heights) {
+            minimum_height = std::min(minimum_height, height);
+            maximum_height = std::max(maximum_height, height);
+        }
+        bounds.extend(Eigen::Vector3d{origin.x(), minimum_height, origin.y()});
+        bounds.extend(Eigen::Vector3d{-origin.x(), maximum_height, -origin.y()});
+        Mesh corners{};
+        for (int corner = 0; corner < 8; ++corner) {
+            const Eigen::Vector3d position = {corner & 1 ? bounds.maximum.x() : bounds.minimum.x(), corner & 2 ? bounds.maximum.y() : bounds.minimum.y(),
+                                              corner & 4 ? bounds.maximum.z() : bounds.minimum.z()};
+            corners.vertices.push_back(position.cast<float>());
+        }
+        bounds_mesh = std::make_shared<const Mesh>(std::move(corners));
+    }
+
+    std::shared_ptr<const HeightField> HeightField::fromImage(const Image<uint32_t>& image, double max_height, const Eigen::Vector2d& spacing) {
+        const uint32_t columns = image.getWidth();
+        const uint32_t rows = image.getHeight();
+        //Image data is in rows of x values, pixels are RGBA bytes with red first
+        std::vector<float> heights(image.getData().size());
+        for (size_t i = 0; i < heights.size(); ++i) {
+            heights[i] = (float)((image.getData()[i] & 0xFF) / 255.0 * max_height);
+        }
+        return std::make_shared<const HeightField>(columns, rows, std::move(heights), spacing);
+    }
+
+    double HeightField::sampleHeight(double x, double z) const {
+        const double grid_x = std::clamp((x - origin.x()) / spacing.x(), 0.0, (double)(columns - 1));
+        const double grid_z = std::clamp((z - origin.y()) / spacing.y(), 0.0, (double)(rows - 1));
+        const uint32_t column = std::min((uint32_t)grid_x, columns - 2);
+        const uint32_t row = std::min((uint32_t)grid_z, rows - 2);
+        const double u = grid_x - column;
+        const double v = grid_z - row;
+        const float* cell = &heights[row * columns + column];
+        const double h00 = cell[0];
+        const double h10 = cell[1];
+        const double h01 = cell[columns];
+        const double h11 = cell[columns + 1];
+        //Cells are split along the diagonal from (1,0) to (0,1)
+        if(u + v <= 1.0) return h00 + u * (h10 - h00) + v * (h01 - h00);
+        return h11 + (1.0 - u) * (h01 - h11) + (1.0 - v) * (h10 - h11);
+    }
+
+    bool HeightField::findCells(const Aabb& local_bounds, CellRange& cells) const {
+        if(!local_bounds.overlaps(bounds)) return false;
+        auto cell_of = [](double coordinate, double start, double step, uint32_t samples){
+            return (uint32_t)std::clamp(std::floor((coordinate - start) / step), 0.0, (double)(samples - 2));
+        };
+        cells.first_column = cell_of(local_bounds.minimum.x(), origin.x(), spacing.x(), columns);
+        cells.last_column = cell_of(local_bounds.maximum.x(), origin.x(), spacing.x(), columns);
+        cells.first_row = cell_of(local_bounds.minimum.z(), origin.y(), spacing.y(), rows);
+        cells.last_row = cell_of(local_bounds.maximum.z(), origin.y(), spacing.y(), rows);
+        return true;
+    }
+
+    Mesh HeightField::buildPatch(const CellRange& cells) const {
+        const uint32_t patch_columns = cells.last_column - cells.first_column + 2;
+        const uint32_t patch_rows = cells.last_row - cells.first_row + 2;
+        Mesh patch{};
+        patch.vertices.reserve((size_t)patch_columns * patch_rows);
+        for (uint32_t row = 0; row < patch_rows; ++row) {
+            for (uint32_t column = 0; column < patch_columns; ++column) {
+                patch.vertices.push_back(getSamplePosition(cells.first_column + column, cells.first_row + row).cast<float>());
+            }
+        }
+        const size_t cell_count = (size_t)(patch_columns - 1) * (patch_rows - 1);
+        patch.triangle_indices.reserve(cell_count * 6);
+        patch.edge_indices.reserve(cell_count * 6 + (patch_columns + patch_rows) * 2);
+        for (uint32_t row = 0; row < patch_rows; ++row) {
+            for (uint32_t column = 0; column < patch_columns; ++column) {
+                const uint32_t v00 = row * patch_columns + column;
+                const uint32_t v10 = v00 + 1;
+                const uint32_t v01 = v00 + patch_columns;
+                const bool has_x = column + 1 < patch_columns;
+                const bool has_z = row + 1 < patch_rows;
+                if(has_x) patch.edge_indices.insert(patch.edge_indices.end(), {v00, v10});
+                if(has_z) patch.edge_indices.insert(patch.edge_indices.end(), {v00, v01});
+                if(has_x && has_z){
+                    const uint32_t v11 = v01 + 1;
+                    //Wound so normals face up
+                    patch.triangle_indices.insert(patch.triangle_indices.end(), {v00, v01, v10, v10, v01, v11});
+                    patch.edge_indices.insert(patch.edge_indices.end(), {v10, v01});
+                }
+            }
+        }
+        return patch;
+    }
+
+} // EngiGraph
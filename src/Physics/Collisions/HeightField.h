@@ -0,0 +1,138 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "src/Geometry/Aabb.h"
+#include "src/Geometry/Mesh.h"
+#include "src/Image/Image.h"
+
+namespace EngiGraph {
+
+    /**
+     * Terrain collider made of heights sampled on a regular grid in the local xz plane.
+     * @details Only one float is stored per sample, instead of the vertex, triangle and edge indices of the same grid as a Mesh.
+     * Since the grid is regular, the cells under any box are found directly from its coordinates, and collisions only triangulate those.
+     * @details The grid is centered on the origin in x and z, with y up. Each cell is split into two triangles along the same diagonal.
+     * @details Immutable once built, so it can be shared between bodies like a Mesh.
+     */
+    class HeightField {
+    public:
+        /**
+         * Inclusive range of cells.
+         */
+        struct CellRange {
+            uint32_t first_column = 0;
+            uint32_t first_row = 0;
+            uint32_t last_column = 0;
+            uint32_t last_row = 0;
+        };
+
+        /**
+         * Build a height field.
+         * @param columns,rows Number of samples along x and z. At least 2 each.
+         * @param heights Sample heights, row by row. The sample at a column and row is heights[row * columns + column].
+         * @param spacing Distance between samples along x and z.
+         * @throws RuntimeException Too few samples, wrong number of heights, or spacing not positive.
+         */
+        HeightField(uint32_t columns, uint32_t rows, std::vector<float> heights, const Eigen::Vector2d& spacing = {1,1});
+
+        /**
+         * Build a height field from the red channel of an image, like one from loadImage().
+         * @param image Pixel x is the column and pixel y the row.
+         * @param max_height Height of a red value of 255. A red value of 0 is at height 0.
+         * @param spacing Distance between samples along x and z.
+         * @throws RuntimeException Image smaller than 2 by 2 pixels, or spacing not positive.
+         */
+        static std::shared_ptr<const HeightField> fromImage(const Image<uint32_t>& image, double max_height = 1.0, const Eigen::Vector2d& spacing = {1,1});
+
+        [[nodiscard]] uint32_t getColumns() const {
+            return columns;
+        }
+
+        [[nodiscard]] uint32_t getRows() const {
+            return rows;
+        }
+
+        [[nodiscard]] const Eigen::Vector2d& getSpacing() const {
+            return spacing;
+        }
+
+        [[nodiscard]] const std::vector<float>& getHeights() const {
+            return heights;
+        }
+
+        /**
+         * Get the local position of a sample.
+         */
+        [[nodiscard]] Eigen::Vector3d getSamplePosition(uint32_t column, uint32_t row) const {
+            return {origin.x() + column * spacing.x(), heights[row * columns + column], origin.y() + row * spacing.y()};
+        }
+
+        /**
+         * Get the height of the surface above a local point, following the triangles of its cell.
+         * @details Points outside the grid use the closest edge.
+         */
+        [[nodiscard]] double sampleHeight(double x, double z) const;
+
+        /**
+         * Get the local bounds of the whole surface.
+         */
+        [[nodiscard]] const Aabb& getBounds() const {
+            return bounds;
+        }
+
+        /**
+         * Get a mesh with only the corners of the bounds, and no triangles.
+         * @details Bodies hold this as their collider, so bounds work as for any other body.
+         */
+        [[nodiscard]] const std::shared_ptr<const Mesh>& getBoundsMesh() const {
+            return bounds_mesh;
+        }
+
+        /**
+         * Find the cells under a box, in constant time.
+         * @param local_bounds Box in the space of the height field.
+         * @param cells Set to the cells whose xz footprint overlaps the box.
+         * @return False if the box is beside, above or below the whole surface.
+         */
+        [[nodiscard]] bool findCells(const Aabb& local_bounds, CellRange& cells) const;
+
+        /**
+         * Triangulate some cells into a mesh, with the unique edges of its triangles.
+         * @param cells Cells to include.
+         * @return Local space mesh.
+         */
+        [[nodiscard]] Mesh buildPatch(const CellRange& cells) const;
+
+        /**
+         * Triangulate the whole surface.
+         */
+        [[nodiscard]] Mesh triangulate() const {
+            return buildPatch({0, 0, columns - 2, rows - 2});
+        }
+
+        /**
+         * Get the number of bytes the samples take.
+         */
+        [[nodiscard]] size_t getMemoryUsage() const {
+            return heights.size() * sizeof(float);
+        }
+
+    private:
+        uint32_t columns;
+        uint32_t rows;
+        std::vector<float> heights;
+        Eigen::Vector2d spacing;
+        /**
+         * Local x and z of the first sample.
+         */
+        Eigen::Vector2d origin;
+        Aabb bounds{};
+        std::shared_ptr<const Mesh> bounds_mesh{};
+    };
+
+} // EngiGraph
@@ -6,6 +6,7 @@
 #include <vector>
 #include <iostream>
 #include <optional>
+#include "src/Profiling/Trace.h"
 
 namespace EngiGraph {
 
@@ -350,6 +351,7 @@ namespace EngiGraph {
 
    std::vector<CCDHit> linearCCD(const Mesh &a, const Mesh &b, const Eigen::Matrix4d &a_initial, const Eigen::Matrix4d &b_initial,
               const Eigen::Matrix4d &a_final, const Eigen::Matrix4d &b_final) {
+       ENGIGRAPH_TRACE_SCOPE("linearCCD");
         //todo determine time delta and normal rollback from amount of movement
        const double time_delta = 0.00001;
        //todo determine this from mesh size and detail
@@ -26,6 +26,33 @@ namespace EngiGraph {
         Eigen::Vector3d normal_a_to_b;
     };
 
+    /**
+     * Calculate the dimensions where the ray direction is maximal, for rayTriangleIntersection().
+     */
+    Eigen::Matrix<uint8_t,3,1> calculateRayDimensions(const Eigen::Vector3d& direction);
+
+    /**
+     * Calculate ray shear constraints, for rayTriangleIntersection().
+     */
+    Eigen::Vector3d calculateRayShearConstraints(const Eigen::Matrix<uint8_t,3,1>& k, const Eigen::Vector3d& direction);
+
+    /**
+     * Watertight ray triangle intersection, without backface culling.
+     * @param hit_info Output barycentric coordinates in xyz, hit distance in w.
+     * @param k,s From calculateRayDimensions() and calculateRayShearConstraints() for the ray direction.
+     * @return True if intersection occurs.
+     */
+    bool rayTriangleIntersection(const Eigen::Vector3d& a, const Eigen::Vector3d& b, const Eigen::Vector3d& c, const Eigen::Vector3d& origin, Eigen::Vector4d& hit_info,
+                                 const Eigen::Matrix<uint8_t,3,1>& k, const Eigen::Vector3d& s);
+
+    /**
+     * Intersect a ray with a planar or non-planar bi-linear quad patch, without backface culling.
+     * @param hit_info Output (u,v,distance) if hit occurs.
+     * @return True if hit occurred within max_distance.
+     */
+    bool rayQuadPatchIntersection(Eigen::Vector3d q00, const Eigen::Vector3d& q01, Eigen::Vector3d q10, const Eigen::Vector3d& q11, const Eigen::Vector3d& origin, const Eigen::Vector3d& direction, Eigen::Vector3d& hit_info,
+                                  const double& max_distance);
+
     /**
      * Perform linear continuous collision detection on two meshes.
      * @param a,b Local Geometry of both objects.
@@ -0,0 +1,41 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "NarrowPhase.h"
+#include "src/Profiling/Trace.h"
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+
+namespace EngiGraph {
+
+    std::vector<std::vector<CCDHit>> NarrowPhase::collide(const PhysicsWorld& world, const CollisionBounds& bounds, const std::vector<BodyPair>& pairs) {
+        ENGIGRAPH_TRACE_SCOPE("NarrowPhase::collide");
+        std::vector<std::vector<CCDHit>> hits(pairs.size());
+        const uint32_t pair_count = (uint32_t)pairs.size();
+        const uint32_t chunk_count = (pair_count + PAIRS_PER_TASK - 1) / PAIRS_PER_TASK;
+        auto collide_chunk = [&](uint32_t chunk){
+            const uint32_t last = std::min(pair_count, (chunk + 1) * PAIRS_PER_TASK);
+            for (uint32_t pair = chunk * PAIRS_PER_TASK; pair < last; ++pair) {
+                hits[pair] = collideBodies(world, bounds, pairs[pair].body_a, pairs[pair].body_b);
+            }
+        };
+        if(parallel && chunk_count > 1){
+            if(!executor){
+                executor = std::make_shared<tf::Executor>();
+            }
+            tf::Taskflow taskflow;
+            taskflow.for_each_index(0u, chunk_count, 1u, [&](uint32_t chunk){
+                ENGIGRAPH_TRACE_SCOPE("NarrowPhase chunk");
+                collide_chunk(chunk);
+            });
+            executor->run(taskflow).wait();
+        }else{
+            for (uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+                collide_chunk(chunk);
+            }
+        }
+        return hits;
+    }
+
+} // EngiGraph
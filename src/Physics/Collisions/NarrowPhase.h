@@ -0,0 +1,68 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <taskflow/taskflow.hpp>
+#include "BodyCollision.h"
+
+namespace EngiGraph {
+
+    /**
+     * Two bodies to run CCD between, by dense index.
+     */
+    struct BodyPair {
+        uint32_t body_a = 0;
+        uint32_t body_b = 0;
+
+        bool operator==(const BodyPair& other) const {
+            return body_a == other.body_a && body_b == other.body_b;
+        }
+    };
+
+    /**
+     * Runs collideBodies() on many pairs at once, spread over threads.
+     * @details Pairs are split into fixed chunks of PAIRS_PER_TASK, no matter how many threads there are, and each pair writes only its own
+     * result slot. Results come back in the order the pairs were given, so callers that combine them in that order get the same result
+     * bit for bit with any thread count, or without threads at all.
+     */
+    class NarrowPhase {
+    public:
+        /**
+         * Pairs collided by one task. Small, since a single pair against a large mesh can take much longer than most.
+         */
+        static constexpr uint32_t PAIRS_PER_TASK = 8;
+
+        /**
+         * Run pairs on multiple threads.
+         */
+        bool parallel = true;
+
+        /**
+         * Collide pairs over the step described by the current and future transforms of a world.
+         * @param world World with up to date transforms.
+         * @param bounds Bounds of every body over the step, from CollisionBounds::update().
+         * @param pairs Pairs to collide.
+         * @return Earliest hits of each pair, at the index of the pair.
+         */
+        std::vector<std::vector<CCDHit>> collide(const PhysicsWorld& world, const CollisionBounds& bounds, const std::vector<BodyPair>& pairs);
+
+        /**
+         * Share threads with something else, like a ContactSolver, instead of creating them on the first parallel call.
+         * @param new_executor Executor to run on.
+         */
+        void setExecutor(std::shared_ptr<tf::Executor> new_executor) {
+            executor = std::move(new_executor);
+        }
+
+    private:
+        /**
+         * Created on the first parallel call, unless set.
+         */
+        std::shared_ptr<tf::Executor> executor{};
+    };
+
+} // EngiGraph
@@ -0,0 +1,320 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "SignedDistanceField.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include "src/Exceptions/RuntimeException.h"
+#include "src/Geometry/BoundsHierarchy.h"
+#include "src/Profiling/Trace.h"
+
+namespace EngiGraph {
+
+    namespace {
+
+        /**
+         * Exact signed distance to the triangles of a mesh.
+         * @details The sign comes from the angle weighted pseudo normal of the closest face, edge or vertex, which is outward exactly when
+         * the point is outside a closed mesh.
+         */
+        class MeshDistance {
+        public:
+            explicit MeshDistance(const Mesh& mesh) : mesh(mesh) {
+                const size_t triangle_count = mesh.triangle_indices.size() / 3;
+                std::vector<Aabb> triangle_bounds(triangle_count);
+                face_normals.resize(triangle_count);
+                edge_normals.resize(triangle_count * 3, Eigen::Vector3d::Zero());
+                vertex_normals.assign(mesh.vertices.size(), Eigen::Vector3d::Zero());
+                std::map<std::pair<uint32_t, uint32_t>, Eigen::Vector3d> edge_sums;
+                for (size_t triangle = 0; triangle < triangle_count; ++triangle) {
+                    const uint32_t* indices = &mesh.triangle_indices[triangle * 3];
+                    Eigen::Vector3d corners[3];
+                    for (int corner = 0; corner < 3; ++corner) {
+                        corners[corner] = mesh.vertices[indices[corner]].cast<double>();
+                        triangle_bounds[triangle].extend(corners[corner]);
+                    }
+                    const Eigen::Vector3d normal = (corners[1] - corners[0]).cross(corners[2] - corners[0]).normalized();
+                    face_normals[triangle] = normal.allFinite() ? normal : Eigen::Vector3d::Zero();
+                    for (int corner = 0; corner < 3; ++corner) {
+                        //Each face adds its normal to a vertex, weighted by its angle there
+                        const Eigen::Vector3d to_next = (corners[(corner + 1) % 3] - corners[corner]).normalized();
+                        const Eigen::Vector3d to_previous = (corners[(corner + 2) % 3] - corners[corner]).normalized();
+                        const double angle = std::acos(std::clamp(to_next.dot(to_previous), -1.0, 1.0));
+                        if(std::isfinite(angle)) vertex_normals[indices[corner]] += angle * face_normals[triangle];
+                        const uint32_t start = indices[corner];
+                        const uint32_t end = indices[(corner + 1) % 3];
+                        auto& sum = edge_sums.try_emplace({std::min(start, end), std::max(start, end)}, Eigen::Vector3d::Zero()).first->second;
+                        sum += face_normals[triangle];
+                    }
+                }
+                for (size_t triangle = 0; triangle < triangle_count; ++triangle) {
+                    for (int corner = 0; corner < 3; ++corner) {
+                        const uint32_t start = mesh.triangle_indices[triangle * 3 + corner];
+                        const uint32_t end = mesh.triangle_indices[triangle * 3 + (corner + 1) % 3];
+                        edge_normals[triangle * 3 + corner] = edge_sums.at({std::min(start, end), std::max(start, end)});
+                    }
+                }
+                hierarchy = BoundsHierarchy(std::move(triangle_bounds));
+            }
+
+            /**
+             * Get the signed distance of a point.
+             * @param upper_bound Known upper bound of the unsigned distance, to skip far triangles sooner. The result does not depend on it.
+             */
+            [[nodiscard]] double getSignedDistance(const Eigen::Vector3d& point, double upper_bound = std::numeric_limits<double>::infinity()) const {
+                //Slightly larger, so the closest triangle always passes the strict comparison below
+                double best_squared = upper_bound * upper_bound * (1.0 + 1e-9) + 1e-30;
+                Eigen::Vector3d best_point = point;
+                Eigen::Vector3d best_normal = Eigen::Vector3d::Zero();
+                auto box_test = [&](const Aabb& box){
+                    return (box.minimum - point).cwiseMax(point - box.maximum).cwiseMax(0.0).squaredNorm() <= best_squared;
+                };
+                hierarchy.traverse(box_test, [&](uint32_t triangle){
+                    Eigen::Vector3d normal;
+                    const Eigen::Vector3d closest = closestPoint(triangle, point, normal);
+                    const double squared = (closest - point).squaredNorm();
+                    if(squared < best_squared){
+                        best_squared = squared;
+                        best_point = closest;
+                        best_normal = normal;
+                    }
+                    return true;
+                });
+                const double distance = (point - best_point).norm();
+                return (point - best_point).dot(best_normal) < 0.0 ? -distance : distance;
+            }
+
+        private:
+            const Mesh& mesh;
+            BoundsHierarchy hierarchy{};
+            std::vector<Eigen::Vector3d> face_normals{};
+            /**
+             * Three per triangle, for the edges starting at each of its corners.
+             */
+            std::vector<Eigen::Vector3d> edge_normals{};
+            std::vector<Eigen::Vector3d> vertex_normals{};
+
+            /**
+             * Find the closest point of a triangle, and the pseudo normal of the feature it lies on.
+             * @details From Real-Time Collision Detection, by Christer Ericson, section 5.1.5.
+             */
+            Eigen::Vector3d closestPoint(uint32_t triangle, const Eigen::Vector3d& point, Eigen::Vector3d& normal) const {
+                const uint32_t* indices = &mesh.triangle_indices[triangle * 3];
+                const Eigen::Vector3d a = mesh.vertices[indices[0]].cast<double>();
+                const Eigen::Vector3d b = mesh.vertices[indices[1]].cast<double>();
+                const Eigen::Vector3d c = mesh.vertices[indices[2]].cast<double>();
+                const Eigen::Vector3d ab = b - a;
+                const Eigen::Vector3d ac = c - a;
+                const Eigen::Vector3d ap = point - a;
+                const double d1 = ab.dot(ap);
+                const double d2 = ac.dot(ap);
+                if(d1 <= 0.0 && d2 <= 0.0){
+                    normal = vertex_normals[indices[0]];
+                    return a;
+                }
+                const Eigen::Vector3d bp = point - b;
+                const double d3 = ab.dot(bp);
+                const double d4 = ac.dot(bp);
+                if(d3 >= 0.0 && d4 <= d3){
+                    normal = vertex_normals[indices[1]];
+                    return b;
+                }
+                const double vc = d1 * d4 - d3 * d2;
+                if(vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0){
+                    normal = edge_normals[triangle * 3 + 0];
+                    return a + d1 / (d1 - d3) * ab;
+                }
+                const Eigen::Vector3d cp = point - c;
+                const double d5 = ab.dot(cp);
+                const double d6 = ac.dot(cp);
+                if(d6 >= 0.0 && d5 <= d6){
+                    normal = vertex_normals[indices[2]];
+                    return c;
+                }
+                const double vb = d5 * d2 - d1 * d6;
+                if(vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0){
+                    normal = edge_normals[triangle * 3 + 2];
+                    return a + d2 / (d2 - d6) * ac;
+                }
+                const double va = d3 * d6 - d5 * d4;
+                if(va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0){
+                    normal = edge_normals[triangle * 3 + 1];
+                    return b + (d4 - d3) / ((d4 - d3) + (d5 - d6)) * (c - b);
+                }
+                const double denominator = 1.0 / (va + vb + vc);
+                normal = face_normals[triangle];
+                return a + ab * (vb * denominator) + ac * (vc * denominator);
+            }
+        };
+
+        tf::Executor& getExecutor() {
+            static tf::Executor executor;
+            return executor;
+        }
+
+        void forEachIndex(bool parallel, uint32_t count, const std::function<void(uint32_t)>& function) {
+            if(parallel && count > 1){
+                tf::Taskflow taskflow;
+                taskflow.for_each_index(0u, count, 1u, function);
+                getExecutor().run(taskflow).wait();
+            }else{
+                for (uint32_t i = 0; i < count; ++i) {
+                    function(i);
+                }
+            }
+        }
+
+    }
+
+    SignedDistanceField::SignedDistanceField(const Eigen::Vector3d& origin, double cell_size, double band, const Eigen::Vector3i& brick_counts,
+                                             std::vector<int32_t> bricks, std::vector<float> samples) :
+            origin(origin), cell_size(cell_size), band(band), brick_counts(brick_counts), bricks(std::move(bricks)), samples(std::move(samples)) {
+        if(!(cell_size > 0.0) || !(band > 0.0)) throw RuntimeException("Signed distance field cell size and band must be positive.");
+        if((brick_counts.array() < 1).any() || this->bricks.size() != (size_t)brick_counts.prod() || this->samples.size() % SAMPLES_PER_BRICK != 0){
+            throw RuntimeException("Signed distance field sizes do not match.");
+        }
+        const auto stored = (int64_t)getStoredBrickCount();
+        for (int32_t brick : this->bricks) {
+            if(brick >= stored || (brick < 0 && brick != BRICK_OUTSIDE && brick != BRICK_INSIDE)){
+                throw RuntimeException("Signed distance field brick refers to missing samples.");
+            }
+        }
+        bounds.extend(origin);
+        bounds.extend(origin + brick_counts.cast<double>() * (BRICK_CELLS * cell_size));
+    }
+
+    std::shared_ptr<const SignedDistanceField> SignedDistanceField::bake(const Mesh& mesh, double cell_size, uint32_t band_cells, bool parallel) {
+        ENGIGRAPH_TRACE_SCOPE("SignedDistanceField::bake");
+        if(mesh.triangle_indices.size() < 3) throw RuntimeException("Signed distance field needs a mesh with triangles.");
+        if(!(cell_size > 0.0) || band_cells == 0) throw RuntimeException("Signed distance field cell size and band must be positive.");
+        const MeshDistance mesh_distance(mesh);
+        const double band = band_cells * cell_size;
+
+        //A cell more than the band around the mesh, so samples on the edge of the grid are always clamped
+        const Aabb mesh_bounds = computeBounds(mesh);
+        const Eigen::Vector3d origin = mesh_bounds.minimum - Eigen::Vector3d::Constant(band + cell_size);
+        const Eigen::Vector3d size = mesh_bounds.maximum - mesh_bounds.minimum + Eigen::Vector3d::Constant(2.0 * (band + cell_size));
+        const Eigen::Vector3i brick_counts = (size / (BRICK_CELLS * cell_size)).array().ceil().cast<int>().max(1);
+        const double brick_size = BRICK_CELLS * cell_size;
+        auto sample_position = [&](const Eigen::Vector3i& brick, uint32_t x, uint32_t y, uint32_t z){
+            return (origin + brick.cast<double>() * brick_size + Eigen::Vector3d{(double)x, (double)y, (double)z} * cell_size).eval();
+        };
+        auto brick_of = [&](uint32_t brick){
+            return Eigen::Vector3i{(int)(brick % brick_counts.x()), (int)(brick / brick_counts.x() % brick_counts.y()), (int)(brick / brick_counts.x() / brick_counts.y())};
+        };
+
+        //Bricks whose center is further from the surface than the band and half the brick diagonal have no samples in the band
+        const auto brick_count = (uint32_t)brick_counts.prod();
+        std::vector<int32_t> bricks(brick_count);
+        const double brick_radius = 0.5 * std::sqrt(3.0) * brick_size;
+        forEachIndex(parallel, brick_count, [&](uint32_t brick){
+            const double distance = mesh_distance.getSignedDistance(origin + (brick_of(brick).cast<double>() + Eigen::Vector3d::Constant(0.5)) * brick_size);
+            if(distance > band + brick_radius) bricks[brick] = BRICK_OUTSIDE;
+            else if(distance < -(band + brick_radius)) bricks[brick] = BRICK_INSIDE;
+            else bricks[brick] = 0;
+        });
+        std::vector<uint32_t> stored_bricks;
+        for (uint32_t brick = 0; brick < brick_count; ++brick) {
+            if(bricks[brick] < 0) continue;
+            bricks[brick] = (int32_t)stored_bricks.size();
+            stored_bricks.push_back(brick);
+        }
+
+        std::vector<float> samples(stored_bricks.size() * SAMPLES_PER_BRICK);
+        forEachIndex(parallel, (uint32_t)stored_bricks.size(), [&](uint32_t stored){
+            const Eigen::Vector3i brick = brick_of(stored_bricks[stored]);
+            float* brick_samples = &samples[(size_t)stored * SAMPLES_PER_BRICK];
+            //Neighbouring samples differ by at most their distance, which bounds the search for the next one
+            Eigen::Vector3d previous_position = sample_position(brick, 0, 0, 0);
+            double previous_distance = std::numeric_limits<double>::infinity();
+            for (uint32_t z = 0; z < BRICK_SAMPLES; ++z) {
+                for (uint32_t y = 0; y < BRICK_SAMPLES; ++y) {
+                    for (uint32_t x = 0; x < BRICK_SAMPLES; ++x) {
+                        const Eigen::Vector3d position = sample_position(brick, x, y, z);
+                        const double distance = mesh_distance.getSignedDistance(position, std::abs(previous_distance) + (position - previous_position).norm());
+                        brick_samples[(z * BRICK_SAMPLES + y) * BRICK_SAMPLES + x] = (float)std::clamp(distance, -band, band);
+                        previous_position = position;
+                        previous_distance = distance;
+                    }
+                }
+            }
+        });
+
+        //Bricks clamped to the band everywhere look up the same without their samples
+        size_t kept = 0;
+        for (size_t stored = 0; stored < stored_bricks.size(); ++stored) {
+            const auto first = samples.begin() + (ptrdiff_t)(stored * SAMPLES_PER_BRICK);
+            const auto last = first + SAMPLES_PER_BRICK;
+            const float clamped = *first;
+            if(std::abs(clamped) == (float)band && std::all_of(first, last, [&](float sample){ return sample == clamped; })){
+                bricks[stored_bricks[stored]] = clamped > 0.0f ? BRICK_OUTSIDE : BRICK_INSIDE;
+                continue;
+            }
+            if(kept != stored) std::copy(first, last, samples.begin() + (ptrdiff_t)(kept * SAMPLES_PER_BRICK));
+            bricks[stored_bricks[stored]] = (int32_t)kept++;
+        }
+        samples.resize(kept * SAMPLES_PER_BRICK);
+        samples.shrink_to_fit();
+        return std::make_shared<const SignedDistanceField>(origin, cell_size, band, brick_counts, std::move(bricks), std::move(samples));
+    }
+
+    double SignedDistanceField::getDistance(const Eigen::Vector3d& point) const {
+        const Eigen::Vector3d clamped = point.cwiseMax(bounds.minimum).cwiseMin(bounds.maximum);
+        //Outside the grid, the surface is at least the band further than the grid
+        return interpolate(clamped, nullptr) + (point - clamped).norm();
+    }
+
+    double SignedDistanceField::getDistance(const Eigen::Vector3d& point, Eigen::Vector3d& gradient) const {
+        const Eigen::Vector3d clamped = point.cwiseMax(bounds.minimum).cwiseMin(bounds.maximum);
+        const Eigen::Vector3d outside = point - clamped;
+        const double outside_distance = outside.norm();
+        if(outside_distance == 0.0) return interpolate(point, &gradient);
+        gradient = outside / outside_distance;
+        return interpolate(clamped, nullptr) + outside_distance;
+    }
+
+    double SignedDistanceField::interpolate(const Eigen::Vector3d& point, Eigen::Vector3d* gradient) const {
+        const Eigen::Vector3d grid = (point - origin) / cell_size;
+        int cell[3];
+        double fraction[3];
+        for (int axis = 0; axis < 3; ++axis) {
+            const int cells = brick_counts[axis] * (int)BRICK_CELLS;
+            const double coordinate = std::clamp(grid[axis], 0.0, (double)cells);
+            cell[axis] = std::min((int)coordinate, cells - 1);
+            fraction[axis] = coordinate - cell[axis];
+        }
+        const int32_t brick = bricks[((size_t)(cell[2] / BRICK_CELLS) * brick_counts.y() + cell[1] / BRICK_CELLS) * brick_counts.x() + cell[0] / BRICK_CELLS];
+        if(brick < 0){
+            if(gradient) gradient->setZero();
+            return brick == BRICK_INSIDE ? -band : band;
+        }
+        const float* corner = &samples[(size_t)brick * SAMPLES_PER_BRICK +
+                                       ((cell[2] % BRICK_CELLS) * BRICK_SAMPLES + cell[1] % BRICK_CELLS) * BRICK_SAMPLES + cell[0] % BRICK_CELLS];
+        constexpr uint32_t y_step = BRICK_SAMPLES;
+        constexpr uint32_t z_step = BRICK_SAMPLES * BRICK_SAMPLES;
+        const double c000 = corner[0], c100 = corner[1];
+        const double c010 = corner[y_step], c110 = corner[y_step + 1];
+        const double c001 = corner[z_step], c101 = corner[z_step + 1];
+        const double c011 = corner[z_step + y_step], c111 = corner[z_step + y_step + 1];
+        const double u = fraction[0], v = fraction[1], w = fraction[2];
+        const double c00 = c000 + u * (c100 - c000);
+        const double c10 = c010 + u * (c110 - c010);
+        const double c01 = c001 + u * (c101 - c001);
+        const double c11 = c011 + u * (c111 - c011);
+        const double c0 = c00 + v * (c10 - c00);
+        const double c1 = c01 + v * (c11 - c01);
+        if(gradient){
+            const double dx0 = (c100 - c000) + v * ((c110 - c010) - (c100 - c000));
+            const double dx1 = (c101 - c001) + v * ((c111 - c011) - (c101 - c001));
+            *gradient = Eigen::Vector3d{dx0 + w * (dx1 - dx0), (c10 - c00) + w * ((c11 - c01) - (c10 - c00)), c1 - c0} / cell_size;
+        }
+        return c0 + w * (c1 - c0);
+    }
+
+} // EngiGraph
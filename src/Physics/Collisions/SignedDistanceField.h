@@ -0,0 +1,139 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <memory>
+#include <vector>
+#include "src/Geometry/Aabb.h"
+#include "src/Geometry/Mesh.h"
+
+namespace EngiGraph {
+
+    /**
+     * Signed distance to the surface of a closed mesh, sampled on a narrow band grid. Negative inside.
+     * @details The grid is split into bricks of 8 by 8 by 8 cells. Only bricks near the surface store samples, every other brick only
+     * stores whether it is inside or outside. Distances are clamped to the band, so far from the surface they are plus or minus the band.
+     * @details Each stored brick keeps 9 samples along each axis, sharing its faces with its neighbours, so a lookup always reads one brick.
+     * @details Lookups interpolate the 8 samples around a point, so they take constant time no matter how many triangles the mesh has.
+     * Immutable once built, so it can be shared between bodies like a Mesh.
+     */
+    class SignedDistanceField {
+    public:
+        /**
+         * Cells along each axis of a brick.
+         */
+        static constexpr uint32_t BRICK_CELLS = 8;
+        /**
+         * Samples along each axis of a brick.
+         */
+        static constexpr uint32_t BRICK_SAMPLES = BRICK_CELLS + 1;
+        static constexpr uint32_t SAMPLES_PER_BRICK = BRICK_SAMPLES * BRICK_SAMPLES * BRICK_SAMPLES;
+        /**
+         * Brick entries for bricks without samples, which are entirely outside or inside the band.
+         */
+        static constexpr int32_t BRICK_OUTSIDE = -1;
+        static constexpr int32_t BRICK_INSIDE = -2;
+
+        /**
+         * Build a field from its samples, like ones saved from another field.
+         * @param origin Local position of the first sample.
+         * @param cell_size Distance between samples.
+         * @param band Largest distance stored. Distances further from the surface are clamped to it.
+         * @param brick_counts Bricks along each axis.
+         * @param bricks For each brick, x fastest, the index of its first sample divided by SAMPLES_PER_BRICK, or BRICK_OUTSIDE or BRICK_INSIDE.
+         * @param samples Samples of the stored bricks, x fastest within a brick.
+         * @throws RuntimeException Sizes do not match, cell size or band not positive, or a brick refers to missing samples.
+         */
+        SignedDistanceField(const Eigen::Vector3d& origin, double cell_size, double band, const Eigen::Vector3i& brick_counts,
+                            std::vector<int32_t> bricks, std::vector<float> samples);
+
+        /**
+         * Bake the field of a mesh.
+         * @details Exact distances come from a hierarchy over the triangles, and the sign from the angle weighted normal of the closest feature,
+         * so the mesh should be closed, with its triangles facing out.
+         * @details Bricks are baked in parallel, but each sample is computed on its own, so the result does not depend on the thread count.
+         * @param mesh Local space mesh.
+         * @param cell_size Distance between samples.
+         * @param band_cells Half width of the band, in cells. At least 1.
+         * @param parallel Allow baking on several threads.
+         * @throws RuntimeException Mesh has no triangles, cell size not positive, or band_cells is zero.
+         */
+        static std::shared_ptr<const SignedDistanceField> bake(const Mesh& mesh, double cell_size, uint32_t band_cells = 3, bool parallel = true);
+
+        /**
+         * Get the signed distance at a local point.
+         * @details Points outside the grid add their distance to the grid, so the result never overestimates how close the surface is.
+         */
+        [[nodiscard]] double getDistance(const Eigen::Vector3d& point) const;
+
+        /**
+         * Get the signed distance at a local point, and its gradient.
+         * @param gradient Set to the gradient of the interpolated distance, which points away from the surface. Not normalized,
+         * and zero where the distance is clamped to the band.
+         */
+        [[nodiscard]] double getDistance(const Eigen::Vector3d& point, Eigen::Vector3d& gradient) const;
+
+        [[nodiscard]] const Eigen::Vector3d& getOrigin() const {
+            return origin;
+        }
+
+        [[nodiscard]] double getCellSize() const {
+            return cell_size;
+        }
+
+        [[nodiscard]] double getBand() const {
+            return band;
+        }
+
+        [[nodiscard]] const Eigen::Vector3i& getBrickCounts() const {
+            return brick_counts;
+        }
+
+        [[nodiscard]] const std::vector<int32_t>& getBricks() const {
+            return bricks;
+        }
+
+        [[nodiscard]] const std::vector<float>& getSamples() const {
+            return samples;
+        }
+
+        /**
+         * Get the number of bricks that store samples.
+         */
+        [[nodiscard]] size_t getStoredBrickCount() const {
+            return samples.size() / SAMPLES_PER_BRICK;
+        }
+
+        /**
+         * Get the local bounds of the grid.
+         */
+        [[nodiscard]] const Aabb& getBounds() const {
+            return bounds;
+        }
+
+        /**
+         * Get the number of bytes the bricks and samples take.
+         */
+        [[nodiscard]] size_t getMemoryUsage() const {
+            return bricks.size() * sizeof(int32_t) + samples.size() * sizeof(float);
+        }
+
+    private:
+        Eigen::Vector3d origin;
+        double cell_size;
+        double band;
+        Eigen::Vector3i brick_counts;
+        std::vector<int32_t> bricks;
+        std::vector<float> samples;
+        Aabb bounds{};
+
+        /**
+         * Look up a point inside the grid.
+         */
+        [[nodiscard]] double interpolate(const Eigen::Vector3d& point, Eigen::Vector3d* gradient) const;
+    };
+
+} // EngiGraph
@@ -0,0 +1,44 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <cstdint>
+
+namespace EngiGraph {
+
+    /**
+     * A single contact point between two bodies, and the impulses the contact solver applied at it.
+     */
+    struct Contact {
+        /**
+         * Dense indices of the bodies.
+         */
+        uint32_t body_a, body_b;
+        /**
+         * World space contact point. For speculative contacts, the point halfway between the two bodies.
+         */
+        Eigen::Vector3d point;
+        /**
+         * World space contact normal, facing b.
+         */
+        Eigen::Vector3d normal_a_to_b;
+        /**
+         * Accumulated impulse along the normal, applied to b and opposite to a. Never negative.
+         */
+        double normal_impulse = 0.0;
+        /**
+         * Accumulated world space friction impulse, applied to b and opposite to a.
+         */
+        Eigen::Vector3d friction_impulse = {0,0,0};
+        /**
+         * Gap between the bodies along the normal, zero for touching bodies and negative for overlapping ones.
+         * @details A positive gap makes a speculative contact, which lets the bodies approach by up to the gap during the step, but no further.
+         * A negative gap is pushed apart over a few steps, see ContactSolverSettings::position_correction.
+         */
+        double separation = 0.0;
+    };
+
+} // EngiGraph
@@ -0,0 +1,51 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "ContactColoring.h"
+#include <unordered_map>
+
+namespace EngiGraph {
+
+    std::vector<ContactPair> groupContactPairs(const std::vector<Contact>& contacts) {
+        std::vector<ContactPair> pairs{};
+        std::unordered_map<uint64_t, uint32_t> pair_indices{};
+        for (uint32_t j = 0; j < contacts.size(); ++j) {
+            const Contact& contact = contacts[j];
+            auto [pair, added] = pair_indices.try_emplace(((uint64_t)contact.body_a << 32) | contact.body_b, (uint32_t)pairs.size());
+            if(added) pairs.push_back({contact.body_a, contact.body_b});
+            pairs[pair->second].contacts.push_back(j);
+        }
+        return pairs;
+    }
+
+    std::vector<std::vector<uint32_t>> colorContactPairs(const std::vector<ContactPair>& pairs, const std::vector<uint8_t>& dynamic) {
+        std::vector<std::vector<uint32_t>> colors{};
+        //One bit per body for each color, set if a pair of that color already uses the body
+        std::vector<std::vector<uint64_t>> used_bodies{};
+        const size_t word_count = (dynamic.size() + 63) / 64;
+        auto is_used = [&](uint32_t color, uint32_t body){
+            return dynamic[body] && ((used_bodies[color][body / 64] >> (body % 64)) & 1);
+        };
+        auto mark_used = [&](uint32_t color, uint32_t body){
+            if(dynamic[body]) used_bodies[color][body / 64] |= 1ull << (body % 64);
+        };
+
+        for (uint32_t j = 0; j < pairs.size(); ++j) {
+            const ContactPair& pair = pairs[j];
+            uint32_t color = 0;
+            while (color < colors.size() && (is_used(color, pair.body_a) || is_used(color, pair.body_b))) {
+                color++;
+            }
+            if(color == colors.size()){
+                colors.emplace_back();
+                used_bodies.emplace_back(word_count, 0);
+            }
+            colors[color].push_back(j);
+            mark_used(color, pair.body_a);
+            mark_used(color, pair.body_b);
+        }
+        return colors;
+    }
+
+} // EngiGraph
@@ -0,0 +1,46 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Contact.h"
+
+namespace EngiGraph {
+
+    /**
+     * Contacts between the same two bodies, like the points of one contact manifold.
+     */
+    struct ContactPair {
+        /**
+         * Dense indices of the bodies, in the order the contacts have them.
+         */
+        uint32_t body_a, body_b;
+        /**
+         * Indices of the contacts, in contact order.
+         */
+        std::vector<uint32_t> contacts{};
+    };
+
+    /**
+     * Group contacts by the bodies they are between.
+     * @details Pairs are ordered by their first contact, so the result is deterministic.
+     * @param contacts Contacts to group.
+     * @return Pairs.
+     */
+    std::vector<ContactPair> groupContactPairs(const std::vector<Contact>& contacts);
+
+    /**
+     * Split contact pairs into colors, where no two pairs of a color share a dynamic body.
+     * @details Pairs of one color can be solved at the same time, since they never change the same body.
+     * Immovable bodies are shared freely, since the solver never changes them.
+     * @details Greedy coloring in pair order, so the result is deterministic.
+     * @param pairs Pairs to color.
+     * @param dynamic Non-zero for each dense body index the solver can move.
+     * @return Pair indices of each color.
+     */
+    std::vector<std::vector<uint32_t>> colorContactPairs(const std::vector<ContactPair>& pairs, const std::vector<uint8_t>& dynamic);
+
+} // EngiGraph
@@ -0,0 +1,178 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "ContactManifold.h"
+#include <algorithm>
+
+namespace EngiGraph {
+
+    static Eigen::Vector3d toWorld(const PhysicsWorld& world, uint32_t body, const Eigen::Vector3d& local_point) {
+        return world.getRotation(body) * local_point + world.getPosition(body);
+    }
+
+    static Eigen::Vector3d toLocal(const PhysicsWorld& world, uint32_t body, const Eigen::Vector3d& point) {
+        return world.getRotation(body).conjugate() * (point - world.getPosition(body));
+    }
+
+    /**
+     * Move a point on a body at a time during the step back to where that spot of the body is at the start of the step.
+     * @details Interpolates the transforms the same way CCD does.
+     */
+    static Eigen::Vector3d toStepStart(const PhysicsWorld& world, uint32_t body, const Eigen::Vector3d& point, double time) {
+        if(time <= 0.0) return point;
+        const Eigen::Matrix4d at_hit = (1.0 - time) * world.current_transforms[body] + time * world.future_transforms[body];
+        return (world.current_transforms[body] * (at_hit.inverse() * point.homogeneous())).head<3>();
+    }
+
+    void reduceManifoldPoints(std::vector<ManifoldPoint>& points) {
+        if(points.size() <= ContactManifolds::MAX_POINTS) return;
+
+        //An extreme point is always on the hull
+        Eigen::Vector3d center = Eigen::Vector3d::Zero();
+        for (const auto& point : points) center += point.local_point_a;
+        center /= (double)points.size();
+        auto find_best = [&](auto&& score){
+            size_t best = 0;
+            double best_score = -1.0;
+            for (size_t j = 0; j < points.size(); ++j) {
+                double point_score = score(points[j].local_point_a);
+                if(point_score > best_score){
+                    best_score = point_score;
+                    best = j;
+                }
+            }
+            return best;
+        };
+        const size_t first = find_best([&](const Eigen::Vector3d& point){ return (point - center).squaredNorm(); });
+        const Eigen::Vector3d a = points[first].local_point_a;
+        const size_t second = find_best([&](const Eigen::Vector3d& point){ return (point - a).squaredNorm(); });
+        const Eigen::Vector3d b = points[second].local_point_a;
+        const size_t third = find_best([&](const Eigen::Vector3d& point){ return (b - a).cross(point - a).squaredNorm(); });
+        const Eigen::Vector3d c = points[third].local_point_a;
+
+        //The fourth point adds the most area outside the triangle
+        const Eigen::Vector3d triangle_normal = (b - a).cross(c - a);
+        const size_t fourth = find_best([&](const Eigen::Vector3d& point){
+            double added_area = 0.0;
+            const Eigen::Vector3d* corners[3] = {&a, &b, &c};
+            for (int edge = 0; edge < 3; ++edge) {
+                const Eigen::Vector3d& start = *corners[edge];
+                const Eigen::Vector3d& end = *corners[(edge + 1) % 3];
+                added_area = std::max(added_area, -(end - start).cross(point - start).dot(triangle_normal));
+            }
+            return added_area;
+        });
+
+        std::vector<ManifoldPoint> reduced{points[first], points[second], points[third]};
+        if(fourth != first && fourth != second && fourth != third) reduced.push_back(points[fourth]);
+        points = std::move(reduced);
+    }
+
+    void ContactManifolds::refresh(const PhysicsWorld& world) {
+        const double break_distance_squared = break_distance * break_distance;
+        for (auto manifold = manifolds.begin(); manifold != manifolds.end();) {
+            if(!world.isValid(manifold->second.body_a) || !world.isValid(manifold->second.body_b)){
+                manifold = manifolds.erase(manifold);
+                continue;
+            }
+            const uint32_t body_a = world.getIndex(manifold->second.body_a);
+            const uint32_t body_b = world.getIndex(manifold->second.body_b);
+            auto& points = manifold->second.points;
+            points.erase(std::remove_if(points.begin(), points.end(), [&](const ManifoldPoint& point){
+                const Eigen::Vector3d normal = world.getRotation(body_a) * point.local_normal_a;
+                const Eigen::Vector3d drift = toWorld(world, body_b, point.local_point_b) - toWorld(world, body_a, point.local_point_a);
+                const double separation = drift.dot(normal);
+                return separation > break_distance || (drift - separation * normal).squaredNorm() > break_distance_squared;
+            }), points.end());
+            manifold = points.empty() ? manifolds.erase(manifold) : std::next(manifold);
+        }
+    }
+
+    void ContactManifolds::addHits(const PhysicsWorld& world, uint32_t body_a, uint32_t body_b, const std::vector<CCDHit>& hits) {
+        //Order the pair by slot, so it maps to the same manifold no matter the order of the dense indices
+        const bool flip = world.getHandle(body_a).slot > world.getHandle(body_b).slot;
+        if(flip) std::swap(body_a, body_b);
+        const BodyHandle handle_a = world.getHandle(body_a);
+        const BodyHandle handle_b = world.getHandle(body_b);
+        ContactManifold& manifold = manifolds[getPairKey(handle_a, handle_b)];
+        manifold.body_a = handle_a;
+        manifold.body_b = handle_b;
+
+        const double match_distance_squared = match_distance * match_distance;
+        const Eigen::Vector3d center_offset = world.getPosition(body_b) - world.getPosition(body_a);
+        for (const auto& hit : hits) {
+            Eigen::Vector3d normal = flip ? -hit.normal_a_to_b : hit.normal_a_to_b;
+            //CCD faces the normal against the motion, which turns it around for touching bodies moving apart
+            if(normal.dot(center_offset) < 0.0) normal = -normal;
+            ManifoldPoint new_point{toLocal(world, body_a, toStepStart(world, body_a, hit.global_point, hit.time)),
+                                    toLocal(world, body_b, toStepStart(world, body_b, hit.global_point, hit.time)),
+                                    world.getRotation(body_a).conjugate() * normal};
+            ManifoldPoint* closest = nullptr;
+            double closest_distance = match_distance_squared;
+            for (auto& point : manifold.points) {
+                double distance = (point.local_point_a - new_point.local_point_a).squaredNorm();
+                if(distance <= closest_distance){
+                    closest_distance = distance;
+                    closest = &point;
+                }
+            }
+            if(closest){
+                //Same contact as last step, keep its impulses
+                new_point.normal_impulse = closest->normal_impulse;
+                new_point.friction_impulse = closest->friction_impulse;
+                *closest = new_point;
+            }else{
+                manifold.points.push_back(new_point);
+            }
+        }
+        reduceManifoldPoints(manifold.points);
+    }
+
+    bool ContactManifolds::isFrozen(const PhysicsWorld& world, uint32_t body_a, uint32_t body_b) {
+        auto is_frozen = [&](uint32_t body){
+            return world.hasFlag(body, BODY_FLAG_SLEEPING) || world.states.inverse_mass[body] == 0.0;
+        };
+        return is_frozen(body_a) && is_frozen(body_b);
+    }
+
+    std::vector<Contact> ContactManifolds::getContacts(const PhysicsWorld& world) const {
+        std::vector<Contact> contacts{};
+        for (const auto& [key, manifold] : manifolds) {
+            const uint32_t body_a = world.getIndex(manifold.body_a);
+            const uint32_t body_b = world.getIndex(manifold.body_b);
+            if(isFrozen(world, body_a, body_b)) continue;
+            for (const auto& point : manifold.points) {
+                const Eigen::Vector3d world_a = toWorld(world, body_a, point.local_point_a);
+                const Eigen::Vector3d world_b = toWorld(world, body_b, point.local_point_b);
+                const Eigen::Vector3d normal = world.getRotation(body_a) * point.local_normal_a;
+                contacts.push_back({body_a, body_b, 0.5 * (world_a + world_b), normal, point.normal_impulse, point.friction_impulse, (world_b - world_a).dot(normal)});
+            }
+        }
+        return contacts;
+    }
+
+    void ContactManifolds::linkIslands(const PhysicsWorld& world, IslandGraph& islands) const {
+        for (const auto& [key, manifold] : manifolds) {
+            const uint32_t body_a = world.getIndex(manifold.body_a);
+            const uint32_t body_b = world.getIndex(manifold.body_b);
+            if(world.states.inverse_mass[body_a] == 0.0 || world.states.inverse_mass[body_b] == 0.0) continue;
+            islands.link(body_a, body_b);
+        }
+    }
+
+    void ContactManifolds::storeImpulses(const PhysicsWorld& world, const std::vector<Contact>& contacts) {
+        //Contacts come out of getContacts() in manifold order
+        size_t contact = 0;
+        for (auto& [key, manifold] : manifolds) {
+            if(isFrozen(world, world.getIndex(manifold.body_a), world.getIndex(manifold.body_b))) continue;
+            for (auto& point : manifold.points) {
+                if(contact >= contacts.size()) return;
+                point.normal_impulse = contacts[contact].normal_impulse;
+                point.friction_impulse = contacts[contact].friction_impulse;
+                contact++;
+            }
+        }
+    }
+
+} // EngiGraph
@@ -0,0 +1,153 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <map>
+#include <vector>
+#include "Contact.h"
+#include "src/Physics/Collisions/LinearPointCcd.h"
+#include "src/Physics/World/PhysicsWorld.h"
+
+namespace EngiGraph {
+
+    /**
+     * A contact point that persists across steps.
+     */
+    struct ManifoldPoint {
+        /**
+         * The contact point in the local space of each body.
+         * @details Both are the same world point at the time of impact, so at the start of the step they are apart by the gap still to close,
+         * and drift apart as the bodies move.
+         */
+        Eigen::Vector3d local_point_a, local_point_b;
+        /**
+         * Contact normal facing b, in the local space of body a, so it turns with a.
+         */
+        Eigen::Vector3d local_normal_a;
+        /**
+         * Accumulated impulses, used to warm start the contact solver.
+         */
+        double normal_impulse = 0.0;
+        Eigen::Vector3d friction_impulse = {0,0,0};
+    };
+
+    /**
+     * Up to 4 persistent contact points between a pair of bodies.
+     */
+    struct ContactManifold {
+        /**
+         * Bodies of the pair.
+         */
+        BodyHandle body_a, body_b;
+        std::vector<ManifoldPoint> points{};
+    };
+
+    /**
+     * Reduce contact points to the 4 that span the largest area.
+     * @details Keeps an extreme point, the point furthest from it, the point making the largest triangle with both,
+     * and the point adding the most area outside that triangle.
+     * @param points Points to reduce. Left untouched if there are 4 or fewer.
+     */
+    void reduceManifoldPoints(std::vector<ManifoldPoint>& points);
+
+    /**
+     * Persistent contact manifolds of all touching pairs.
+     * @details New CCD hits are matched to existing points of the same pair, which keeps the accumulated impulses of the point.
+     * Each pair keeps at most 4 points, so the contact solver does bounded work per pair no matter how many hits CCD reports.
+     * @details Manifolds are ordered by handle, so the contacts come out in a stable order.
+     */
+    class ContactManifolds {
+    public:
+        static constexpr uint32_t MAX_POINTS = 4;
+
+        /**
+         * Hits closer than this to an existing point, in body a's local space, replace that point.
+         */
+        double match_distance = 0.05;
+
+        /**
+         * Points whose bodies separated along the normal, or slid sideways, by more than this are dropped.
+         */
+        double break_distance = 0.02;
+
+        /**
+         * Drop points that drifted apart, and manifolds of destroyed bodies. Call at the start of a step, after bodies moved.
+         * @param world World the bodies are in.
+         */
+        void refresh(const PhysicsWorld& world);
+
+        /**
+         * Add the CCD hits of a pair to its manifold, and reduce it to 4 points.
+         * @details Hit points are mapped into each body where it is at the time of impact, using the current and future transforms of the world.
+         * @param world World the bodies are in.
+         * @param body_a,body_b Dense indices of the pair, in the order CCD was run.
+         * @param hits Hits of the pair.
+         */
+        void addHits(const PhysicsWorld& world, uint32_t body_a, uint32_t body_b, const std::vector<CCDHit>& hits);
+
+        /**
+         * Get the contacts of all manifolds, carrying the stored impulses.
+         * @details The separation of each contact is the gap between its two points along the normal, negative where the bodies overlap.
+         * @details Pairs where neither body can move are skipped.
+         * @param world World the bodies are in.
+         * @return Contacts, in manifold order.
+         */
+        [[nodiscard]] std::vector<Contact> getContacts(const PhysicsWorld& world) const;
+
+        /**
+         * Store the solved impulses back into the manifolds.
+         * @param world World the bodies are in.
+         * @param contacts Contacts from getContacts(), after solving.
+         */
+        void storeImpulses(const PhysicsWorld& world, const std::vector<Contact>& contacts);
+
+        /**
+         * Put the bodies of each touching pair into the same island, so resting piles sleep and wake together.
+         * @details Immovable bodies do not join islands, otherwise everything resting on the ground would be one island.
+         * @param world World the bodies are in.
+         * @param islands Islands indexed by dense index.
+         */
+        void linkIslands(const PhysicsWorld& world, IslandGraph& islands) const;
+
+        /**
+         * Forget all contacts.
+         */
+        void clear() {
+            manifolds.clear();
+        }
+
+        /**
+         * Get the number of touching pairs.
+         */
+        [[nodiscard]] size_t getManifoldCount() const {
+            return manifolds.size();
+        }
+
+        /**
+         * Get the manifold of a pair, or nullptr if the pair is not touching.
+         */
+        [[nodiscard]] const ContactManifold* find(BodyHandle body_a, BodyHandle body_b) const {
+            auto manifold = manifolds.find(getPairKey(body_a, body_b));
+            return manifold == manifolds.end() ? nullptr : &manifold->second;
+        }
+
+    private:
+        /**
+         * Keyed by the handle slots of both bodies.
+         */
+        std::map<uint64_t, ContactManifold> manifolds{};
+
+        [[nodiscard]] static uint64_t getPairKey(BodyHandle a, BodyHandle b) {
+            return ((uint64_t)a.slot << 32) | b.slot;
+        }
+
+        /**
+         * Check if neither body of a pair can be moved by the contact solver.
+         */
+        [[nodiscard]] static bool isFrozen(const PhysicsWorld& world, uint32_t body_a, uint32_t body_b);
+    };
+
+} // EngiGraph
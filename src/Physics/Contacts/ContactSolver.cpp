@@ -0,0 +1,363 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "ContactSolver.h"
+#include "ContactColoring.h"
+#include "src/Profiling/Trace.h"
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace EngiGraph {
+
+    /**
+     * Velocity state of a body taking part in the solve.
+     */
+    struct SolverBody {
+        Eigen::Vector3d velocity;
+        Eigen::Vector3d angular_velocity;
+        double inverse_mass;
+        /**
+         * World space.
+         */
+        Eigen::Matrix3d inverse_inertia;
+        /**
+         * Dense index in the world.
+         */
+        uint32_t index;
+        /**
+         * Can the solver change this body? Immovable bodies are never written, so pairs of a color can share them.
+         */
+        bool dynamic;
+    };
+
+    /**
+     * One value for each of the 4 lanes of a batch.
+     */
+    using Lanes = Eigen::Array4d;
+
+    struct LaneVector {
+        Lanes x, y, z;
+
+        void set(uint32_t lane, const Eigen::Vector3d& vector) {
+            x[lane] = vector.x(); y[lane] = vector.y(); z[lane] = vector.z();
+        }
+
+        [[nodiscard]] Eigen::Vector3d get(uint32_t lane) const {
+            return {x[lane], y[lane], z[lane]};
+        }
+
+        [[nodiscard]] Lanes dot(const LaneVector& other) const {
+            return x * other.x + y * other.y + z * other.z;
+        }
+
+        void addScaled(const LaneVector& other, const Lanes& scale) {
+            x += other.x * scale; y += other.y * scale; z += other.z * scale;
+        }
+    };
+
+    /**
+     * One constraint direction(normal or tangent) of the 4 lanes of a batch point.
+     */
+    struct ConstraintRows {
+        LaneVector direction;
+        /**
+         * Contact offset crossed with the direction, for each body.
+         */
+        LaneVector angular_a, angular_b;
+        /**
+         * World inverse inertia times angular, the change in angular velocity per unit of impulse.
+         */
+        LaneVector inertia_angular_a, inertia_angular_b;
+        /**
+         * Inverse of the effective mass along the direction. Zero for unused lanes, which keeps them from changing anything.
+         */
+        Lanes effective_mass;
+        /**
+         * Velocity change per unit of impulse, used to measure the residual.
+         */
+        Lanes inverse_effective_mass;
+        /**
+         * Accumulated impulse.
+         */
+        Lanes impulse;
+    };
+
+    /**
+     * One contact of each of the 4 pairs of a batch.
+     */
+    struct BatchPoint {
+        /**
+         * Contact index of each lane, UINT32_MAX where the pair of the lane has no contact this far.
+         */
+        std::array<uint32_t, 4> contacts;
+        /**
+         * Speed the bodies may approach each other at along the normal, from the separation of speculative contacts.
+         * Negative for overlapping contacts, to push them apart.
+         */
+        Lanes approach_speed;
+        /**
+         * Normal, then both tangents.
+         */
+        std::array<ConstraintRows, 3> rows;
+    };
+
+    /**
+     * Up to 4 contact pairs of one color, stored so their constraint rows are solved together in SIMD lanes.
+     * @details The points of a pair are solved one after another, so all the points of a manifold stay in one task.
+     */
+    struct ContactBatch {
+        /**
+         * Solver body indices of each pair. Unused lanes repeat the last used lane.
+         */
+        std::array<uint32_t, 4> bodies_a, bodies_b;
+        /**
+         * Used lanes.
+         */
+        uint32_t count;
+        Lanes inverse_mass_a, inverse_mass_b;
+        /**
+         * The first contact of each pair, then the second, and so on up to the longest pair.
+         */
+        std::vector<BatchPoint> points;
+    };
+
+    static void prepareRows(ConstraintRows& rows, uint32_t lane, const SolverBody& a, const SolverBody& b,
+                            const Eigen::Vector3d& offset_a, const Eigen::Vector3d& offset_b, const Eigen::Vector3d& direction, double impulse) {
+        Eigen::Vector3d angular_a = offset_a.cross(direction);
+        Eigen::Vector3d angular_b = offset_b.cross(direction);
+        Eigen::Vector3d inertia_angular_a = a.inverse_inertia * angular_a;
+        Eigen::Vector3d inertia_angular_b = b.inverse_inertia * angular_b;
+        double inverse_effective_mass = a.inverse_mass + b.inverse_mass + angular_a.dot(inertia_angular_a) + angular_b.dot(inertia_angular_b);
+        rows.direction.set(lane, direction);
+        rows.angular_a.set(lane, angular_a);
+        rows.angular_b.set(lane, angular_b);
+        rows.inertia_angular_a.set(lane, inertia_angular_a);
+        rows.inertia_angular_b.set(lane, inertia_angular_b);
+        rows.effective_mass[lane] = inverse_effective_mass > 0.0 ? 1.0 / inverse_effective_mass : 0.0;
+        rows.inverse_effective_mass[lane] = inverse_effective_mass;
+        rows.impulse[lane] = inverse_effective_mass > 0.0 ? impulse : 0.0;
+    }
+
+    /**
+     * Velocities of the bodies of a batch, gathered into lanes.
+     */
+    struct BatchVelocities {
+        LaneVector velocity_a, angular_velocity_a, velocity_b, angular_velocity_b;
+
+        BatchVelocities(const std::vector<SolverBody>& bodies, const ContactBatch& batch) {
+            for (uint32_t lane = 0; lane < 4; ++lane) {
+                const SolverBody& a = bodies[batch.bodies_a[lane]];
+                const SolverBody& b = bodies[batch.bodies_b[lane]];
+                velocity_a.set(lane, a.velocity);
+                angular_velocity_a.set(lane, a.angular_velocity);
+                velocity_b.set(lane, b.velocity);
+                angular_velocity_b.set(lane, b.angular_velocity);
+            }
+        }
+
+        /**
+         * Apply impulses along a row to b, and the opposite to a.
+         */
+        void applyImpulse(const ContactBatch& batch, const ConstraintRows& rows, const Lanes& impulse) {
+            velocity_a.addScaled(rows.direction, -impulse * batch.inverse_mass_a);
+            angular_velocity_a.addScaled(rows.inertia_angular_a, -impulse);
+            velocity_b.addScaled(rows.direction, impulse * batch.inverse_mass_b);
+            angular_velocity_b.addScaled(rows.inertia_angular_b, impulse);
+        }
+
+        /**
+         * Write the velocities back to the dynamic bodies of the batch.
+         */
+        void scatter(std::vector<SolverBody>& bodies, const ContactBatch& batch) const {
+            for (uint32_t lane = 0; lane < batch.count; ++lane) {
+                SolverBody& a = bodies[batch.bodies_a[lane]];
+                SolverBody& b = bodies[batch.bodies_b[lane]];
+                if(a.dynamic){
+                    a.velocity = velocity_a.get(lane);
+                    a.angular_velocity = angular_velocity_a.get(lane);
+                }
+                if(b.dynamic){
+                    b.velocity = velocity_b.get(lane);
+                    b.angular_velocity = angular_velocity_b.get(lane);
+                }
+            }
+        }
+    };
+
+    /**
+     * Do one Gauss-Seidel pass over the contacts of a batch.
+     * @return Largest velocity change.
+     */
+    static double solveBatch(std::vector<SolverBody>& bodies, ContactBatch& batch, double relaxation, double friction) {
+        BatchVelocities velocities(bodies, batch);
+        Lanes residual = Lanes::Zero();
+        for (auto& point : batch.points) {
+            for (uint32_t row = 0; row < 3; ++row) {
+                ConstraintRows& rows = point.rows[row];
+                Lanes relative_velocity = rows.direction.dot(velocities.velocity_b) + rows.angular_b.dot(velocities.angular_velocity_b)
+                                          - rows.direction.dot(velocities.velocity_a) - rows.angular_a.dot(velocities.angular_velocity_a);
+                if(row == 0) relative_velocity += point.approach_speed;
+                Lanes new_impulse = rows.impulse - relaxation * relative_velocity * rows.effective_mass;
+                if(row == 0){
+                    new_impulse = new_impulse.max(0.0); //Contacts only push
+                }else{
+                    Lanes max_friction = friction * point.rows[0].impulse;
+                    new_impulse = new_impulse.max(-max_friction).min(max_friction);
+                }
+                Lanes change = new_impulse - rows.impulse;
+                rows.impulse = new_impulse;
+                velocities.applyImpulse(batch, rows, change);
+                residual = residual.max(change.abs() * rows.inverse_effective_mass);
+            }
+        }
+        velocities.scatter(bodies, batch);
+        return residual.maxCoeff();
+    }
+
+    ContactSolverStats ContactSolver::solve(PhysicsWorld& world, std::vector<Contact>& contacts, double delta_time) {
+        ENGIGRAPH_TRACE_SCOPE("ContactSolver::solve");
+        ContactSolverStats stats{};
+        if(contacts.empty()) return stats;
+        if(!settings.warm_starting){
+            for (auto& contact : contacts) {
+                contact.normal_impulse = 0.0;
+                contact.friction_impulse = {0,0,0};
+            }
+        }
+
+        //Gather the bodies that are touching something
+        std::vector<uint32_t> solver_indices(world.getBodyCount(), UINT32_MAX);
+        std::vector<SolverBody> bodies{};
+        std::vector<uint8_t> dynamic(world.getBodyCount(), 0);
+        for (const auto& contact : contacts) {
+            for (uint32_t index : {contact.body_a, contact.body_b}) {
+                if(solver_indices[index] != UINT32_MAX) continue;
+                solver_indices[index] = (uint32_t)bodies.size();
+                const bool frozen = world.hasFlag(index, BODY_FLAG_SLEEPING) || world.states.inverse_mass[index] == 0.0;
+                bodies.push_back({world.getVelocity(index), world.getAngularVelocity(index),
+                                  frozen ? 0.0 : world.states.inverse_mass[index],
+                                  frozen ? Eigen::Matrix3d::Zero() : world.getInverseInertiaWorld(index), index, !frozen});
+                dynamic[index] = !frozen;
+            }
+        }
+
+        //Lay out the pairs of each color in batches of 4
+        const auto pairs = groupContactPairs(contacts);
+        const auto colors = colorContactPairs(pairs, dynamic);
+        stats.colors = (uint32_t)colors.size();
+        std::vector<ContactBatch> batches{};
+        std::vector<std::pair<uint32_t, uint32_t>> color_ranges{};
+        for (const auto& color : colors) {
+            uint32_t first_batch = (uint32_t)batches.size();
+            for (size_t start = 0; start < color.size(); start += 4) {
+                ContactBatch& batch = batches.emplace_back();
+                batch.count = (uint32_t)std::min<size_t>(4, color.size() - start);
+                std::array<const ContactPair*, 4> lane_pairs{};
+                size_t point_count = 0;
+                for (uint32_t lane = 0; lane < 4; ++lane) {
+                    lane_pairs[lane] = &pairs[color[start + std::min(lane, batch.count - 1)]];
+                    batch.bodies_a[lane] = solver_indices[lane_pairs[lane]->body_a];
+                    batch.bodies_b[lane] = solver_indices[lane_pairs[lane]->body_b];
+                    const bool used = lane < batch.count;
+                    batch.inverse_mass_a[lane] = used ? bodies[batch.bodies_a[lane]].inverse_mass : 0.0;
+                    batch.inverse_mass_b[lane] = used ? bodies[batch.bodies_b[lane]].inverse_mass : 0.0;
+                    point_count = std::max(point_count, lane_pairs[lane]->contacts.size());
+                }
+                batch.points.resize(point_count);
+                for (size_t point_index = 0; point_index < point_count; ++point_index) {
+                    BatchPoint& point = batch.points[point_index];
+                    for (uint32_t lane = 0; lane < 4; ++lane) {
+                        const ContactPair& pair = *lane_pairs[lane];
+                        const uint32_t contact_index = pair.contacts[std::min(point_index, pair.contacts.size() - 1)];
+                        const Contact& contact = contacts[contact_index];
+                        const bool used = lane < batch.count && point_index < pair.contacts.size();
+                        point.contacts[lane] = used ? contact_index : UINT32_MAX;
+                        const SolverBody& a = bodies[batch.bodies_a[lane]];
+                        const SolverBody& b = bodies[batch.bodies_b[lane]];
+                        const double correction = contact.separation > 0.0 ? contact.separation : settings.position_correction * contact.separation;
+                        point.approach_speed[lane] = delta_time > 0.0 ? correction / delta_time : 0.0;
+
+                        //Speculative contacts have their points on each body half the gap away
+                        const Eigen::Vector3d half_gap = 0.5 * std::max(contact.separation, 0.0) * contact.normal_a_to_b;
+                        const Eigen::Vector3d offset_a = contact.point - half_gap - world.getPosition(contact.body_a);
+                        const Eigen::Vector3d offset_b = contact.point + half_gap - world.getPosition(contact.body_b);
+                        const Eigen::Vector3d tangent_1 = contact.normal_a_to_b.unitOrthogonal();
+                        const Eigen::Vector3d tangent_2 = contact.normal_a_to_b.cross(tangent_1);
+                        //Unused lanes get no mass, so they never change anything
+                        const SolverBody& lane_a = used ? a : SolverBody{{}, {}, 0.0, Eigen::Matrix3d::Zero(), 0, false};
+                        const SolverBody& lane_b = used ? b : lane_a;
+                        prepareRows(point.rows[0], lane, lane_a, lane_b, offset_a, offset_b, contact.normal_a_to_b, contact.normal_impulse);
+                        prepareRows(point.rows[1], lane, lane_a, lane_b, offset_a, offset_b, tangent_1, contact.friction_impulse.dot(tangent_1));
+                        prepareRows(point.rows[2], lane, lane_a, lane_b, offset_a, offset_b, tangent_2, contact.friction_impulse.dot(tangent_2));
+                    }
+                }
+            }
+            color_ranges.emplace_back(first_batch, (uint32_t)batches.size());
+        }
+
+        //Warm start, applying the impulses of last step up front
+        for (auto& batch : batches) {
+            BatchVelocities velocities(bodies, batch);
+            for (const auto& point : batch.points) {
+                for (const auto& rows : point.rows) {
+                    velocities.applyImpulse(batch, rows, rows.impulse);
+                }
+            }
+            velocities.scatter(bodies, batch);
+        }
+
+        std::vector<double> batch_residuals(batches.size(), 0.0);
+        auto solve_batch = [&](uint32_t batch){
+            batch_residuals[batch] = solveBatch(bodies, batches[batch], settings.relaxation, settings.friction);
+        };
+        //Build the graph once, each color waiting for the one before, and run it every iteration
+        const bool parallel = settings.parallel && batches.size() > color_ranges.size();
+        tf::Taskflow taskflow;
+        if(parallel){
+            if(!executor) executor = std::make_shared<tf::Executor>();
+            tf::Task previous_color{};
+            for (const auto& [first_batch, last_batch] : color_ranges) {
+                tf::Task color = taskflow.for_each_index(first_batch, last_batch, 1u, [&](uint32_t batch){
+                    ENGIGRAPH_TRACE_SCOPE("ContactSolver batch");
+                    solve_batch(batch);
+                });
+                if(!previous_color.empty()) previous_color.precede(color);
+                previous_color = color;
+            }
+        }
+        for (stats.iterations = 0; stats.iterations < settings.max_iterations;) {
+            stats.iterations++;
+            if(parallel){
+                ENGIGRAPH_TRACE_SCOPE("ContactSolver iteration");
+                executor->run(taskflow).wait();
+            }else{
+                for (uint32_t batch = 0; batch < batches.size(); ++batch) {
+                    solve_batch(batch);
+                }
+            }
+            stats.residual = *std::max_element(batch_residuals.begin(), batch_residuals.end());
+            if(stats.residual <= settings.residual_tolerance) break;
+        }
+
+        for (const auto& body : bodies) {
+            if(!body.dynamic) continue;
+            world.setVelocity(body.index, body.velocity);
+            world.setAngularVelocity(body.index, body.angular_velocity);
+        }
+        for (const auto& batch : batches) {
+            for (const auto& point : batch.points) {
+                for (uint32_t lane = 0; lane < 4; ++lane) {
+                    if(point.contacts[lane] == UINT32_MAX) continue;
+                    Contact& contact = contacts[point.contacts[lane]];
+                    contact.normal_impulse = point.rows[0].impulse[lane];
+                    contact.friction_impulse = point.rows[1].impulse[lane] * point.rows[1].direction.get(lane) + point.rows[2].impulse[lane] * point.rows[2].direction.get(lane);
+                }
+            }
+        }
+        return stats;
+    }
+
+} // EngiGraph
@@ -0,0 +1,106 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <memory>
+#include <vector>
+#include <taskflow/taskflow.hpp>
+#include "Contact.h"
+#include "src/Physics/World/PhysicsWorld.h"
+
+namespace EngiGraph {
+
+    /**
+     * Options for the contact solver.
+     */
+    struct ContactSolverSettings {
+        /**
+         * Most passes over all contacts per step.
+         */
+        uint32_t max_iterations = 20;
+        /**
+         * Stop early once no pass changes a contact velocity by more than this.
+         */
+        double residual_tolerance = 1e-4;
+        /**
+         * Successive over-relaxation factor for each impulse update. 1 is plain Gauss-Seidel, (1,2) converges faster but can overshoot.
+         */
+        double relaxation = 1.0;
+        /**
+         * Coulomb friction coefficient.
+         */
+        double friction = 0.5;
+        /**
+         * Fraction of the overlap of a contact pushed out each step(Baumgarte stabilization).
+         */
+        double position_correction = 0.2;
+        /**
+         * Start from the impulses already in the contacts, usually those of the previous step from a ContactManifolds.
+         */
+        bool warm_starting = true;
+        /**
+         * Solve the pairs of each color on multiple threads.
+         */
+        bool parallel = true;
+    };
+
+    /**
+     * How a solve went.
+     */
+    struct ContactSolverStats {
+        /**
+         * Passes done over all contacts.
+         */
+        uint32_t iterations = 0;
+        /**
+         * Largest velocity change of the last pass.
+         */
+        double residual = 0.0;
+        /**
+         * Number of groups of independent body pairs.
+         */
+        uint32_t colors = 0;
+    };
+
+    /**
+     * Sequential impulse contact solver(projected Gauss-Seidel).
+     * @details Impulses are accumulated per contact and clamped, so contacts can pull back impulse that earlier passes over-applied.
+     * @details Sleeping bodies are treated as immovable.
+     * @details Contacts are grouped by the pair of bodies they are between, and the pairs are graph colored, so pairs of one color share no dynamic body.
+     * Each color is solved in parallel, 4 pairs at a time in SIMD lanes, going through the contacts of each pair in order.
+     * Since pairs of a color are independent, the result does not depend on the thread count.
+     * Friction uses a box around the two tangent directions, so each row can be clamped on its own.
+     */
+    class ContactSolver {
+    public:
+        ContactSolverSettings settings{};
+
+        /**
+         * Change body velocities so no contact point is moving into the other body, or for speculative contacts, would not close the gap within the step.
+         * Overlapping contacts are pushed apart by part of their overlap each step.
+         * @param world Bodies to solve.
+         * @param contacts Contacts of this step. Their impulses are used for warm starting, and replaced with the solved impulses.
+         * @param delta_time Length of the step, used to turn the separation of contacts into an allowed approach speed, or a speed pushing them apart.
+         * @return Iterations done and final residual.
+         */
+        ContactSolverStats solve(PhysicsWorld& world, std::vector<Contact>& contacts, double delta_time);
+
+        /**
+         * Share threads with something else, like a NarrowPhase, instead of creating them on the first parallel solve.
+         * @param new_executor Executor to run on.
+         */
+        void setExecutor(std::shared_ptr<tf::Executor> new_executor) {
+            executor = std::move(new_executor);
+        }
+
+    private:
+        /**
+         * Created on the first parallel solve, unless set.
+         */
+        std::shared_ptr<tf::Executor> executor{};
+    };
+
+} // EngiGraph
@@ -0,0 +1,83 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "HitAdvance.h"
+#include <algorithm>
+#include "src/Physics/World/BatchIntegrator.h"
+
+namespace EngiGraph {
+
+    void HitAdvance::integrate(PhysicsWorld& world, CollisionBounds& bounds, NarrowPhase& narrow_phase, ContactManifolds& manifolds, const SleepSettings& sleep_settings,
+                               const std::vector<uint8_t>& solved, double delta_time, StepProfile& profile) const {
+        constexpr double end_tolerance = 0.001;
+        //Bodies of a pair that hits only move most of the way to the hit, which may hold back the bodies around them in turn
+        const uint32_t body_count = world.getBodyCount();
+        std::vector<double> advance(body_count, 1.0);
+        std::vector<uint8_t> changed = solved;
+        std::vector<std::pair<BodyPair, Eigen::Vector3d>> impacts;
+        auto can_hold = [&](uint32_t body){
+            return !world.hasFlag(body, BODY_FLAG_KINEMATIC) && advance[body] > 0.0;
+        };
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_COLLISION]);
+            world.updateFutureTransforms(delta_time);
+            bounds.update(world);
+            for (uint32_t pass = 0; std::find(changed.begin(), changed.end(), 1) != changed.end(); ++pass) {
+                std::vector<BodyPair> pairs;
+                for (uint32_t j = 0; j < body_count; ++j) {
+                    for (uint32_t k = j + 1; k < body_count; ++k) {
+                        if(!changed[j] && !changed[k]) continue;
+                        if(!can_hold(j) && !can_hold(k)) continue;
+                        if(world.canPairCollide(j, k) && bounds.overlaps(j, k)) pairs.push_back({j, k});
+                    }
+                }
+                const auto hits = narrow_phase.collide(world, bounds, pairs);
+                std::vector<double> next_advance = advance;
+                for (size_t pair = 0; pair < pairs.size(); ++pair) {
+                    if(hits[pair].empty()) continue;
+                    const auto [body_a, body_b] = pairs[pair];
+                    //The hits become contacts for the next step, so held bodies have their velocity corrected instead of hanging in place
+                    world.wakeOnImpact(body_a, body_b, sleep_settings);
+                    manifolds.addHits(world, body_a, body_b, hits[pair]);
+                    impacts.push_back({pairs[pair], hits[pair].front().normal_a_to_b});
+                    //A hit at the end of the motion is a gap the solver closed, not a body passing into another
+                    const double time = hits[pair].front().time;
+                    if(time > 1.0 - end_tolerance) continue;
+                    //Pairs that keep hitting after a few passes are stopped where they are
+                    const double fraction = pass < max_passes ? hit_fraction * time : 0.0;
+                    for (uint32_t body : {body_a, body_b}) {
+                        if(can_hold(body)) next_advance[body] = std::min(next_advance[body], fraction * advance[body]);
+                    }
+                }
+                for (uint32_t j = 0; j < body_count; ++j) {
+                    changed[j] = next_advance[j] != advance[j];
+                    if(changed[j]) writePoseTransforms(world.states, next_advance[j] * delta_time, world.future_transforms.data(), j, j + 1);
+                }
+                advance = std::move(next_advance);
+            }
+        }
+        ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_INTEGRATE_POSITIONS]);
+        std::vector<uint8_t> move_mask(body_count);
+        for (uint32_t j = 0; j < body_count; ++j) {
+            move_mask[j] = advance[j] == 1.0;
+        }
+        world.integratePositions(delta_time, move_mask);
+        for (uint32_t j = 0; j < body_count; ++j) {
+            if(advance[j] < 1.0 && advance[j] > 0.0) integratePoses(world.states, advance[j] * delta_time, nullptr, j, j + 1);
+        }
+        //Bodies that hit lose the speed they close in on each other with, like an inelastic impact, so bodies jammed together do not gather speed they never move with
+        for (auto [pair, normal] : impacts) {
+            const auto [body_a, body_b] = pair;
+            if(normal.dot(world.getPosition(body_b) - world.getPosition(body_a)) < 0.0) normal = -normal;
+            const double inverse_mass_a = world.isDynamic(body_a) ? world.states.inverse_mass[body_a] : 0.0;
+            const double inverse_mass_b = world.isDynamic(body_b) ? world.states.inverse_mass[body_b] : 0.0;
+            const double closing_speed = (world.getVelocity(body_a) - world.getVelocity(body_b)).dot(normal);
+            if(closing_speed <= 0.0 || inverse_mass_a + inverse_mass_b == 0.0) continue;
+            const Eigen::Vector3d impulse = closing_speed / (inverse_mass_a + inverse_mass_b) * normal;
+            world.setVelocity(body_a, world.getVelocity(body_a) - inverse_mass_a * impulse);
+            world.setVelocity(body_b, world.getVelocity(body_b) + inverse_mass_b * impulse);
+        }
+    }
+
+} // EngiGraph
@@ -0,0 +1,50 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <vector>
+#include "ContactManifold.h"
+#include "src/Physics/Collisions/CollisionBounds.h"
+#include "src/Physics/Collisions/NarrowPhase.h"
+#include "src/Physics/World/PhysicsWorld.h"
+#include "src/Profiling/StepProfile.h"
+
+namespace EngiGraph {
+
+    /**
+     * Moves bodies with their solved velocity, most of the way to the first hit along that motion.
+     * @details CCD only reports the earliest hits of a pair, so a contact solve can steer a body into a part of another body
+     * that was never hit. Pairs with a body the solver changed are collided again along the motion they will really make,
+     * and bodies that still hit are held back.
+     */
+    class HitAdvance {
+    public:
+        /**
+         * Part of the way to their first hit that bodies move in a step.
+         * @details Below 1, so a small gap is left for the contact solver to close as a speculative contact.
+         */
+        double hit_fraction = 0.9;
+
+        /**
+         * Times bodies are held back further when their shortened motion still runs into another body, before they are stopped where they are.
+         */
+        uint32_t max_passes = 4;
+
+        /**
+         * Move every awake body after the contact solve.
+         * @param world Bodies, with the velocities from the contact solver.
+         * @param bounds Updated to the motion of each pass.
+         * @param narrow_phase Collides the pairs of each pass.
+         * @param manifolds Hits along the new motion are added as contacts for the next step.
+         * @param sleep_settings Sleeping bodies hit by a moving body are woken.
+         * @param solved 1 for bodies whose velocity the contact solver may have changed.
+         * @param delta_time Time step.
+         * @param profile Collision and integration time is added to it.
+         */
+        void integrate(PhysicsWorld& world, CollisionBounds& bounds, NarrowPhase& narrow_phase, ContactManifolds& manifolds, const SleepSettings& sleep_settings,
+                       const std::vector<uint8_t>& solved, double delta_time, StepProfile& profile) const;
+    };
+
+} // EngiGraph
@@ -0,0 +1,39 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "IslandGraph.h"
+#include <utility>
+
+namespace EngiGraph {
+
+    IslandGraph::IslandGraph(uint32_t body_count) : parents(body_count), ranks(body_count, 0) {
+        for (uint32_t j = 0; j < body_count; ++j) {
+            parents[j] = j;
+        }
+    }
+
+    uint32_t IslandGraph::findIsland(uint32_t body) {
+        uint32_t root = body;
+        while (parents[root] != root) {
+            root = parents[root];
+        }
+        //Path compression, so the next lookup is a single jump
+        while (parents[body] != root) {
+            uint32_t next = parents[body];
+            parents[body] = root;
+            body = next;
+        }
+        return root;
+    }
+
+    void IslandGraph::link(uint32_t body_a, uint32_t body_b) {
+        uint32_t root_a = findIsland(body_a);
+        uint32_t root_b = findIsland(body_b);
+        if(root_a == root_b) return;
+        if(ranks[root_a] < ranks[root_b]) std::swap(root_a, root_b);
+        parents[root_b] = root_a;
+        if(ranks[root_a] == ranks[root_b]) ranks[root_a]++;
+    }
+
+} // EngiGraph
@@ -0,0 +1,49 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace EngiGraph {
+
+    /**
+     * Groups bodies into islands of touching bodies.
+     * @details Disjoint set forest with path compression and union by rank. Bodies are referenced by index.
+     */
+    class IslandGraph {
+    public:
+        /**
+         * Create a graph where every body is its own island.
+         * @param body_count Number of bodies.
+         */
+        explicit IslandGraph(uint32_t body_count);
+
+        /**
+         * Put two bodies in the same island.
+         * @param body_a,body_b Body indices.
+         */
+        void link(uint32_t body_a, uint32_t body_b);
+
+        /**
+         * Get the representative body of an island.
+         * @param body Body index.
+         * @return Index that is equal for all bodies in the same island.
+         */
+        uint32_t findIsland(uint32_t body);
+
+        /**
+         * Get the number of bodies in the graph.
+         */
+        [[nodiscard]] uint32_t getBodyCount() const {
+            return (uint32_t)parents.size();
+        }
+
+    private:
+        std::vector<uint32_t> parents;
+        std::vector<uint8_t> ranks;
+    };
+
+} // EngiGraph
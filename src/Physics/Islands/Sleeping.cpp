@@ -0,0 +1,50 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "Sleeping.h"
+
+namespace EngiGraph {
+
+    void updateRestingTime(SleepState& state, const Eigen::Vector3d& velocity, const Eigen::Vector3d& angular_velocity, double delta_time, const SleepSettings& settings) {
+        if(state.sleeping) return;
+        const double linear_threshold = settings.linear_velocity_threshold * settings.linear_velocity_threshold;
+        const double angular_threshold = settings.angular_velocity_threshold * settings.angular_velocity_threshold;
+        if(velocity.squaredNorm() > linear_threshold || angular_velocity.squaredNorm() > angular_threshold){
+            state.resting_time = 0.0;
+        }else{
+            state.resting_time += delta_time;
+        }
+    }
+
+    std::vector<SleepTransition> updateIslandSleep(IslandGraph& islands, const std::vector<SleepState>& states, const SleepSettings& settings) {
+        const uint32_t body_count = islands.getBodyCount();
+        std::vector<SleepTransition> transitions(body_count, SleepTransition::NONE);
+        if(!settings.enabled){
+            for (uint32_t j = 0; j < body_count; ++j) {
+                if(states[j].sleeping) transitions[j] = SleepTransition::WAKE_UP;
+            }
+            return transitions;
+        }
+
+        //Flags are stored at the island root
+        std::vector<uint8_t> island_rested(body_count, 1);
+        std::vector<uint8_t> island_moving(body_count, 0);
+        for (uint32_t j = 0; j < body_count; ++j) {
+            uint32_t island = islands.findIsland(j);
+            if(states[j].resting_time < settings.time_until_sleep) island_rested[island] = 0;
+            if(!states[j].sleeping && states[j].resting_time == 0.0) island_moving[island] = 1;
+        }
+
+        for (uint32_t j = 0; j < body_count; ++j) {
+            uint32_t island = islands.findIsland(j);
+            if(island_rested[island]){
+                if(!states[j].sleeping) transitions[j] = SleepTransition::FALL_ASLEEP;
+            }else if(island_moving[island]){
+                if(states[j].sleeping) transitions[j] = SleepTransition::WAKE_UP;
+            }
+        }
+        return transitions;
+    }
+
+} // EngiGraph
@@ -0,0 +1,78 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <vector>
+#include "IslandGraph.h"
+
+namespace EngiGraph {
+
+    /**
+     * Options for putting resting bodies to sleep.
+     */
+    struct SleepSettings {
+        /**
+         * Allow bodies to fall asleep at all.
+         */
+        bool enabled = true;
+        /**
+         * Bodies slower than this are considered resting.
+         */
+        double linear_velocity_threshold = 0.05;
+        /**
+         * Bodies rotating slower than this(radians per second) are considered resting.
+         */
+        double angular_velocity_threshold = 0.05;
+        /**
+         * How long a whole island needs to rest before it falls asleep.
+         */
+        double time_until_sleep = 0.5;
+    };
+
+    /**
+     * Per-body sleep information.
+     */
+    struct SleepState {
+        /**
+         * Time the body has been continuously below the velocity thresholds.
+         */
+        double resting_time = 0.0;
+        /**
+         * Sleeping bodies are not integrated and do not test collisions against other sleeping bodies.
+         */
+        bool sleeping = false;
+    };
+
+    /**
+     * What a body should do after updateIslandSleep().
+     */
+    enum class SleepTransition : uint8_t {
+        NONE,
+        FALL_ASLEEP,
+        WAKE_UP
+    };
+
+    /**
+     * Accumulate the resting time of an awake body.
+     * @param state Sleep state to update. Sleeping bodies are left untouched.
+     * @param velocity,angular_velocity Velocity of the body after the step.
+     * @param delta_time Length of the step.
+     * @param settings Velocity thresholds.
+     */
+    void updateRestingTime(SleepState& state, const Eigen::Vector3d& velocity, const Eigen::Vector3d& angular_velocity, double delta_time, const SleepSettings& settings);
+
+    /**
+     * Decide which islands fall asleep, and which wake up.
+     * @details An island falls asleep once every body in it has rested for long enough.
+     * An island is woken if any awake body in it is moving, which is how contact with a moving body wakes a sleeping pile.
+     * @param islands Islands built from this step's contacts.
+     * @param states Sleep state of each body, indexed like the island graph.
+     * @param settings Sleep settings.
+     * @return Transition for each body. Bodies already in the target state get NONE.
+     */
+    std::vector<SleepTransition> updateIslandSleep(IslandGraph& islands, const std::vector<SleepState>& states, const SleepSettings& settings);
+
+} // EngiGraph
@@ -0,0 +1,334 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "SceneQuery.h"
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+#include <array>
+#include "src/Exceptions/RuntimeException.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Physics/Collisions/LinearPointCcd.h"
+#include "src/Profiling/Trace.h"
+
+namespace EngiGraph {
+
+    namespace {
+
+        /**
+         * One over each component of a direction, for Aabb::intersectsRay().
+         */
+        Eigen::Vector3d inverseDirection(const Eigen::Vector3d& direction) {
+            Eigen::Vector3d inverse;
+            for (int axis = 0; axis < 3; ++axis) {
+                inverse[axis] = direction[axis] == 0.0 ? 1e300 : 1.0 / direction[axis];
+            }
+            return inverse;
+        }
+
+        Eigen::Vector3d transformPoint(const Eigen::Matrix4d& transform, const Eigen::Vector3d& point) {
+            return transform.topLeftCorner<3,3>() * point + transform.topRightCorner<3,1>();
+        }
+
+        std::array<Eigen::Vector3d, 3> getTriangle(const Mesh& mesh, uint32_t triangle) {
+            return {mesh.vertices[mesh.triangle_indices[triangle * 3 + 0]].cast<double>(),
+                    mesh.vertices[mesh.triangle_indices[triangle * 3 + 1]].cast<double>(),
+                    mesh.vertices[mesh.triangle_indices[triangle * 3 + 2]].cast<double>()};
+        }
+
+        /**
+         * Closest point to p on triangle abc, from Real-Time Collision Detection by Christer Ericson.
+         */
+        Eigen::Vector3d closestPointOnTriangle(const Eigen::Vector3d& p, const Eigen::Vector3d& a, const Eigen::Vector3d& b, const Eigen::Vector3d& c) {
+            const Eigen::Vector3d ab = b - a;
+            const Eigen::Vector3d ac = c - a;
+            const Eigen::Vector3d ap = p - a;
+            const double d1 = ab.dot(ap);
+            const double d2 = ac.dot(ap);
+            if(d1 <= 0.0 && d2 <= 0.0) return a;
+            const Eigen::Vector3d bp = p - b;
+            const double d3 = ab.dot(bp);
+            const double d4 = ac.dot(bp);
+            if(d3 >= 0.0 && d4 <= d3) return b;
+            const double vc = d1 * d4 - d3 * d2;
+            if(vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) return a + ab * (d1 / (d1 - d3));
+            const Eigen::Vector3d cp = p - c;
+            const double d5 = ab.dot(cp);
+            const double d6 = ac.dot(cp);
+            if(d6 >= 0.0 && d5 <= d6) return c;
+            const double vb = d5 * d2 - d1 * d6;
+            if(vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) return a + ac * (d2 / (d2 - d6));
+            const double va = d3 * d6 - d5 * d4;
+            if(va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+            const double denominator = 1.0 / (va + vb + vc);
+            return a + ab * (vb * denominator) + ac * (vc * denominator);
+        }
+
+        /**
+         * Separating axis test between a triangle and a box, from Fast 3D Triangle-Box Overlap Testing by Tomas Akenine-Möller.
+         */
+        bool triangleOverlapsBox(const std::array<Eigen::Vector3d, 3>& triangle, const Eigen::Vector3d& center, const Eigen::Vector3d& half_size) {
+            const std::array<Eigen::Vector3d, 3> v = {triangle[0] - center, triangle[1] - center, triangle[2] - center};
+            const std::array<Eigen::Vector3d, 3> edges = {v[1] - v[0], v[2] - v[1], v[0] - v[2]};
+            auto separated = [&](const Eigen::Vector3d& axis){
+                const double p0 = axis.dot(v[0]);
+                const double p1 = axis.dot(v[1]);
+                const double p2 = axis.dot(v[2]);
+                const double radius = half_size.dot(axis.cwiseAbs());
+                return std::min({p0, p1, p2}) > radius || std::max({p0, p1, p2}) < -radius;
+            };
+            //Box faces
+            for (int axis = 0; axis < 3; ++axis) {
+                if(std::min({v[0][axis], v[1][axis], v[2][axis]}) > half_size[axis] || std::max({v[0][axis], v[1][axis], v[2][axis]}) < -half_size[axis]) return false;
+            }
+            //Triangle plane
+            if(separated(edges[0].cross(edges[1]))) return false;
+            //Edge cross products
+            for (const auto& edge : edges) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    if(separated(Eigen::Vector3d::Unit(axis).cross(edge))) return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Check if a point is inside a closed mesh, by the parity of the triangles a ray from it crosses.
+         */
+        bool isInsideMesh(const Mesh& mesh, const BoundsHierarchy& triangles, const Eigen::Vector3d& point) {
+            //Skewed so the ray is unlikely to run along an edge of axis aligned geometry
+            const Eigen::Vector3d direction = Eigen::Vector3d{0.5377, 0.8115, 0.2284}.normalized();
+            const Eigen::Vector3d inverse_direction = inverseDirection(direction);
+            const auto k = calculateRayDimensions(direction);
+            const auto s = calculateRayShearConstraints(k, direction);
+            constexpr double max_distance = std::numeric_limits<double>::infinity();
+            uint32_t crossings = 0;
+            triangles.traverse([&](const Aabb& bounds){
+                return bounds.intersectsRay(point, inverse_direction, max_distance);
+            }, [&](uint32_t triangle){
+                const auto [a, b, c] = getTriangle(mesh, triangle);
+                Eigen::Vector4d hit_info;
+                if(rayTriangleIntersection(a, b, c, point, hit_info, k, s)) crossings++;
+                return true;
+            });
+            return crossings % 2 == 1;
+        }
+
+    }
+
+    void SceneQuery::update(const PhysicsWorld& world) {
+        ENGIGRAPH_TRACE_SCOPE("SceneQuery::update");
+        const uint32_t body_count = world.getBodyCount();
+        handles.resize(body_count);
+        layers.resize(body_count);
+        pieces.clear();
+        std::vector<Aabb> piece_bounds;
+        auto& registry = ColliderRegistry::getShared();
+        auto add_piece = [&](uint32_t body, const std::shared_ptr<const Mesh>& mesh, const Eigen::Matrix4d& transform){
+            auto triangles = registry.getTriangleHierarchy(mesh);
+            if(triangles->getItemCount() == 0) return;
+            piece_bounds.push_back(triangles->getBounds().transformed(transform));
+            pieces.push_back({body, mesh, std::move(triangles), transform, transform.inverse()});
+        };
+        for (uint32_t body = 0; body < body_count; ++body) {
+            handles[body] = world.getHandle(body);
+            layers[body] = world.getCollisionLayer(body);
+            if(!world.colliders[body]) continue;
+            //Current transforms are only rebuilt at the start of a step, so compute them from the state
+            const Eigen::Matrix4d transform = world.getColliderTransform(body);
+            if(const auto& compound = world.compound_colliders[body]){
+                for (const auto& child : compound->getChildren()) {
+                    add_piece(body, child.mesh, transform * child.local_transform);
+                }
+            }else{
+                add_piece(body, world.colliders[body], transform);
+            }
+        }
+        hierarchy = BoundsHierarchy(std::move(piece_bounds));
+    }
+
+    std::vector<QueryHit> SceneQuery::raycast(const RayQuery& query) const {
+        if(query.direction.isZero(0.0)) throw RuntimeException("Ray direction can not be zero.");
+        const Eigen::Vector3d direction = query.direction.normalized();
+        const Eigen::Vector3d inverse_direction = inverseDirection(direction);
+        double max_distance = query.max_distance;
+        std::vector<QueryHit> hits;
+        hierarchy.traverse([&](const Aabb& bounds){
+            return bounds.intersectsRay(query.origin, inverse_direction, max_distance);
+        }, [&](uint32_t piece_index){
+            const Piece& piece = pieces[piece_index];
+            if((layers[piece.body] & query.collision_mask) == 0) return true;
+            //The ray in mesh space. Distances along it stay the same, since the direction is transformed along with it.
+            const Eigen::Vector3d origin = transformPoint(piece.inverse, query.origin);
+            const Eigen::Vector3d local_direction = piece.inverse.topLeftCorner<3,3>() * direction;
+            const Eigen::Vector3d local_inverse_direction = inverseDirection(local_direction);
+            const auto k = calculateRayDimensions(local_direction);
+            const auto s = calculateRayShearConstraints(k, local_direction);
+            bool stop = false;
+            piece.triangles->traverse([&](const Aabb& bounds){
+                return bounds.intersectsRay(origin, local_inverse_direction, max_distance);
+            }, [&](uint32_t triangle){
+                const auto [a, b, c] = getTriangle(*piece.mesh, triangle);
+                Eigen::Vector4d hit_info;
+                if(!rayTriangleIntersection(a, b, c, origin, hit_info, k, s) || hit_info.w() > max_distance) return true;
+                //Normals transform with the inverse transpose
+                Eigen::Vector3d normal = (piece.inverse.topLeftCorner<3,3>().transpose() * (b - a).cross(c - a)).normalized();
+                if(normal.dot(direction) > 0.0) normal = -normal;
+                const QueryHit hit{handles[piece.body], hit_info.w(), query.origin + direction * hit_info.w(), normal};
+                switch (query.mode) {
+                    case RaycastMode::CLOSEST:
+                        hits = {hit};
+                        max_distance = hit.time;
+                        return true;
+                    case RaycastMode::ANY:
+                        hits = {hit};
+                        stop = true;
+                        return false;
+                    case RaycastMode::ALL:
+                        hits.push_back(hit);
+                        return true;
+                }
+                return true;
+            });
+            return !stop;
+        });
+        if(query.mode == RaycastMode::ALL){
+            std::sort(hits.begin(), hits.end(), [](const QueryHit& a, const QueryHit& b){
+                return a.time < b.time;
+            });
+        }
+        return hits;
+    }
+
+    template<typename PieceTest> std::vector<BodyHandle> SceneQuery::findOverlaps(const Aabb& bounds, uint32_t collision_mask, PieceTest&& piece_test) const {
+        std::vector<uint32_t> bodies;
+        hierarchy.traverse([&](const Aabb& node_bounds){
+            return node_bounds.overlaps(bounds);
+        }, [&](uint32_t piece_index){
+            const Piece& piece = pieces[piece_index];
+            if((layers[piece.body] & collision_mask) == 0) return true;
+            //A compound is found once, by whichever of its pieces touches first
+            if(std::find(bodies.begin(), bodies.end(), piece.body) != bodies.end()) return true;
+            if(piece_test(piece, bounds.transformed(piece.inverse))) bodies.push_back(piece.body);
+            return true;
+        });
+        std::sort(bodies.begin(), bodies.end());
+        std::vector<BodyHandle> found(bodies.size());
+        for (size_t i = 0; i < bodies.size(); ++i) {
+            found[i] = handles[bodies[i]];
+        }
+        return found;
+    }
+
+    std::vector<BodyHandle> SceneQuery::overlapBox(const Aabb& box, uint32_t collision_mask) const {
+        const Eigen::Vector3d center = (box.minimum + box.maximum) * 0.5;
+        const Eigen::Vector3d half_size = (box.maximum - box.minimum) * 0.5;
+        return findOverlaps(box, collision_mask, [&](const Piece& piece, const Aabb& local_bounds){
+            bool touching = false;
+            piece.triangles->traverse([&](const Aabb& bounds){
+                return bounds.overlaps(local_bounds);
+            }, [&](uint32_t triangle){
+                auto corners = getTriangle(*piece.mesh, triangle);
+                for (auto& corner : corners) corner = transformPoint(piece.transform, corner);
+                touching = triangleOverlapsBox(corners, center, half_size);
+                return !touching;
+            });
+            //No surface crosses the box, so it is either fully inside or fully outside
+            return touching || isInsideMesh(*piece.mesh, *piece.triangles, transformPoint(piece.inverse, center));
+        });
+    }
+
+    std::vector<BodyHandle> SceneQuery::overlapSphere(const Eigen::Vector3d& center, double radius, uint32_t collision_mask) const {
+        const Aabb bounds{center - Eigen::Vector3d::Constant(radius), center + Eigen::Vector3d::Constant(radius)};
+        return findOverlaps(bounds, collision_mask, [&](const Piece& piece, const Aabb& local_bounds){
+            bool touching = false;
+            piece.triangles->traverse([&](const Aabb& node_bounds){
+                return node_bounds.overlaps(local_bounds);
+            }, [&](uint32_t triangle){
+                auto [a, b, c] = getTriangle(*piece.mesh, triangle);
+                const Eigen::Vector3d closest = closestPointOnTriangle(center, transformPoint(piece.transform, a), transformPoint(piece.transform, b), transformPoint(piece.transform, c));
+                touching = (closest - center).squaredNorm() <= radius * radius;
+                return !touching;
+            });
+            return touching || isInsideMesh(*piece.mesh, *piece.triangles, transformPoint(piece.inverse, center));
+        });
+    }
+
+    std::vector<QueryHit> SceneQuery::sweep(const SweepQuery& query) const {
+        if(!query.shape) throw RuntimeException("Sweep has no shape.");
+        const Aabb bounds = sweptBounds(computeBounds(*query.shape), query.initial, query.final);
+        //Keep the earliest hits over all pieces, with the same time tolerance linearCCD uses
+        constexpr double time_delta = 0.00001;
+        std::vector<QueryHit> hits;
+        hierarchy.traverse([&](const Aabb& node_bounds){
+            return node_bounds.overlaps(bounds);
+        }, [&](uint32_t piece_index){
+            const Piece& piece = pieces[piece_index];
+            if((layers[piece.body] & query.collision_mask) == 0) return true;
+            std::vector<CCDHit> piece_hits = linearCCD(*query.shape, *piece.mesh, query.initial, piece.transform, query.final, piece.transform);
+            if(piece_hits.empty()) return true;
+            const double time = piece_hits.front().time;
+            if(!hits.empty() && time >= hits.front().time + time_delta) return true;
+            if(hits.empty() || time < hits.front().time - time_delta) hits.clear();
+            for (const auto& hit : piece_hits) {
+                hits.push_back({handles[piece.body], hit.time, hit.global_point, hit.normal_a_to_b});
+            }
+            return true;
+        });
+        return hits;
+    }
+
+    void SceneQuery::runBatch(size_t count, const std::function<void(size_t)>& query) {
+        if(parallel && count > 1){
+            if(!executor){
+                executor = std::make_shared<tf::Executor>();
+            }
+            tf::Taskflow taskflow;
+            taskflow.for_each_index(size_t(0), count, size_t(1), [&](size_t index){
+                query(index);
+            });
+            executor->run(taskflow).wait();
+        }else{
+            for (size_t index = 0; index < count; ++index) {
+                query(index);
+            }
+        }
+    }
+
+    std::vector<std::vector<QueryHit>> SceneQuery::raycast(const std::vector<RayQuery>& queries) {
+        ENGIGRAPH_TRACE_SCOPE("SceneQuery raycast batch");
+        //Checked up front, so nothing throws on a worker thread
+        for (const auto& query : queries) {
+            if(query.direction.isZero(0.0)) throw RuntimeException("Ray direction can not be zero.");
+        }
+        std::vector<std::vector<QueryHit>> results(queries.size());
+        runBatch(queries.size(), [&](size_t index){
+            results[index] = raycast(queries[index]);
+        });
+        return results;
+    }
+
+    std::vector<std::vector<BodyHandle>> SceneQuery::overlap(const std::vector<OverlapQuery>& queries) {
+        ENGIGRAPH_TRACE_SCOPE("SceneQuery overlap batch");
+        std::vector<std::vector<BodyHandle>> results(queries.size());
+        runBatch(queries.size(), [&](size_t index){
+            const OverlapQuery& query = queries[index];
+            results[index] = query.shape == OverlapShape::BOX ? overlapBox(query.box, query.collision_mask)
+                                                              : overlapSphere(query.center, query.radius, query.collision_mask);
+        });
+        return results;
+    }
+
+    std::vector<std::vector<QueryHit>> SceneQuery::sweep(const std::vector<SweepQuery>& queries) {
+        ENGIGRAPH_TRACE_SCOPE("SceneQuery sweep batch");
+        for (const auto& query : queries) {
+            if(!query.shape) throw RuntimeException("Sweep has no shape.");
+        }
+        std::vector<std::vector<QueryHit>> results(queries.size());
+        runBatch(queries.size(), [&](size_t index){
+            results[index] = sweep(queries[index]);
+        });
+        return results;
+    }
+
+} // EngiGraph
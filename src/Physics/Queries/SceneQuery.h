@@ -0,0 +1,235 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <taskflow/taskflow.hpp>
+#include "src/Geometry/BoundsHierarchy.h"
+#include "src/Physics/World/PhysicsWorld.h"
+
+namespace EngiGraph {
+
+    /**
+     * Which hits of a ray to report.
+     */
+    enum class RaycastMode {
+        /**
+         * Only the nearest hit.
+         */
+        CLOSEST,
+        /**
+         * The first hit found, which is not necessarily the nearest. Cheapest, for line of sight checks.
+         */
+        ANY,
+        /**
+         * Every triangle the ray crosses, nearest first.
+         */
+        ALL
+    };
+
+    /**
+     * A ray cast into the world.
+     */
+    struct RayQuery {
+        Eigen::Vector3d origin = {0,0,0};
+        /**
+         * Does not need to be normalized, but can not be zero.
+         */
+        Eigen::Vector3d direction = {0,0,-1};
+        /**
+         * Length of the ray.
+         */
+        double max_distance = std::numeric_limits<double>::infinity();
+        RaycastMode mode = RaycastMode::CLOSEST;
+        /**
+         * Only bodies with a collision layer in this mask are hit.
+         */
+        uint32_t collision_mask = 0xFFFFFFFF;
+    };
+
+    /**
+     * Shape of an overlap query.
+     */
+    enum class OverlapShape {
+        BOX,
+        SPHERE
+    };
+
+    /**
+     * A volume to find the bodies touching.
+     */
+    struct OverlapQuery {
+        OverlapShape shape = OverlapShape::BOX;
+        /**
+         * World space box, for BOX.
+         */
+        Aabb box{};
+        /**
+         * For SPHERE.
+         */
+        Eigen::Vector3d center = {0,0,0};
+        double radius = 0.0;
+        /**
+         * Only bodies with a collision layer in this mask are found.
+         */
+        uint32_t collision_mask = 0xFFFFFFFF;
+    };
+
+    /**
+     * A mesh moved through the world, to find what it would hit first.
+     */
+    struct SweepQuery {
+        std::shared_ptr<const Mesh> shape{};
+        /**
+         * Transforms of the shape at the start and end of the sweep.
+         */
+        Eigen::Matrix4d initial = Eigen::Matrix4d::Identity();
+        Eigen::Matrix4d final = Eigen::Matrix4d::Identity();
+        /**
+         * Only bodies with a collision layer in this mask are hit.
+         */
+        uint32_t collision_mask = 0xFFFFFFFF;
+    };
+
+    /**
+     * Where a ray or sweep hit a body.
+     */
+    struct QueryHit {
+        BodyHandle body{};
+        /**
+         * Distance along the ray, or for sweeps, the fraction of the motion from initial to final, like CCDHit::time.
+         */
+        double time = 0.0;
+        Eigen::Vector3d global_point = {0,0,0};
+        /**
+         * For rays, the surface normal facing the ray. For sweeps, the contact normal from the shape to the body.
+         */
+        Eigen::Vector3d normal = {0,0,0};
+    };
+
+    /**
+     * Raycasts, overlap tests and sweeps against the bodies of a world.
+     * @details update() takes a copy of the colliders and transforms of a world, so queries see the world as it was then and can run
+     * while the world steps. Every collider piece, either a whole body or a child of a compound, is put in a hierarchy by its world bounds.
+     * Inside a piece, triangles are found with the hierarchy of its mesh from ColliderRegistry::getTriangleHierarchy(), shared between
+     * every body using the mesh.
+     * @details Single queries are const and can be run from several threads. Batches of queries are spread over threads, and each query
+     * gives the same result as when run alone.
+     */
+    class SceneQuery {
+    public:
+        /**
+         * Run batches on multiple threads.
+         */
+        bool parallel = true;
+
+        /**
+         * Copy the current state of a world.
+         * @details Bodies without a collider, and height field bodies, are never found.
+         * @param world World to query.
+         */
+        void update(const PhysicsWorld& world);
+
+        /**
+         * Cast a ray.
+         * @param query Ray.
+         * @return Hits ordered by distance. At most one for CLOSEST and ANY.
+         * @throws RuntimeException Zero direction.
+         */
+        [[nodiscard]] std::vector<QueryHit> raycast(const RayQuery& query) const;
+
+        /**
+         * Find the bodies touching a world space box, either crossing its surface or containing it.
+         * @return Handles ordered by dense index at the time of update().
+         */
+        [[nodiscard]] std::vector<BodyHandle> overlapBox(const Aabb& box, uint32_t collision_mask = 0xFFFFFFFF) const;
+
+        /**
+         * Find the bodies touching a sphere, either crossing its surface or containing it.
+         * @return Handles ordered by dense index at the time of update().
+         */
+        [[nodiscard]] std::vector<BodyHandle> overlapSphere(const Eigen::Vector3d& center, double radius, uint32_t collision_mask = 0xFFFFFFFF) const;
+
+        /**
+         * Sweep a mesh with linearCCD() against the bodies its motion can reach.
+         * @param query Shape and motion.
+         * @return Earliest hits. Multiple if they happen at the same time, like linearCCD().
+         * @throws RuntimeException No shape.
+         */
+        [[nodiscard]] std::vector<QueryHit> sweep(const SweepQuery& query) const;
+
+        /**
+         * Cast a batch of rays.
+         * @return Hits of each ray, in query order.
+         * @throws RuntimeException A ray has a zero direction.
+         */
+        std::vector<std::vector<QueryHit>> raycast(const std::vector<RayQuery>& queries);
+
+        /**
+         * Run a batch of overlap queries.
+         * @return Bodies found by each query, in query order.
+         */
+        std::vector<std::vector<BodyHandle>> overlap(const std::vector<OverlapQuery>& queries);
+
+        /**
+         * Run a batch of sweeps.
+         * @return Hits of each sweep, in query order.
+         * @throws RuntimeException A sweep has no shape.
+         */
+        std::vector<std::vector<QueryHit>> sweep(const std::vector<SweepQuery>& queries);
+
+        /**
+         * Get the number of collider pieces found by the last update().
+         */
+        [[nodiscard]] size_t getPieceCount() const {
+            return pieces.size();
+        }
+
+    private:
+        /**
+         * A mesh placed in the world, either a whole body or a child of a compound.
+         */
+        struct Piece {
+            uint32_t body = 0;
+            std::shared_ptr<const Mesh> mesh{};
+            std::shared_ptr<const BoundsHierarchy> triangles{};
+            /**
+             * Mesh to world.
+             */
+            Eigen::Matrix4d transform = Eigen::Matrix4d::Identity();
+            Eigen::Matrix4d inverse = Eigen::Matrix4d::Identity();
+        };
+
+        /**
+         * Body handles and layers, by dense index at the time of update().
+         */
+        std::vector<BodyHandle> handles{};
+        std::vector<uint32_t> layers{};
+        std::vector<Piece> pieces{};
+        /**
+         * Pieces by world bounds.
+         */
+        BoundsHierarchy hierarchy{};
+        /**
+         * Created on the first parallel batch.
+         */
+        std::shared_ptr<tf::Executor> executor{};
+
+        /**
+         * Find the bodies touching a query, checking each candidate piece with a test in its mesh space.
+         */
+        template<typename PieceTest> std::vector<BodyHandle> findOverlaps(const Aabb& bounds, uint32_t collision_mask, PieceTest&& piece_test) const;
+
+        /**
+         * Run a query for each index, spread over threads if enabled.
+         */
+        void runBatch(size_t count, const std::function<void(size_t)>& query);
+    };
+
+} // EngiGraph
@@ -3,6 +3,211 @@
 //
 
 #include "ToiSolver.h"
+#include <algorithm>
+#include <iostream>
+#include "src/Profiling/Trace.h"
 
 namespace EngiGraph {
-} // EngiGraph
\ No newline at end of file
+
+    bool TOISolver::isPairAsleep(uint32_t body_a, uint32_t body_b) const {
+        //Dynamic bodies without gravity are static geometry here, and kinematic bodies only move themselves
+        auto is_resting = [&](uint32_t body){
+            return world.hasFlag(body, BODY_FLAG_SLEEPING) || !(world.hasFlag(body, BODY_FLAG_GRAVITY) || world.hasFlag(body, BODY_FLAG_KINEMATIC));
+        };
+        return !world.canPairCollide(body_a, body_b) || (is_resting(body_a) && is_resting(body_b)) || !bounds.overlaps(body_a, body_b);
+    }
+
+    void TOISolver::linkIslands(IslandGraph& islands, uint32_t body_a, uint32_t body_b, const std::vector<CCDHit>& pair_hits) const {
+        if(pair_hits.empty() || !world.hasFlag(body_a, BODY_FLAG_GRAVITY) || !world.hasFlag(body_b, BODY_FLAG_GRAVITY)) return;
+        islands.link(body_a, body_b);
+    }
+
+    std::vector<BodyPair> TOISolver::findPairs() const {
+        const uint32_t body_count = world.getBodyCount();
+        std::vector<BodyPair> pairs;
+        //only go through each pair once
+        for (uint32_t body_a = 0; body_a < body_count; ++body_a) {
+            for (uint32_t body_b = body_a+1; body_b < body_count; ++body_b) {
+                if(!isPairAsleep(body_a, body_b)) pairs.push_back({body_a, body_b});
+            }
+        }
+        return pairs;
+    }
+
+    void TOISolver::findHits(IslandGraph& islands, std::vector<Hit>& hits) {
+        ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_COLLISION]);
+        bounds.update(world);
+        const std::vector<BodyPair> pairs = findPairs();
+        auto pair_hits = narrow_phase.collide(world, bounds, pairs);
+        //Combined in pair order, whatever thread found them
+        for (size_t pair = 0; pair < pairs.size(); ++pair) {
+            const auto& [body_a, body_b] = pairs[pair];
+            const auto& sub_hits = pair_hits[pair];
+            profile.pairs_tested++;
+            profile.hits += sub_hits.size();
+            linkIslands(islands, body_a, body_b, sub_hits);
+            //    if(sub_hits && sub_hits->time < 1.0f){
+            //todo what the heck this is passing back negative 0? This should not be passing back anything. It might have to do when one of the bodies is at rest. It only happens when the bodies are in line.
+            //    Eigen::Vector3d normal_a_to_b = sub_hits->normal_a_to_b;
+            //    hits.push_back(Hit{sub_hits->time,normal_a_to_b,sub_hits->global_point,body_a,body_b});
+            //   }
+        }
+        //sort by time in ascending order
+        std::sort(hits.begin(), hits.end(), [](const TOISolver::Hit& a, const TOISolver::Hit& b) {return a.time < b.time;});
+    }
+
+    void TOISolver::setThreadCount(uint32_t thread_count) {
+        auto executor = thread_count == 0 ? std::make_shared<tf::Executor>() : std::make_shared<tf::Executor>(thread_count);
+        narrow_phase.setExecutor(executor);
+        contact_solver.setExecutor(executor);
+    }
+
+    void TOISolver::step(double delta_time) {
+        ENGIGRAPH_TRACE_SCOPE("TOISolver::step");
+        profile = StepProfile{};
+        ScopedTimer step_timer(profile.total_seconds);
+        if(integration_mode == IntegrationMode::SPECULATIVE){
+            stepSpeculative(delta_time);
+        }else{
+            stepTimeOfImpact(delta_time);
+        }
+    }
+
+    void TOISolver::stepSpeculative(double delta_time) {
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_INTEGRATE_FORCES]);
+            world.integrateForces(delta_time, gravity);
+            world.updateCurrentTransforms();
+            world.updateFutureTransforms(delta_time);
+        }
+
+        const uint32_t body_count = world.getBodyCount();
+        IslandGraph islands(body_count);
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_CONTACTS]);
+            manifolds.refresh(world);
+        }
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_COLLISION]);
+            bounds.update(world);
+        }
+        const std::vector<BodyPair> pairs = findPairs();
+        std::vector<std::vector<CCDHit>> hits;
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_COLLISION]);
+            hits = narrow_phase.collide(world, bounds, pairs);
+        }
+        //Hits are added in pair order, whatever thread found them
+        for (size_t pair = 0; pair < pairs.size(); ++pair) {
+            const auto& [body_a, body_b] = pairs[pair];
+            const auto& pair_hits = hits[pair];
+            profile.pairs_tested++;
+            profile.hits += pair_hits.size();
+            if(pair_hits.empty()) continue;
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_CONTACTS]);
+            linkIslands(islands, body_a, body_b, pair_hits);
+            world.wakeOnImpact(body_a, body_b, sleep_settings);
+            manifolds.addHits(world, body_a, body_b, pair_hits);
+        }
+        std::vector<Contact> contacts;
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_CONTACTS]);
+            contacts = manifolds.getContacts(world);
+        }
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_CONTACT_SOLVE]);
+            profile.contacts = contacts.size();
+            profile.solver_iterations = contact_solver.solve(world, contacts, delta_time).iterations;
+            manifolds.storeImpulses(world, contacts);
+        }
+        std::vector<uint8_t> solved(body_count, 0);
+        for (const auto& contact : contacts) {
+            solved[contact.body_a] = 1;
+            solved[contact.body_b] = 1;
+        }
+        hit_advance.integrate(world, bounds, narrow_phase, manifolds, sleep_settings, solved, delta_time, profile);
+        ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_SLEEP]);
+        world.updateSleep(islands, delta_time, sleep_settings);
+    }
+
+    void TOISolver::stepTimeOfImpact(double delta_time) {
+        //force integration
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_INTEGRATE_FORCES]);
+            world.integrateForces(delta_time, gravity);
+            world.updateCurrentTransforms();
+            world.updateFutureTransforms(delta_time);
+        }
+
+        double time_remaining = delta_time;
+
+        std::vector<Hit> hits{};
+        IslandGraph islands(world.getBodyCount());
+        findHits(islands, hits);
+
+        //todo fix wierd bug where the two spheres seem to be linked for no reason. Moving one affects the other in drastic ways despite not touching nor colliding.
+        //It is almost like on collision with the cube, they get mixed up sometimes. For example, by default, the top sphere seems to react to the bottom sphere hitting the box.
+        //Or speeding up the top sphere, causes the bottom sphere to glitch really fast when it hits the box.
+        //This is clearly an implementation bug, as in theory these should not be affecting each other at all. Potentially some indices are getting mixed up somewhere?
+
+        int i = 0;
+        while (!hits.empty()){
+            const double rollback_margin = time_remaining/100.0;
+            i++;
+            profile.toi_iterations++;
+            if(i > 1000) {
+                std::cout << "Warning: not able to properly resolve collision! \n";
+                break;
+            }
+
+            double t_last = hits[0].time;
+            //careful this is not working right since the negatives are flipping
+            {
+                ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_CONTACT_SOLVE]);
+                profile.solver_iterations += 10;
+                for (int k = 0; k < 10; ++k) { //velocity solve iters
+                    for (const auto& earliest : hits) {
+                        if(abs(earliest.time - t_last) > rollback_margin/2.0){
+                            break;
+                        }
+                        if(world.hasFlag(earliest.a, BODY_FLAG_GRAVITY)){
+                            Eigen::Vector3d velocity = world.getVelocityAtPoint(earliest.a,earliest.point);
+                            velocity *= -1.0;
+                            world.addVelocityAtPoint(earliest.a,earliest.point,velocity);
+                        }
+                        if(world.hasFlag(earliest.b, BODY_FLAG_GRAVITY)){
+                            Eigen::Vector3d velocity = world.getVelocityAtPoint(earliest.b,earliest.point);
+                            velocity *= -1.0;
+                            world.addVelocityAtPoint(earliest.b,earliest.point,velocity);
+                        }
+                    }
+                }
+            }
+
+            double current_time = t_last * time_remaining - rollback_margin;
+
+            time_remaining -= current_time;
+            if(time_remaining <= 0.0){
+                time_remaining = 0.0;
+                break;
+            }
+
+            {
+                ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_INTEGRATE_POSITIONS]);
+                world.integratePositions(current_time);
+                world.updateCurrentTransforms();
+                world.updateFutureTransforms(time_remaining);
+            }
+
+            hits.clear();
+            findHits(islands, hits);
+        }
+
+        //todo Resolve collisions using normals, apply friction and new velocities
+        //todo resolve multiple same time objects at once, and get multiple same time collision points
+
+        ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_SLEEP]);
+        world.updateSleep(islands, delta_time, sleep_settings);
+    }
+
+} // EngiGraph
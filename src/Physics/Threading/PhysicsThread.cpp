@@ -0,0 +1,114 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "PhysicsThread.h"
+#include <algorithm>
+#include "src/Profiling/Trace.h"
+
+namespace EngiGraph {
+
+    PhysicsThread::PhysicsThread(std::function<void(double)> step, PhysicsWorld& world, double delta_time, const StepProfile* profile) : step_function(std::move(step)), world(world), profile(profile), delta_time(delta_time) {
+        thread = std::thread(&PhysicsThread::run, this);
+    }
+
+    PhysicsThread::~PhysicsThread() {
+        stop_requested.store(true);
+        thread.join();
+    }
+
+    void PhysicsThread::setRunning(bool is_running) {
+        running.store(is_running);
+    }
+
+    void PhysicsThread::requestStep() {
+        requested_steps.fetch_add(1);
+    }
+
+    void PhysicsThread::setDeltaTime(double new_delta_time) {
+        delta_time.store(new_delta_time);
+    }
+
+    bool PhysicsThread::updateSnapshots() {
+        if(!snapshots.consume()) return false;
+        std::swap(previous_snapshot, current_snapshot);
+        current_snapshot = snapshots.getReadBuffer();
+        //Edits republish without stepping, those should snap rather than blend
+        if(previous_snapshot.step == current_snapshot.step) previous_snapshot = current_snapshot;
+        //Profiles gather until taken, so steps of snapshots replaced before being read are still seen
+        current_snapshot.step_profiles.clear();
+        std::lock_guard<std::mutex> lock(profile_mutex);
+        current_snapshot.step_profiles.swap(published_profiles);
+        return true;
+    }
+
+    double PhysicsThread::getInterpolationFactor(std::chrono::steady_clock::time_point now) const {
+        if(current_snapshot.delta_time <= 0.0) return 1.0;
+        double since_capture = std::chrono::duration<double>(now - current_snapshot.capture_time).count();
+        return std::clamp(since_capture / current_snapshot.delta_time, 0.0, 1.0);
+    }
+
+    void PhysicsThread::publish(double step_delta_time) {
+        TransformSnapshot& snapshot = snapshots.getWriteBuffer();
+        snapshot.capture(world);
+        snapshot.step = step_count.load();
+        snapshot.delta_time = step_delta_time;
+        snapshot.capture_time = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(profile_mutex);
+            published_profiles.insert(published_profiles.end(), pending_profiles.begin(), pending_profiles.end());
+        }
+        pending_profiles.clear();
+        snapshots.publish();
+    }
+
+    void PhysicsThread::step(double step_delta_time) {
+        step_function(step_delta_time);
+        if(profile != nullptr) pending_profiles.push_back(*profile);
+    }
+
+    void PhysicsThread::run() {
+        setTraceThreadName("Physics");
+        using Clock = std::chrono::steady_clock;
+        auto last_time = Clock::now();
+        double accumulator = 0.0;
+        while (!stop_requested.load()) {
+            const auto now = Clock::now();
+            const double elapsed = std::chrono::duration<double>(now - last_time).count();
+            last_time = now;
+            const double step_delta_time = delta_time.load();
+            const uint32_t max_steps = max_steps_per_update.load();
+            if(running.load()){
+                //Drop time that could never be caught up on
+                accumulator = std::min(accumulator + elapsed, step_delta_time * max_steps);
+            }else{
+                accumulator = 0.0;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(world_mutex);
+                uint32_t steps = 0;
+                while (accumulator >= step_delta_time && steps < max_steps) {
+                    step(step_delta_time);
+                    accumulator -= step_delta_time;
+                    steps++;
+                }
+                uint32_t requested = requested_steps.exchange(0);
+                for (uint32_t i = 0; i < requested; ++i) {
+                    step(step_delta_time);
+                }
+                step_count.fetch_add(steps + requested);
+                const bool edited = republish.exchange(false);
+                if(steps + requested > 0 || edited){
+                    publish(step_delta_time);
+                }
+            }
+
+            //Sleep until the next step is due, waking often enough to notice requests
+            double wait = running.load() ? step_delta_time - accumulator : step_delta_time;
+            wait = std::clamp(wait, 0.0, 0.001);
+            std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+        }
+    }
+
+} // EngiGraph
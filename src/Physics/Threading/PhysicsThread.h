@@ -0,0 +1,167 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "src/Physics/Threading/TripleBuffer.h"
+#include "src/Physics/Threading/TransformSnapshot.h"
+
+namespace EngiGraph {
+
+    /**
+     * Runs a solver on its own thread at a fixed time step, independent of the frame rate.
+     * @details Wall clock time is collected in an accumulator and spent in fixed steps.
+     * After steps, the body state is published as a TransformSnapshot through a lock-free triple buffer.
+     * Step profiles are handed over separately, so none are lost when a snapshot is replaced before it is read.
+     * Readers blend the last two snapshots, so motion stays smooth when frames and steps do not line up.
+     * The world may only be changed from other threads through edit().
+     */
+    class PhysicsThread {
+    public:
+        /**
+         * Create a stopped physics thread.
+         * @param step Function to step the solver by a delta time.
+         * @param world World stepped by the solver.
+         * @param delta_time Fixed step length in seconds.
+         * @param profile Profile the step function writes, copied into snapshots after each step. May be null.
+         */
+        PhysicsThread(std::function<void(double)> step, PhysicsWorld& world, double delta_time, const StepProfile* profile = nullptr);
+
+        ~PhysicsThread();
+
+        PhysicsThread(const PhysicsThread&) = delete;
+        PhysicsThread& operator=(const PhysicsThread&) = delete;
+
+        /**
+         * Start or stop stepping in real time. Stopping drops time left in the accumulator.
+         */
+        void setRunning(bool running);
+
+        [[nodiscard]] bool isRunning() const {
+            return running.load();
+        }
+
+        /**
+         * Take a single step, even when not running.
+         */
+        void requestStep();
+
+        /**
+         * Set the fixed step length in seconds.
+         */
+        void setDeltaTime(double delta_time);
+
+        [[nodiscard]] double getDeltaTime() const {
+            return delta_time.load();
+        }
+
+        /**
+         * Limit on steps per update, so a slow step can not make the simulation fall further and further behind.
+         */
+        void setMaxStepsPerUpdate(uint32_t steps) {
+            max_steps_per_update.store(steps);
+        }
+
+        /**
+         * Change the world or solver while the physics thread is between steps.
+         * @details Blocks until the current step is done. A new snapshot is published after the change.
+         * @param function Function called with the world locked.
+         * @return Result of the function.
+         */
+        template<typename F> auto edit(F&& function) -> decltype(function()) {
+            std::lock_guard<std::mutex> lock(world_mutex);
+            republish.store(true);
+            return function();
+        }
+
+        /**
+         * Take the newest published snapshot, keeping the one before it for interpolation. Reading thread only.
+         * @return True if there was a new snapshot.
+         */
+        bool updateSnapshots();
+
+        /**
+         * Get the newest snapshot taken by updateSnapshots().
+         */
+        [[nodiscard]] const TransformSnapshot& getSnapshot() const {
+            return current_snapshot;
+        }
+
+        /**
+         * Get the snapshot before the newest one.
+         */
+        [[nodiscard]] const TransformSnapshot& getPreviousSnapshot() const {
+            return previous_snapshot;
+        }
+
+        /**
+         * Get how far to blend from the previous snapshot to the newest one.
+         * @details Rendering lags one step behind, sliding from the previous to the newest state over the step length.
+         * @param now Time of the frame being drawn.
+         * @return Value from 0 to 1.
+         */
+        [[nodiscard]] double getInterpolationFactor(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()) const;
+
+        /**
+         * Get the number of steps taken.
+         */
+        [[nodiscard]] uint64_t getStepCount() const {
+            return step_count.load();
+        }
+
+    private:
+        std::function<void(double)> step_function;
+        PhysicsWorld& world;
+        const StepProfile* profile;
+        /**
+         * Profiles of steps not published yet. Physics thread only.
+         */
+        std::vector<StepProfile> pending_profiles{};
+        /**
+         * Profiles of published steps the reader has not taken yet. Guarded by profile_mutex.
+         */
+        std::vector<StepProfile> published_profiles{};
+        std::mutex profile_mutex;
+
+        std::atomic<double> delta_time;
+        std::atomic<bool> running{false};
+        std::atomic<uint32_t> requested_steps{0};
+        std::atomic<uint32_t> max_steps_per_update{8};
+        std::atomic<bool> republish{true};
+        std::atomic<bool> stop_requested{false};
+        std::atomic<uint64_t> step_count{0};
+
+        /**
+         * Held while stepping, and while the world is edited.
+         */
+        std::mutex world_mutex;
+        TripleBuffer<TransformSnapshot> snapshots{};
+
+        //Owned by the reading thread
+        TransformSnapshot current_snapshot{};
+        TransformSnapshot previous_snapshot{};
+
+        std::thread thread;
+
+        /**
+         * Physics thread loop.
+         */
+        void run();
+
+        /**
+         * Take one step. Physics thread only, with the world locked.
+         */
+        void step(double step_delta_time);
+
+        /**
+         * Capture and publish the world state. Physics thread only, with the world locked.
+         */
+        void publish(double step_delta_time);
+    };
+
+} // EngiGraph
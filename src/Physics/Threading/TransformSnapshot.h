@@ -0,0 +1,115 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <chrono>
+#include <vector>
+#include "src/Physics/World/PhysicsWorld.h"
+#include "src/Profiling/StepProfile.h"
+
+namespace EngiGraph {
+
+    /**
+     * Copy of the body state of a world after a step, for reading on other threads.
+     */
+    struct TransformSnapshot {
+        static constexpr uint32_t NOT_FOUND = 0xFFFFFFFF;
+
+        /**
+         * Number of steps taken when the snapshot was captured.
+         */
+        uint64_t step = 0;
+        /**
+         * Length of the step that produced the snapshot.
+         */
+        double delta_time = 0.0;
+        /**
+         * When the snapshot was captured.
+         */
+        std::chrono::steady_clock::time_point capture_time{};
+
+        /**
+         * Profiles of the steps taken since the last snapshot the reader took.
+         * @details Filled by PhysicsThread::updateSnapshots(), so profiles of snapshots replaced before being read are kept.
+         */
+        std::vector<StepProfile> step_profiles{};
+
+        //All indexed like the world's dense indices at capture time
+        std::vector<BodyHandle> handles{};
+        std::vector<Eigen::Vector3d> positions{};
+        std::vector<Eigen::Quaterniond> rotations{};
+        std::vector<Eigen::Vector3d> velocities{};
+        std::vector<Eigen::Vector3d> angular_velocities{};
+        std::vector<Eigen::Vector3d> forces{};
+        std::vector<uint32_t> flags{};
+
+        /**
+         * Copy the body state of a world, reusing existing allocations.
+         */
+        void capture(const PhysicsWorld& world) {
+            const uint32_t count = world.getBodyCount();
+            handles.resize(count);
+            positions.resize(count);
+            rotations.resize(count);
+            velocities.resize(count);
+            angular_velocities.resize(count);
+            forces.resize(count);
+            flags.resize(count);
+            slot_to_index.assign(slot_to_index.size(), NOT_FOUND);
+            for (uint32_t j = 0; j < count; ++j) {
+                handles[j] = world.getHandle(j);
+                positions[j] = world.getPosition(j);
+                rotations[j] = world.getRotation(j);
+                velocities[j] = world.getVelocity(j);
+                angular_velocities[j] = world.getAngularVelocity(j);
+                forces[j] = world.getForce(j);
+                flags[j] = world.states.flags[j];
+                if(handles[j].slot >= slot_to_index.size()) slot_to_index.resize(handles[j].slot + 1, NOT_FOUND);
+                slot_to_index[handles[j].slot] = j;
+            }
+        }
+
+        /**
+         * Get the number of bodies.
+         */
+        [[nodiscard]] uint32_t getBodyCount() const {
+            return (uint32_t)handles.size();
+        }
+
+        /**
+         * Find the index of a body in this snapshot.
+         * @return NOT_FOUND if the body did not exist at capture time.
+         */
+        [[nodiscard]] uint32_t find(BodyHandle handle) const {
+            if(handle.slot >= slot_to_index.size()) return NOT_FOUND;
+            uint32_t index = slot_to_index[handle.slot];
+            return (index != NOT_FOUND && handles[index] == handle) ? index : NOT_FOUND;
+        }
+
+        /**
+         * Get the transform of a body blended between an older snapshot and this one.
+         * @param previous Older snapshot. Bodies missing from it are not blended.
+         * @param index Index of the body in this snapshot.
+         * @param alpha 0 for the previous state, 1 for this state.
+         */
+        [[nodiscard]] Eigen::Matrix4d getInterpolatedTransform(const TransformSnapshot& previous, uint32_t index, double alpha) const {
+            Eigen::Vector3d position = positions[index];
+            Eigen::Quaterniond rotation = rotations[index];
+            uint32_t previous_index = previous.find(handles[index]);
+            if(previous_index != NOT_FOUND){
+                position = previous.positions[previous_index] + alpha * (position - previous.positions[previous_index]);
+                rotation = previous.rotations[previous_index].slerp(alpha, rotation);
+            }
+            Eigen::Transform<double,3,Eigen::Affine> transform = Eigen::Transform<double,3,Eigen::Affine>::Identity();
+            transform.translate(position).rotate(rotation.normalized());
+            return transform.matrix();
+        }
+
+    private:
+        std::vector<uint32_t> slot_to_index{};
+    };
+
+} // EngiGraph
@@ -0,0 +1,68 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace EngiGraph {
+
+    /**
+     * Lock-free handoff of values from one producer thread to one consumer thread.
+     * @details The producer writes into its own buffer and publishes it by swapping it with the shared middle buffer.
+     * The consumer swaps the middle buffer with its own when something new was published.
+     * Neither side ever waits for the other, and the consumer always gets the most recently published value.
+     * @tparam T Value type. Buffers are reused, so large values keep their allocations.
+     */
+    template<typename T> class TripleBuffer {
+    public:
+        /**
+         * Get the buffer to fill before publish(). Producer thread only.
+         */
+        T& getWriteBuffer() {
+            return buffers[write_index];
+        }
+
+        /**
+         * Hand the write buffer to the consumer. Producer thread only.
+         */
+        void publish() {
+            uint8_t old_middle = middle.exchange(write_index | NEW_DATA, std::memory_order_acq_rel);
+            write_index = old_middle & INDEX_MASK;
+        }
+
+        /**
+         * Take the most recently published buffer, if there is a new one. Consumer thread only.
+         * @return True if the read buffer changed.
+         */
+        bool consume() {
+            if((middle.load(std::memory_order_acquire) & NEW_DATA) == 0) return false;
+            uint8_t old_middle = middle.exchange(read_index, std::memory_order_acq_rel);
+            read_index = old_middle & INDEX_MASK;
+            return true;
+        }
+
+        /**
+         * Get the last consumed buffer. Consumer thread only.
+         */
+        [[nodiscard]] const T& getReadBuffer() const {
+            return buffers[read_index];
+        }
+
+    private:
+        static constexpr uint8_t INDEX_MASK = 0x3;
+        static constexpr uint8_t NEW_DATA = 0x4;
+
+        std::array<T, 3> buffers{};
+        /**
+         * Index of the shared buffer, with NEW_DATA set if it was published and not consumed yet.
+         */
+        std::atomic<uint8_t> middle{1};
+        uint8_t write_index = 0;
+        uint8_t read_index = 2;
+    };
+
+} // EngiGraph
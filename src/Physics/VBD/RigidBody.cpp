@@ -3,6 +3,15 @@
 //
 
 #include "RigidBody.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
 
 namespace EngiGraph {
-} // EngiGraph
\ No newline at end of file
+
+    RigidBody::RigidBody(std::shared_ptr<Mesh> collider, double density, double thickness, const Eigen::Vector3d& scale) : collider(collider) {
+        MassProperties properties = ColliderRegistry::getShared().getMassProperties(collider, MassModel::SHELL, density * thickness, scale);
+        mass = properties.mass;
+        center_of_mass = properties.center_of_mass;
+        inertia_tensor = properties.getInertiaTensor();
+    }
+
+} // EngiGraph
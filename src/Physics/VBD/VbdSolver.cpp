@@ -3,6 +3,112 @@
 //
 
 #include "VbdSolver.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Profiling/Trace.h"
 
 namespace EngiGraph {
-} // EngiGraph
\ No newline at end of file
+
+    BodyHandle VBDSolver::addBox(double mass, const Eigen::Vector3d& dimensions, const Eigen::Vector3d& position) {
+        BodyDescription description{};
+        //Every box shares the unit box, sized by its scale
+        description.collider = ColliderRegistry::getShared().getBox();
+        description.scale = dimensions;
+        description.position = position;
+        description.mass = mass;
+        description.gravity = false; //Forces are set per body
+        description.inertia_tensor = Eigen::Matrix3d::Zero();
+        description.inertia_tensor.coeffRef(0,0) = 1.0/12.0 * mass * (dimensions.y() * dimensions.y() + dimensions.z() * dimensions.z());
+        description.inertia_tensor.coeffRef(1,1) = 1.0/12.0 * mass * (dimensions.x() * dimensions.x() + dimensions.z() * dimensions.z());
+        description.inertia_tensor.coeffRef(2,2) = 1.0/12.0 * mass * (dimensions.x() * dimensions.x() + dimensions.y() * dimensions.y());
+        return world.createBody(description);
+    }
+
+    void VBDSolver::setThreadCount(uint32_t thread_count) {
+        auto executor = thread_count == 0 ? std::make_shared<tf::Executor>() : std::make_shared<tf::Executor>(thread_count);
+        narrow_phase.setExecutor(executor);
+        contact_solver.setExecutor(executor);
+    }
+
+    void VBDSolver::step(double delta_time) {
+        ENGIGRAPH_TRACE_SCOPE("VBDSolver::step");
+        profile = StepProfile{};
+        ScopedTimer step_timer(profile.total_seconds);
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_INTEGRATE_FORCES]);
+            world.integrateForces(delta_time, gravity);
+            world.updateCurrentTransforms();
+            world.updateFutureTransforms(delta_time);
+        }
+
+        //todo investigate nans propagating with scaled objects
+
+        const uint32_t body_count = world.getBodyCount();
+        IslandGraph islands(body_count);
+
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_CONTACTS]);
+            manifolds.refresh(world);
+        }
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_COLLISION]);
+            bounds.update(world);
+        }
+        //Bodies that can not move into each other, or are too far apart, can not hit
+        auto can_hit = [&](uint32_t j, uint32_t k){
+            return world.canPairCollide(j, k) && bounds.overlaps(j, k);
+        };
+        std::vector<BodyPair> pairs;
+        for (uint32_t j = 0; j < body_count; ++j) {
+            for (uint32_t k = j + 1; k < body_count; ++k) {
+                if(can_hit(j, k)) pairs.push_back({j, k});
+            }
+        }
+        std::vector<std::vector<CCDHit>> hits;
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_COLLISION]);
+            hits = narrow_phase.collide(world, bounds, pairs);
+        }
+        //Hits are added in pair order whatever thread found them. Waking a body can let later pairs collide, which are collided here as if stepping through the pairs one by one.
+        size_t next_pair = 0;
+        for (uint32_t j = 0; j < body_count; ++j) {
+            for (uint32_t k = j + 1; k < body_count; ++k) {
+                if(!can_hit(j, k)) continue;
+                std::vector<CCDHit> pair_hits;
+                if(next_pair < pairs.size() && pairs[next_pair] == BodyPair{j, k}){
+                    pair_hits = std::move(hits[next_pair++]);
+                }else{
+                    ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_COLLISION]);
+                    pair_hits = collideBodies(world, bounds, j, k);
+                }
+                profile.pairs_tested++;
+                profile.hits += pair_hits.size();
+                if(pair_hits.empty()) continue;
+                ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_CONTACTS]);
+                world.wakeOnImpact(j, k, sleep_settings);
+                manifolds.addHits(world, j, k, pair_hits);
+            }
+        }
+        std::vector<Contact> contacts;
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_CONTACTS]);
+            manifolds.linkIslands(world, islands);
+            contacts = manifolds.getContacts(world);
+        }
+        {
+            ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_CONTACT_SOLVE]);
+            profile.contacts = contacts.size();
+            profile.solver_iterations = contact_solver.solve(world, contacts, delta_time).iterations;
+            manifolds.storeImpulses(world, contacts);
+        }
+        std::vector<uint8_t> solved(body_count, 0);
+        for (const auto& contact : contacts) {
+            solved[contact.body_a] = 1;
+            solved[contact.body_b] = 1;
+        }
+        //Solved bodies no longer move the way their hits were found for
+        hit_advance.integrate(world, bounds, narrow_phase, manifolds, sleep_settings, solved, delta_time, profile);
+        ScopedTimer timer(profile.phase_seconds[StepProfile::PHASE_SLEEP]);
+        world.updateSleep(islands, delta_time, sleep_settings);
+    }
+
+} // EngiGraph
@@ -0,0 +1,293 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "BatchIntegrator.h"
+#include <cmath>
+#include <cstring>
+
+//The AVX2 path is compiled for the functions that use it only, and picked at runtime, so the rest of the build runs on any x86-64 CPU
+#if defined(ENGIGRAPH_AVX2) && (defined(__x86_64__) || defined(_M_X64))
+#define ENGIGRAPH_BATCH_AVX2
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define ENGIGRAPH_TARGET_AVX2
+#else
+#define ENGIGRAPH_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#endif
+
+namespace EngiGraph {
+
+    /**
+     * Get how far a body moves this step, 0 if it is frozen.
+     */
+    static inline double getBodyStep(const BodyStates& states, double delta_time, const uint8_t* move_mask, uint32_t j) {
+        const bool frozen = (states.flags[j] & (BODY_FLAG_SLEEPING | BODY_FLAG_STATIC)) || (move_mask && move_mask[j] == 0);
+        return frozen ? 0.0 : delta_time;
+    }
+
+    /**
+     * Compute a * b + c.
+     * @tparam fused Round once like the FMA instructions of the AVX2 path, so bodies in its scalar remainder get bit for bit the same result.
+     */
+    template<bool fused> static inline double multiplyAdd(double a, double b, double c) {
+        if constexpr (fused){
+            return std::fma(a, b, c);
+        }else{
+            return a * b + c;
+        }
+    }
+
+    /**
+     * Predict the unnormalized rotation of a body after a step.
+     * @param half_step Half of the step length.
+     * @param rotation Output, w x y z.
+     */
+    template<bool fused> static inline void predictRotation(const BodyStates& states, double half_step, uint32_t j, double rotation[4]) {
+        //q += 0.5 * dt * (0,w) * q, in the same order of operations as predictRotations()
+        const double wx = states.angular_velocity_x[j], wy = states.angular_velocity_y[j], wz = states.angular_velocity_z[j];
+        const double qw = states.rotation_w[j], qx = states.rotation_x[j], qy = states.rotation_y[j], qz = states.rotation_z[j];
+        const double dot = multiplyAdd<fused>(wx, qx, multiplyAdd<fused>(wy, qy, wz * qz));
+        rotation[0] = qw - half_step * dot;
+        rotation[1] = multiplyAdd<fused>(half_step, multiplyAdd<fused>(wx, qw, wy * qz) - wz * qy, qx);
+        rotation[2] = multiplyAdd<fused>(half_step, multiplyAdd<fused>(wy, qw, wz * qx) - wx * qz, qy);
+        rotation[3] = multiplyAdd<fused>(half_step, multiplyAdd<fused>(wz, qw, wx * qy) - wy * qx, qz);
+    }
+
+    template<bool fused> static inline double lengthSquared(const double rotation[4]) {
+        return multiplyAdd<fused>(rotation[0], rotation[0], multiplyAdd<fused>(rotation[1], rotation[1], multiplyAdd<fused>(rotation[2], rotation[2], rotation[3] * rotation[3])));
+    }
+
+    template<bool fused> static inline void integratePoseScalar(BodyStates& states, double delta_time, const uint8_t* move_mask, uint32_t j) {
+        const double step = getBodyStep(states, delta_time, move_mask, j);
+        states.position_x[j] = multiplyAdd<fused>(states.velocity_x[j], step, states.position_x[j]);
+        states.position_y[j] = multiplyAdd<fused>(states.velocity_y[j], step, states.position_y[j]);
+        states.position_z[j] = multiplyAdd<fused>(states.velocity_z[j], step, states.position_z[j]);
+        double rotation[4];
+        predictRotation<fused>(states, 0.5 * step, j, rotation);
+        const double inverse_length = 1.0 / std::sqrt(lengthSquared<fused>(rotation));
+        states.rotation_w[j] = rotation[0] * inverse_length;
+        states.rotation_x[j] = rotation[1] * inverse_length;
+        states.rotation_y[j] = rotation[2] * inverse_length;
+        states.rotation_z[j] = rotation[3] * inverse_length;
+    }
+
+    template<bool fused> static inline void writePoseTransformScalar(const BodyStates& states, double delta_time, Eigen::Matrix4d& transform, uint32_t j) {
+        const double step = getBodyStep(states, delta_time, nullptr, j);
+        double r[4];
+        predictRotation<fused>(states, 0.5 * step, j, r);
+        const double rw = r[0], rx = r[1], ry = r[2], rz = r[3];
+        const double scale = 2.0 / lengthSquared<fused>(r); //Normalizes the rotation
+
+        double* matrix = transform.data(); //Column major
+        //Collider scale multiplies each rotation column
+        const double sx = states.scale_x[j], sy = states.scale_y[j], sz = states.scale_z[j];
+        matrix[0] = (1.0 - scale * (ry * ry + rz * rz)) * sx;
+        matrix[1] = scale * (rx * ry + rw * rz) * sx;
+        matrix[2] = scale * (rx * rz - rw * ry) * sx;
+        matrix[3] = 0.0;
+        matrix[4] = scale * (rx * ry - rw * rz) * sy;
+        matrix[5] = (1.0 - scale * (rx * rx + rz * rz)) * sy;
+        matrix[6] = scale * (ry * rz + rw * rx) * sy;
+        matrix[7] = 0.0;
+        matrix[8] = scale * (rx * rz + rw * ry) * sz;
+        matrix[9] = scale * (ry * rz - rw * rx) * sz;
+        matrix[10] = (1.0 - scale * (rx * rx + ry * ry)) * sz;
+        matrix[11] = 0.0;
+        matrix[12] = multiplyAdd<fused>(states.velocity_x[j], step, states.position_x[j]);
+        matrix[13] = multiplyAdd<fused>(states.velocity_y[j], step, states.position_y[j]);
+        matrix[14] = multiplyAdd<fused>(states.velocity_z[j], step, states.position_z[j]);
+        matrix[15] = 1.0;
+    }
+
+#if defined(ENGIGRAPH_BATCH_AVX2)
+
+    /**
+     * Check if the CPU and OS support AVX2 and FMA.
+     */
+    static bool detectAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if(info[0] < 7) return false;
+        __cpuid(info, 1);
+        const bool fma = info[2] & (1 << 12);
+        const bool os_saves_registers = info[2] & (1 << 27);
+        if(!fma || !os_saves_registers || (_xgetbv(0) & 6) != 6) return false;
+        __cpuidex(info, 7, 0);
+        return info[1] & (1 << 5);
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+    }
+
+    static const bool has_avx2 = detectAvx2();
+
+    ENGIGRAPH_TARGET_AVX2 static inline __m256d multiplyAdd(__m256d a, __m256d b, __m256d c) {
+        return _mm256_fmadd_pd(a, b, c);
+    }
+
+    /**
+     * Get how far 4 bodies move this step, 0 for frozen bodies.
+     */
+    ENGIGRAPH_TARGET_AVX2 static inline __m256d getBodySteps(const BodyStates& states, __m256d delta_time, const uint8_t* move_mask, uint32_t j) {
+        const __m128i flags = _mm_loadu_si128((const __m128i*)(states.flags.data() + j));
+        __m128i awake = _mm_cmpeq_epi32(_mm_and_si128(flags, _mm_set1_epi32(BODY_FLAG_SLEEPING | BODY_FLAG_STATIC)), _mm_setzero_si128());
+        if(move_mask){
+            int32_t mask_bytes;
+            std::memcpy(&mask_bytes, move_mask + j, sizeof(mask_bytes));
+            const __m128i held = _mm_cmpeq_epi32(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(mask_bytes)), _mm_setzero_si128());
+            awake = _mm_andnot_si128(held, awake);
+        }
+        //Widen the 32 bit lane masks to 64 bits, and use them to select the step
+        return _mm256_and_pd(_mm256_castsi256_pd(_mm256_cvtepi32_epi64(awake)), delta_time);
+    }
+
+    /**
+     * Predict the unnormalized rotations of 4 bodies after a step.
+     */
+    ENGIGRAPH_TARGET_AVX2 static inline void predictRotations(const BodyStates& states, __m256d half_step, uint32_t j, __m256d& rw, __m256d& rx, __m256d& ry, __m256d& rz) {
+        const __m256d wx = _mm256_loadu_pd(states.angular_velocity_x.data() + j);
+        const __m256d wy = _mm256_loadu_pd(states.angular_velocity_y.data() + j);
+        const __m256d wz = _mm256_loadu_pd(states.angular_velocity_z.data() + j);
+        const __m256d qw = _mm256_loadu_pd(states.rotation_w.data() + j);
+        const __m256d qx = _mm256_loadu_pd(states.rotation_x.data() + j);
+        const __m256d qy = _mm256_loadu_pd(states.rotation_y.data() + j);
+        const __m256d qz = _mm256_loadu_pd(states.rotation_z.data() + j);
+        const __m256d dot = multiplyAdd(wx, qx, multiplyAdd(wy, qy, _mm256_mul_pd(wz, qz)));
+        rw = _mm256_sub_pd(qw, _mm256_mul_pd(half_step, dot));
+        rx = multiplyAdd(half_step, _mm256_sub_pd(multiplyAdd(wx, qw, _mm256_mul_pd(wy, qz)), _mm256_mul_pd(wz, qy)), qx);
+        ry = multiplyAdd(half_step, _mm256_sub_pd(multiplyAdd(wy, qw, _mm256_mul_pd(wz, qx)), _mm256_mul_pd(wx, qz)), qy);
+        rz = multiplyAdd(half_step, _mm256_sub_pd(multiplyAdd(wz, qw, _mm256_mul_pd(wx, qy)), _mm256_mul_pd(wy, qx)), qz);
+    }
+
+    /**
+     * Transpose a 4x4 block, turning 4 registers of one component into 4 registers of one body.
+     */
+    ENGIGRAPH_TARGET_AVX2 static inline void transpose(__m256d& a, __m256d& b, __m256d& c, __m256d& d) {
+        const __m256d ab_low = _mm256_unpacklo_pd(a, b);
+        const __m256d ab_high = _mm256_unpackhi_pd(a, b);
+        const __m256d cd_low = _mm256_unpacklo_pd(c, d);
+        const __m256d cd_high = _mm256_unpackhi_pd(c, d);
+        a = _mm256_permute2f128_pd(ab_low, cd_low, 0x20);
+        b = _mm256_permute2f128_pd(ab_high, cd_high, 0x20);
+        c = _mm256_permute2f128_pd(ab_low, cd_low, 0x31);
+        d = _mm256_permute2f128_pd(ab_high, cd_high, 0x31);
+    }
+
+    /**
+     * Store one column of the transforms of 4 bodies.
+     */
+    ENGIGRAPH_TARGET_AVX2 static inline void storeColumn(Eigen::Matrix4d* transforms, uint32_t j, uint32_t column, __m256d x, __m256d y, __m256d z, __m256d w) {
+        transpose(x, y, z, w);
+        _mm256_storeu_pd(transforms[j].data() + column * 4, x);
+        _mm256_storeu_pd(transforms[j + 1].data() + column * 4, y);
+        _mm256_storeu_pd(transforms[j + 2].data() + column * 4, z);
+        _mm256_storeu_pd(transforms[j + 3].data() + column * 4, w);
+    }
+
+    ENGIGRAPH_TARGET_AVX2 static void integratePosesAvx2(BodyStates& states, double delta_time, const uint8_t* move_mask, uint32_t begin, uint32_t end) {
+        uint32_t j = begin;
+        const __m256d delta_times = _mm256_set1_pd(delta_time);
+        const __m256d half = _mm256_set1_pd(0.5);
+        const __m256d one = _mm256_set1_pd(1.0);
+        for (; j + 4 <= end; j += 4) {
+            const __m256d step = getBodySteps(states, delta_times, move_mask, j);
+            _mm256_storeu_pd(states.position_x.data() + j, multiplyAdd(_mm256_loadu_pd(states.velocity_x.data() + j), step, _mm256_loadu_pd(states.position_x.data() + j)));
+            _mm256_storeu_pd(states.position_y.data() + j, multiplyAdd(_mm256_loadu_pd(states.velocity_y.data() + j), step, _mm256_loadu_pd(states.position_y.data() + j)));
+            _mm256_storeu_pd(states.position_z.data() + j, multiplyAdd(_mm256_loadu_pd(states.velocity_z.data() + j), step, _mm256_loadu_pd(states.position_z.data() + j)));
+
+            __m256d rw, rx, ry, rz;
+            predictRotations(states, _mm256_mul_pd(half, step), j, rw, rx, ry, rz);
+            const __m256d length_squared = multiplyAdd(rw, rw, multiplyAdd(rx, rx, multiplyAdd(ry, ry, _mm256_mul_pd(rz, rz))));
+            const __m256d inverse_length = _mm256_div_pd(one, _mm256_sqrt_pd(length_squared));
+            _mm256_storeu_pd(states.rotation_w.data() + j, _mm256_mul_pd(rw, inverse_length));
+            _mm256_storeu_pd(states.rotation_x.data() + j, _mm256_mul_pd(rx, inverse_length));
+            _mm256_storeu_pd(states.rotation_y.data() + j, _mm256_mul_pd(ry, inverse_length));
+            _mm256_storeu_pd(states.rotation_z.data() + j, _mm256_mul_pd(rz, inverse_length));
+        }
+        for (; j < end; ++j) {
+            integratePoseScalar<true>(states, delta_time, move_mask, j);
+        }
+    }
+
+    ENGIGRAPH_TARGET_AVX2 static void writePoseTransformsAvx2(const BodyStates& states, double delta_time, Eigen::Matrix4d* transforms, uint32_t begin, uint32_t end) {
+        uint32_t j = begin;
+        const __m256d delta_times = _mm256_set1_pd(delta_time);
+        const __m256d half = _mm256_set1_pd(0.5);
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d two = _mm256_set1_pd(2.0);
+        const __m256d zero = _mm256_setzero_pd();
+        for (; j + 4 <= end; j += 4) {
+            const __m256d step = getBodySteps(states, delta_times, nullptr, j);
+            __m256d rw, rx, ry, rz;
+            predictRotations(states, _mm256_mul_pd(half, step), j, rw, rx, ry, rz);
+            const __m256d length_squared = multiplyAdd(rw, rw, multiplyAdd(rx, rx, multiplyAdd(ry, ry, _mm256_mul_pd(rz, rz))));
+            const __m256d scale = _mm256_div_pd(two, length_squared); //Normalizes the rotation
+
+            const __m256d xx = _mm256_mul_pd(rx, rx), yy = _mm256_mul_pd(ry, ry), zz = _mm256_mul_pd(rz, rz);
+            const __m256d xy = _mm256_mul_pd(rx, ry), xz = _mm256_mul_pd(rx, rz), yz = _mm256_mul_pd(ry, rz);
+            const __m256d wx = _mm256_mul_pd(rw, rx), wy = _mm256_mul_pd(rw, ry), wz = _mm256_mul_pd(rw, rz);
+
+            //Collider scale multiplies each rotation column
+            const __m256d sx = _mm256_loadu_pd(states.scale_x.data() + j);
+            const __m256d sy = _mm256_loadu_pd(states.scale_y.data() + j);
+            const __m256d sz = _mm256_loadu_pd(states.scale_z.data() + j);
+            storeColumn(transforms, j, 0,
+                        _mm256_mul_pd(_mm256_sub_pd(one, _mm256_mul_pd(scale, _mm256_add_pd(yy, zz))), sx),
+                        _mm256_mul_pd(_mm256_mul_pd(scale, _mm256_add_pd(xy, wz)), sx),
+                        _mm256_mul_pd(_mm256_mul_pd(scale, _mm256_sub_pd(xz, wy)), sx),
+                        zero);
+            storeColumn(transforms, j, 1,
+                        _mm256_mul_pd(_mm256_mul_pd(scale, _mm256_sub_pd(xy, wz)), sy),
+                        _mm256_mul_pd(_mm256_sub_pd(one, _mm256_mul_pd(scale, _mm256_add_pd(xx, zz))), sy),
+                        _mm256_mul_pd(_mm256_mul_pd(scale, _mm256_add_pd(yz, wx)), sy),
+                        zero);
+            storeColumn(transforms, j, 2,
+                        _mm256_mul_pd(_mm256_mul_pd(scale, _mm256_add_pd(xz, wy)), sz),
+                        _mm256_mul_pd(_mm256_mul_pd(scale, _mm256_sub_pd(yz, wx)), sz),
+                        _mm256_mul_pd(_mm256_sub_pd(one, _mm256_mul_pd(scale, _mm256_add_pd(xx, yy))), sz),
+                        zero);
+            storeColumn(transforms, j, 3,
+                        multiplyAdd(_mm256_loadu_pd(states.velocity_x.data() + j), step, _mm256_loadu_pd(states.position_x.data() + j)),
+                        multiplyAdd(_mm256_loadu_pd(states.velocity_y.data() + j), step, _mm256_loadu_pd(states.position_y.data() + j)),
+                        multiplyAdd(_mm256_loadu_pd(states.velocity_z.data() + j), step, _mm256_loadu_pd(states.position_z.data() + j)),
+                        one);
+        }
+        for (; j < end; ++j) {
+            writePoseTransformScalar<true>(states, delta_time, transforms[j], j);
+        }
+    }
+
+#endif
+
+    bool isBatchIntegratorVectorized() {
+#if defined(ENGIGRAPH_BATCH_AVX2)
+        return has_avx2;
+#else
+        return false;
+#endif
+    }
+
+    void integratePoses(BodyStates& states, double delta_time, const uint8_t* move_mask, uint32_t begin, uint32_t end) {
+#if defined(ENGIGRAPH_BATCH_AVX2)
+        if(has_avx2) return integratePosesAvx2(states, delta_time, move_mask, begin, end);
+#endif
+        for (uint32_t j = begin; j < end; ++j) {
+            integratePoseScalar<false>(states, delta_time, move_mask, j);
+        }
+    }
+
+    void writePoseTransforms(const BodyStates& states, double delta_time, Eigen::Matrix4d* transforms, uint32_t begin, uint32_t end) {
+#if defined(ENGIGRAPH_BATCH_AVX2)
+        if(has_avx2) return writePoseTransformsAvx2(states, delta_time, transforms, begin, end);
+#endif
+        for (uint32_t j = begin; j < end; ++j) {
+            writePoseTransformScalar<false>(states, delta_time, transforms[j], j);
+        }
+    }
+
+} // EngiGraph
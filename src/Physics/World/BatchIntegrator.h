@@ -0,0 +1,44 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <cstdint>
+#include "BodyStates.h"
+
+namespace EngiGraph {
+
+    /**
+     * Check if the batch integrator uses AVX2, advancing 4 bodies per instruction.
+     * @details Needs ENGIGRAPH_AVX2 in CMake, and a CPU with AVX2 and FMA, which is checked at runtime. Otherwise, a scalar loop is used.
+     */
+    [[nodiscard]] bool isBatchIntegratorVectorized();
+
+    /**
+     * Move a range of bodies along their velocities.
+     * @details Positions move by velocity * dt, rotations by q += 0.5 * dt * (0,w) * q, and are then renormalized.
+     * @details Sleeping and static bodies, and bodies with a zero move mask, are left untouched.
+     * @param states Bodies to move.
+     * @param delta_time Length of the step.
+     * @param move_mask Optional, non-zero for each dense index that should move. nullptr to move all awake bodies.
+     * @param begin First dense index.
+     * @param end One past the last dense index.
+     */
+    void integratePoses(BodyStates& states, double delta_time, const uint8_t* move_mask, uint32_t begin, uint32_t end);
+
+    /**
+     * Write the collider transform of a range of bodies after moving them along their velocities, without changing the bodies.
+     * @details Uses the same integration as integratePoses(), so the transform matches the pose after integration.
+     * @details The collider scale of each body is applied before its rotation.
+     * @details Sleeping and static bodies do not move.
+     * @param states Bodies to read.
+     * @param delta_time Length of the step, 0 for the current transform.
+     * @param transforms Output, indexed by dense index. Must have space for at least end transforms.
+     * @param begin First dense index.
+     * @param end One past the last dense index.
+     */
+    void writePoseTransforms(const BodyStates& states, double delta_time, Eigen::Matrix4d* transforms, uint32_t begin, uint32_t end);
+
+} // EngiGraph
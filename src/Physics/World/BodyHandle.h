@@ -0,0 +1,45 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace EngiGraph {
+
+    /**
+     * Stable reference to a body in a PhysicsWorld.
+     * @details Bodies are stored densely and move around when other bodies are removed, so indices are not stable.
+     * Handles stay valid until their body is destroyed, and the generation detects use of a destroyed body's handle.
+     */
+    struct BodyHandle {
+        static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFF;
+
+        /**
+         * Slot in the world's handle table.
+         */
+        uint32_t slot = INVALID_SLOT;
+
+        /**
+         * Incremented each time a slot is reused.
+         */
+        uint32_t generation = 0;
+
+        /**
+         * Check if this handle was never assigned a body.
+         */
+        [[nodiscard]] bool isNull() const {
+            return slot == INVALID_SLOT;
+        }
+
+        bool operator==(const BodyHandle& other) const {
+            return slot == other.slot && generation == other.generation;
+        }
+
+        bool operator!=(const BodyHandle& other) const {
+            return !(*this == other);
+        }
+    };
+
+} // EngiGraph
@@ -0,0 +1,142 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace EngiGraph {
+
+    /**
+     * Bit flags describing the state of a body.
+     */
+    enum BodyFlags : uint32_t {
+        BODY_FLAG_NONE = 0,
+        /**
+         * The body is affected by world gravity.
+         */
+        BODY_FLAG_GRAVITY = 1u << 0,
+        /**
+         * The body is asleep and is not integrated.
+         */
+        BODY_FLAG_SLEEPING = 1u << 1,
+        /**
+         * The body never moves. It is not integrated, and is never tested against other static or kinematic bodies.
+         */
+        BODY_FLAG_STATIC = 1u << 2,
+        /**
+         * The body moves with its velocity, which only the user changes. Forces, gravity and contacts do not affect it.
+         */
+        BODY_FLAG_KINEMATIC = 1u << 3,
+    };
+
+    /**
+     * Simulation state of every body in a world, stored as structure of arrays.
+     * @details Each array is indexed by the dense body index. Keeping each component in its own array lets the integration loops
+     * stream through memory and vectorize, instead of striding over large body objects.
+     * @details Rotations are quaternions, inverse inertia tensors are symmetric and in local space.
+     */
+    struct BodyStates {
+        std::vector<double> position_x, position_y, position_z;
+        std::vector<double> rotation_w, rotation_x, rotation_y, rotation_z;
+        std::vector<double> velocity_x, velocity_y, velocity_z;
+        std::vector<double> angular_velocity_x, angular_velocity_y, angular_velocity_z;
+        std::vector<double> force_x, force_y, force_z;
+        std::vector<double> inverse_mass;
+        std::vector<double> inverse_inertia_xx, inverse_inertia_yy, inverse_inertia_zz;
+        std::vector<double> inverse_inertia_xy, inverse_inertia_xz, inverse_inertia_yz;
+        /**
+         * Scale of the collider along each of its local axes.
+         */
+        std::vector<double> scale_x, scale_y, scale_z;
+        /**
+         * Time spent below the sleep velocity thresholds.
+         */
+        std::vector<double> resting_time;
+        /**
+         * Collision layer bits of the body, and the layers it collides with. A pair collides only if each body's layer is in the other's mask.
+         */
+        std::vector<uint32_t> collision_layer, collision_mask;
+        /**
+         * Combination of BodyFlags.
+         */
+        std::vector<uint32_t> flags;
+
+        /**
+         * Call a function on each of the arrays.
+         * @param function Generic function that takes a std::vector reference.
+         */
+        template<typename F> void forEachArray(F&& function) {
+            forEachArrayOf(function, *this);
+        }
+        template<typename F> void forEachArray(F&& function) const {
+            forEachArrayOf(function, *this);
+        }
+
+        /**
+         * Call a function on the matching arrays of several states at once.
+         * @param function Generic function that takes one std::vector reference per state.
+         * @param states States to go through, const or not.
+         */
+        template<typename F, typename... States> static void forEachArrayOf(F&& function, States&... states) {
+            function(states.position_x...); function(states.position_y...); function(states.position_z...);
+            function(states.rotation_w...); function(states.rotation_x...); function(states.rotation_y...); function(states.rotation_z...);
+            function(states.velocity_x...); function(states.velocity_y...); function(states.velocity_z...);
+            function(states.angular_velocity_x...); function(states.angular_velocity_y...); function(states.angular_velocity_z...);
+            function(states.force_x...); function(states.force_y...); function(states.force_z...);
+            function(states.inverse_mass...);
+            function(states.inverse_inertia_xx...); function(states.inverse_inertia_yy...); function(states.inverse_inertia_zz...);
+            function(states.inverse_inertia_xy...); function(states.inverse_inertia_xz...); function(states.inverse_inertia_yz...);
+            function(states.scale_x...); function(states.scale_y...); function(states.scale_z...);
+            function(states.resting_time...);
+            function(states.collision_layer...); function(states.collision_mask...);
+            function(states.flags...);
+        }
+
+        /**
+         * Get the number of bodies.
+         */
+        [[nodiscard]] uint32_t size() const {
+            return (uint32_t)position_x.size();
+        }
+
+        /**
+         * Reserve space in all arrays.
+         * @param count Number of bodies.
+         */
+        void reserve(uint32_t count) {
+            forEachArray([count](auto& array){ array.reserve(count); });
+        }
+
+        /**
+         * Add a zero initialized body to the end of all arrays.
+         */
+        void pushBack() {
+            forEachArray([](auto& array){ array.emplace_back(); });
+        }
+
+        /**
+         * Copy all state of one body over another.
+         * @param index Body to overwrite.
+         * @param source States to copy from, may be this.
+         * @param source_index Body to copy.
+         */
+        void copyBody(uint32_t index, const BodyStates& source, uint32_t source_index) {
+            forEachArrayOf([index, source_index](auto& array, const auto& source_array){ array[index] = source_array[source_index]; }, *this, source);
+        }
+
+        /**
+         * Remove a body by moving the last body into its place.
+         * @param index Body to remove.
+         */
+        void swapRemove(uint32_t index) {
+            forEachArray([index](auto& array){
+                array[index] = array.back();
+                array.pop_back();
+            });
+        }
+    };
+
+} // EngiGraph
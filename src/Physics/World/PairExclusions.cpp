@@ -0,0 +1,62 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "PairExclusions.h"
+#include <algorithm>
+
+namespace EngiGraph {
+
+    bool PairExclusions::add(uint32_t slot_a, uint32_t slot_b) {
+        if(!pairs.insert(makeKey(slot_a, slot_b)).second) return false;
+        changeCount(slot_a, 1);
+        changeCount(slot_b, 1);
+        return true;
+    }
+
+    bool PairExclusions::remove(uint32_t slot_a, uint32_t slot_b) {
+        if(pairs.erase(makeKey(slot_a, slot_b)) == 0) return false;
+        changeCount(slot_a, -1);
+        changeCount(slot_b, -1);
+        return true;
+    }
+
+    void PairExclusions::removeSlot(uint32_t slot) {
+        if(slot >= slot_pair_counts.size() || slot_pair_counts[slot] == 0) return;
+        for (auto it = pairs.begin(); it != pairs.end();) {
+            const auto low = (uint32_t)(*it >> 32);
+            const auto high = (uint32_t)*it;
+            if(low == slot || high == slot){
+                changeCount(low == slot ? high : low, -1);
+                it = pairs.erase(it);
+            }else{
+                ++it;
+            }
+        }
+        slot_pair_counts[slot] = 0;
+    }
+
+    std::vector<uint64_t> PairExclusions::getSortedKeys() const {
+        std::vector<uint64_t> keys(pairs.begin(), pairs.end());
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+
+    void PairExclusions::setKeys(const std::vector<uint64_t>& keys) {
+        clear();
+        for (uint64_t key : keys) {
+            add((uint32_t)(key >> 32), (uint32_t)key);
+        }
+    }
+
+    void PairExclusions::clear() {
+        pairs.clear();
+        slot_pair_counts.clear();
+    }
+
+    void PairExclusions::changeCount(uint32_t slot, int32_t change) {
+        if(slot >= slot_pair_counts.size()) slot_pair_counts.resize(slot + 1, 0);
+        slot_pair_counts[slot] += change;
+    }
+
+} // EngiGraph
@@ -0,0 +1,83 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace EngiGraph {
+
+    /**
+     * Set of body pairs that never collide, keyed by handle slot so it stays valid as bodies move between dense indices.
+     * @details Lookups are a single hash set probe. Each slot keeps a count of its pairs, so removing a body that has none is free.
+     */
+    class PairExclusions {
+    public:
+        /**
+         * Exclude a pair.
+         * @param slot_a,slot_b Handle slots, in any order.
+         * @return True if the pair was not excluded before.
+         */
+        bool add(uint32_t slot_a, uint32_t slot_b);
+
+        /**
+         * Stop excluding a pair.
+         * @param slot_a,slot_b Handle slots, in any order.
+         * @return True if the pair was excluded.
+         */
+        bool remove(uint32_t slot_a, uint32_t slot_b);
+
+        /**
+         * Remove every pair of a slot, when its body is destroyed.
+         */
+        void removeSlot(uint32_t slot);
+
+        /**
+         * Check if a pair is excluded.
+         * @param slot_a,slot_b Handle slots, in any order.
+         */
+        [[nodiscard]] bool contains(uint32_t slot_a, uint32_t slot_b) const {
+            return !pairs.empty() && pairs.count(makeKey(slot_a, slot_b)) != 0;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return pairs.empty();
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return pairs.size();
+        }
+
+        /**
+         * Get all pairs in ascending order, for saving and hashing.
+         * @return Pairs packed as lower slot << 32 | higher slot.
+         */
+        [[nodiscard]] std::vector<uint64_t> getSortedKeys() const;
+
+        /**
+         * Replace all pairs.
+         * @param keys Pairs packed like getSortedKeys().
+         */
+        void setKeys(const std::vector<uint64_t>& keys);
+
+        void clear();
+
+    private:
+        std::unordered_set<uint64_t> pairs{};
+        /**
+         * Number of pairs of each slot.
+         */
+        std::vector<uint32_t> slot_pair_counts{};
+
+        [[nodiscard]] static uint64_t makeKey(uint32_t slot_a, uint32_t slot_b) {
+            return slot_a < slot_b ? ((uint64_t)slot_a << 32 | slot_b) : ((uint64_t)slot_b << 32 | slot_a);
+        }
+
+        void changeCount(uint32_t slot, int32_t change);
+    };
+
+} // EngiGraph
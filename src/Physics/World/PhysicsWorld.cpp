@@ -0,0 +1,293 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "PhysicsWorld.h"
+#include "BatchIntegrator.h"
+#include "src/Exceptions/RuntimeException.h"
+#include <cstring>
+
+namespace EngiGraph {
+
+    BodyHandle PhysicsWorld::createBody(const BodyDescription& description) {
+        if(!(description.scale.array() > 0.0).all()) throw RuntimeException("Body scale must be positive");
+        if(description.height_field && description.type == BodyType::DYNAMIC) throw RuntimeException("Height field bodies must be static or kinematic.");
+        if(description.signed_distance_field && description.type == BodyType::DYNAMIC) throw RuntimeException("Signed distance field bodies must be static or kinematic.");
+        uint32_t slot;
+        if(free_slots.empty()){
+            slot = (uint32_t)slot_to_index.size();
+            slot_to_index.push_back(0);
+            slot_generations.push_back(0);
+        }else{
+            slot = free_slots.back();
+            free_slots.pop_back();
+        }
+        uint32_t index = states.size();
+        slot_to_index[slot] = index;
+        index_to_slot.push_back(slot);
+
+        states.pushBack();
+        setPosition(index, description.position);
+        setRotation(index, description.rotation.normalized());
+        setVelocity(index, description.velocity);
+        setAngularVelocity(index, description.angular_velocity);
+        setForce(index, description.force);
+        setScale(index, description.scale);
+        setCollisionFilter(index, description.collision_layer, description.collision_mask);
+
+        if(description.type == BodyType::DYNAMIC && description.mass > 0.0){
+            states.inverse_mass[index] = 1.0 / description.mass;
+            Eigen::Matrix3d inverse_inertia = description.inertia_tensor.inverse();
+            states.inverse_inertia_xx[index] = inverse_inertia(0,0);
+            states.inverse_inertia_yy[index] = inverse_inertia(1,1);
+            states.inverse_inertia_zz[index] = inverse_inertia(2,2);
+            states.inverse_inertia_xy[index] = inverse_inertia(0,1);
+            states.inverse_inertia_xz[index] = inverse_inertia(0,2);
+            states.inverse_inertia_yz[index] = inverse_inertia(1,2);
+        } //Otherwise stays zero, which makes the body immovable
+        if(description.type == BodyType::STATIC){
+            states.flags[index] = BODY_FLAG_STATIC;
+            setVelocity(index, {0,0,0});
+            setAngularVelocity(index, {0,0,0});
+        }else if(description.type == BodyType::KINEMATIC){
+            states.flags[index] = BODY_FLAG_KINEMATIC;
+        }else{
+            states.flags[index] = description.gravity ? BODY_FLAG_GRAVITY : BODY_FLAG_NONE;
+        }
+
+        if(description.compound) colliders.push_back(description.compound->getMergedMesh());
+        else if(description.height_field) colliders.push_back(description.height_field->getBoundsMesh());
+        else colliders.push_back(description.collider);
+        compound_colliders.push_back(description.compound);
+        height_fields.push_back(description.height_field);
+        signed_distance_fields.push_back(description.signed_distance_field);
+        Eigen::Matrix4d transform = getColliderTransform(index);
+        current_transforms.push_back(transform);
+        future_transforms.push_back(transform);
+        collider_bakes.push_back(nullptr);
+
+        return {slot, slot_generations[slot]};
+    }
+
+    void PhysicsWorld::destroyBody(BodyHandle handle) {
+        uint32_t index = getIndex(handle);
+        uint32_t last = states.size() - 1;
+
+        states.swapRemove(index);
+        colliders[index] = colliders[last];
+        colliders.pop_back();
+        compound_colliders[index] = compound_colliders[last];
+        compound_colliders.pop_back();
+        height_fields[index] = height_fields[last];
+        height_fields.pop_back();
+        signed_distance_fields[index] = signed_distance_fields[last];
+        signed_distance_fields.pop_back();
+        current_transforms[index] = current_transforms[last];
+        current_transforms.pop_back();
+        future_transforms[index] = future_transforms[last];
+        future_transforms.pop_back();
+        collider_bakes[index] = std::move(collider_bakes[last]);
+        collider_bakes.pop_back();
+
+        //The last body now lives at the removed index
+        index_to_slot[index] = index_to_slot[last];
+        slot_to_index[index_to_slot[index]] = index;
+        index_to_slot.pop_back();
+
+        slot_generations[handle.slot]++;
+        free_slots.push_back(handle.slot);
+        excluded_pairs.removeSlot(handle.slot);
+    }
+
+    bool PhysicsWorld::excludePair(BodyHandle body_a, BodyHandle body_b) {
+        if(!isValid(body_a) || !isValid(body_b)) throw RuntimeException("Body handle does not refer to an existing body.");
+        if(body_a == body_b) throw RuntimeException("A body can not be excluded from colliding with itself.");
+        return excluded_pairs.add(body_a.slot, body_b.slot);
+    }
+
+    bool PhysicsWorld::includePair(BodyHandle body_a, BodyHandle body_b) {
+        if(!isValid(body_a) || !isValid(body_b)) throw RuntimeException("Body handle does not refer to an existing body.");
+        return excluded_pairs.remove(body_a.slot, body_b.slot);
+    }
+
+    bool PhysicsWorld::isValid(BodyHandle handle) const {
+        return handle.slot < slot_generations.size() && slot_generations[handle.slot] == handle.generation;
+    }
+
+    uint32_t PhysicsWorld::getIndex(BodyHandle handle) const {
+        if(!isValid(handle)) throw RuntimeException("Body handle does not refer to an existing body.");
+        return slot_to_index[handle.slot];
+    }
+
+    void PhysicsWorld::setHandleTable(HandleTable table) {
+        const size_t slot_count = table.slot_to_index.size();
+        bool valid = table.index_to_slot.size() == getBodyCount() && table.slot_generations.size() == slot_count &&
+                     table.index_to_slot.size() + table.free_slots.size() == slot_count;
+        for (uint32_t index = 0; valid && index < table.index_to_slot.size(); ++index) {
+            valid = table.index_to_slot[index] < slot_count && table.slot_to_index[table.index_to_slot[index]] == index;
+        }
+        for (uint32_t slot : table.free_slots) {
+            valid = valid && slot < slot_count;
+        }
+        if(!valid) throw RuntimeException("Handle table does not match the bodies of the world.");
+        slot_to_index = std::move(table.slot_to_index);
+        slot_generations = std::move(table.slot_generations);
+        index_to_slot = std::move(table.index_to_slot);
+        free_slots = std::move(table.free_slots);
+    }
+
+    uint64_t PhysicsWorld::hashState() const {
+        //FNV-1a over whole 64 bit words, hashing byte by byte is needlessly slow for large worlds
+        uint64_t hash = 14695981039346656037ull;
+        auto add = [&hash](uint64_t word){
+            hash = (hash ^ word) * 1099511628211ull;
+        };
+        add(getBodyCount());
+        states.forEachArray([&](const auto& array){
+            for (const auto& value : array) {
+                uint64_t word = 0;
+                std::memcpy(&word, &value, sizeof(value));
+                add(word);
+            }
+        });
+        for (uint32_t slot : index_to_slot) add(slot);
+        for (uint32_t generation : slot_generations) add(generation);
+        for (uint32_t slot : free_slots) add(slot);
+        for (uint64_t key : excluded_pairs.getSortedKeys()) add(key);
+        return hash;
+    }
+
+    void PhysicsWorld::reserve(uint32_t count) {
+        states.reserve(count);
+        colliders.reserve(count);
+        compound_colliders.reserve(count);
+        height_fields.reserve(count);
+        signed_distance_fields.reserve(count);
+        current_transforms.reserve(count);
+        future_transforms.reserve(count);
+        collider_bakes.reserve(count);
+        index_to_slot.reserve(count);
+    }
+
+    Eigen::Matrix3d PhysicsWorld::getInverseInertiaLocal(uint32_t index) const {
+        Eigen::Matrix3d inverse_inertia{};
+        inverse_inertia << states.inverse_inertia_xx[index], states.inverse_inertia_xy[index], states.inverse_inertia_xz[index],
+                           states.inverse_inertia_xy[index], states.inverse_inertia_yy[index], states.inverse_inertia_yz[index],
+                           states.inverse_inertia_xz[index], states.inverse_inertia_yz[index], states.inverse_inertia_zz[index];
+        return inverse_inertia;
+    }
+
+    Eigen::Matrix3d PhysicsWorld::getInverseInertiaWorld(uint32_t index) const {
+        Eigen::Matrix3d rotation = getRotation(index).normalized().toRotationMatrix();
+        return rotation * getInverseInertiaLocal(index) * rotation.transpose();
+    }
+
+    Eigen::Matrix4d PhysicsWorld::getTransform(uint32_t index) const {
+        Eigen::Transform<double,3,Eigen::Affine> transform = Eigen::Transform<double,3,Eigen::Affine>::Identity();
+        transform.translate(getPosition(index)).rotate(getRotation(index).normalized());
+        return transform.matrix();
+    }
+
+    Eigen::Matrix4d PhysicsWorld::getColliderTransform(uint32_t index) const {
+        Eigen::Matrix4d transform = getTransform(index);
+        transform.topLeftCorner<3,3>() *= getScale(index).asDiagonal();
+        return transform;
+    }
+
+    void PhysicsWorld::setScale(uint32_t index, const Eigen::Vector3d& scale) {
+        if(!(scale.array() > 0.0).all()) throw RuntimeException("Body scale must be positive");
+        states.scale_x[index] = scale.x(); states.scale_y[index] = scale.y(); states.scale_z[index] = scale.z();
+    }
+
+    void PhysicsWorld::setKinematicTarget(uint32_t index, const Eigen::Vector3d& position, const Eigen::Quaterniond& rotation, double delta_time) {
+        if(!hasFlag(index, BODY_FLAG_KINEMATIC)) throw RuntimeException("Only kinematic bodies can be given a target");
+        setVelocity(index, (position - getPosition(index)) / delta_time);
+        //The integrator turns q into normalize((1, 0.5 * dt * w) * q), so solve (1, 0.5 * dt * w) ~ target * q^-1
+        Eigen::Quaterniond difference = rotation.normalized() * getRotation(index).conjugate();
+        if(difference.w() < 0.0) difference.coeffs() *= -1.0; //Shorter way around
+        setAngularVelocity(index, difference.w() > 0.0 ? Eigen::Vector3d(2.0 * difference.vec() / (difference.w() * delta_time)) : Eigen::Vector3d::Zero());
+        wakeBody(index);
+    }
+
+    void PhysicsWorld::wakeBody(uint32_t index) {
+        setFlag(index, BODY_FLAG_SLEEPING, false);
+        states.resting_time[index] = 0.0;
+    }
+
+    void PhysicsWorld::sleepBody(uint32_t index) {
+        setFlag(index, BODY_FLAG_SLEEPING, true);
+        setVelocity(index, {0,0,0});
+        setAngularVelocity(index, {0,0,0});
+        current_transforms[index] = getColliderTransform(index);
+        future_transforms[index] = current_transforms[index];
+    }
+
+    void PhysicsWorld::integrateForces(double delta_time, const Eigen::Vector3d& gravity) {
+        const uint32_t count = states.size();
+        const uint32_t* __restrict flags = states.flags.data();
+        const double* __restrict inverse_mass = states.inverse_mass.data();
+        const double* __restrict force_x = states.force_x.data();
+        const double* __restrict force_y = states.force_y.data();
+        const double* __restrict force_z = states.force_z.data();
+        double* __restrict velocity_x = states.velocity_x.data();
+        double* __restrict velocity_y = states.velocity_y.data();
+        double* __restrict velocity_z = states.velocity_z.data();
+        //Branch free, so the loop vectorizes
+        for (uint32_t j = 0; j < count; ++j) {
+            const double awake = (flags[j] & (BODY_FLAG_SLEEPING | BODY_FLAG_STATIC | BODY_FLAG_KINEMATIC)) ? 0.0 : delta_time;
+            const double gravity_scale = ((flags[j] & BODY_FLAG_GRAVITY) && inverse_mass[j] != 0.0) ? awake : 0.0;
+            velocity_x[j] += awake * force_x[j] * inverse_mass[j] + gravity_scale * gravity.x();
+            velocity_y[j] += awake * force_y[j] * inverse_mass[j] + gravity_scale * gravity.y();
+            velocity_z[j] += awake * force_z[j] * inverse_mass[j] + gravity_scale * gravity.z();
+        }
+    }
+
+    void PhysicsWorld::integratePositions(double delta_time) {
+        integratePoses(states, delta_time, nullptr, 0, states.size());
+    }
+
+    void PhysicsWorld::integratePositions(double delta_time, const std::vector<uint8_t>& move_mask) {
+        integratePoses(states, delta_time, move_mask.data(), 0, states.size());
+    }
+
+    void PhysicsWorld::updateCurrentTransforms() {
+        current_transforms.resize(states.size());
+        writePoseTransforms(states, 0.0, current_transforms.data(), 0, states.size());
+    }
+
+    void PhysicsWorld::updateFutureTransforms(double delta_time) {
+        future_transforms.resize(states.size());
+        writePoseTransforms(states, delta_time, future_transforms.data(), 0, states.size());
+    }
+
+    void PhysicsWorld::updateSleep(IslandGraph& islands, double delta_time, const SleepSettings& settings) {
+        const uint32_t count = states.size();
+        std::vector<SleepState> sleep_states(count);
+        for (uint32_t j = 0; j < count; ++j) {
+            //Static and kinematic bodies never sleep, and are not linked into islands, so they do not keep others awake
+            if(!isDynamic(j)) continue;
+            SleepState state{states.resting_time[j], hasFlag(j, BODY_FLAG_SLEEPING)};
+            updateRestingTime(state, getVelocity(j), getAngularVelocity(j), delta_time, settings);
+            states.resting_time[j] = state.resting_time;
+            sleep_states[j] = state;
+        }
+        auto transitions = updateIslandSleep(islands, sleep_states, settings);
+        for (uint32_t j = 0; j < count; ++j) {
+            if(transitions[j] == SleepTransition::FALL_ASLEEP){
+                sleepBody(j);
+            }else if(transitions[j] == SleepTransition::WAKE_UP){
+                wakeBody(j);
+            }
+        }
+    }
+
+    void PhysicsWorld::wakeOnImpact(uint32_t body_a, uint32_t body_b, const SleepSettings& settings) {
+        auto is_moving = [&](uint32_t body){
+            return !hasFlag(body, BODY_FLAG_SLEEPING) &&
+                   (getVelocity(body).norm() > settings.linear_velocity_threshold || getAngularVelocity(body).norm() > settings.angular_velocity_threshold);
+        };
+        if(is_moving(body_a) && hasFlag(body_b, BODY_FLAG_SLEEPING)) wakeBody(body_b);
+        if(is_moving(body_b) && hasFlag(body_a, BODY_FLAG_SLEEPING)) wakeBody(body_a);
+    }
+
+} // EngiGraph
@@ -0,0 +1,488 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <memory>
+#include <vector>
+#include "BodyHandle.h"
+#include "BodyStates.h"
+#include "PairExclusions.h"
+#include "src/Geometry/Mesh.h"
+#include "src/Physics/Collisions/ColliderBake.h"
+#include "src/Physics/Collisions/CompoundCollider.h"
+#include "src/Physics/Collisions/HeightField.h"
+#include "src/Physics/Collisions/SignedDistanceField.h"
+#include "src/Physics/Islands/Sleeping.h"
+
+namespace EngiGraph {
+
+    /**
+     * How a body takes part in the simulation.
+     */
+    enum class BodyType : uint8_t {
+        /**
+         * Moved by forces, gravity and contacts.
+         */
+        DYNAMIC,
+        /**
+         * Never moves, like floors and walls. Costs nothing while nothing touches it.
+         */
+        STATIC,
+        /**
+         * Moved only by setting its velocity, for example with setKinematicTarget(). Pushes dynamic bodies, but is not pushed back.
+         */
+        KINEMATIC
+    };
+
+    /**
+     * Everything needed to create a body.
+     */
+    struct BodyDescription {
+        /**
+         * Local space collision geometry. May be shared between bodies.
+         */
+        std::shared_ptr<const Mesh> collider;
+        /**
+         * Pieces to collide with instead of a single mesh. May be shared between bodies.
+         * @details The body holds the merged mesh of the compound as its collider, and collider is ignored.
+         */
+        std::shared_ptr<const CompoundCollider> compound{};
+        /**
+         * Terrain to collide with instead of a mesh. May be shared between bodies. Only for static and kinematic bodies.
+         * @details The body holds the bounds mesh of the height field as its collider, and collider is ignored.
+         */
+        std::shared_ptr<const HeightField> height_field{};
+        /**
+         * Distance field of the collider, to collide with in constant time per vertex of the other body. May be shared between bodies.
+         * Only for static and kinematic bodies.
+         * @details The body still holds collider, for its bounds and for scene queries.
+         */
+        std::shared_ptr<const SignedDistanceField> signed_distance_field{};
+
+        Eigen::Vector3d position = {0,0,0};
+        Eigen::Quaterniond rotation = Eigen::Quaterniond::Identity();
+        Eigen::Vector3d velocity = {0,0,0};
+        Eigen::Vector3d angular_velocity = {0,0,0};
+        /**
+         * Constant force applied every step.
+         */
+        Eigen::Vector3d force = {0,0,0};
+
+        BodyType type = BodyType::DYNAMIC;
+
+        /**
+         * Mass of the body. A mass of zero makes the body immovable by contacts and forces. Ignored for static and kinematic bodies.
+         */
+        double mass = 1.0;
+        /**
+         * Local space inertia tensor about the center of mass.
+         */
+        Eigen::Matrix3d inertia_tensor = Eigen::Matrix3d::Identity();
+        /**
+         * Scale of the collider along its local axes, applied in the collision transform.
+         * @details Lets bodies of different sizes share one collider. Does not change mass or inertia.
+         */
+        Eigen::Vector3d scale = {1,1,1};
+
+        /**
+         * Is the body affected by world gravity? Ignored for static and kinematic bodies.
+         */
+        bool gravity = true;
+
+        /**
+         * Collision layer bits of the body.
+         */
+        uint32_t collision_layer = 1;
+        /**
+         * Layers the body collides with.
+         */
+        uint32_t collision_mask = 0xFFFFFFFF;
+    };
+
+    /**
+     * Handle bookkeeping of a world. Bodies created after restoring it get the same handles as they would have in the original.
+     */
+    struct HandleTable {
+        std::vector<uint32_t> slot_to_index{};
+        std::vector<uint32_t> slot_generations{};
+        std::vector<uint32_t> index_to_slot{};
+        std::vector<uint32_t> free_slots{};
+    };
+
+    /**
+     * Storage for the bodies of a rigid-body simulation.
+     * @details Simulation state lives in structure of arrays form in states. Collision geometry lives in its own table,
+     * and render data is kept by the renderer, keyed by handle.
+     * @details Bodies are densely packed. Solvers work with dense indices inside a step, everything else should hold on to BodyHandle.
+     */
+    class PhysicsWorld {
+    public:
+        /**
+         * Dynamic state of each body, indexed by dense index.
+         */
+        BodyStates states{};
+
+        /**
+         * Collider of each body, indexed by dense index.
+         */
+        std::vector<std::shared_ptr<const Mesh>> colliders{};
+
+        /**
+         * Compound collider of each body, or null for bodies with a single mesh, indexed by dense index.
+         * @details Compound bodies hold the merged mesh of their compound in colliders.
+         */
+        std::vector<std::shared_ptr<const CompoundCollider>> compound_colliders{};
+
+        /**
+         * Height field of each body, or null for bodies without one, indexed by dense index.
+         * @details Height field bodies hold the bounds mesh of their height field in colliders.
+         */
+        std::vector<std::shared_ptr<const HeightField>> height_fields{};
+
+        /**
+         * Signed distance field of each body, or null for bodies without one, indexed by dense index.
+         */
+        std::vector<std::shared_ptr<const SignedDistanceField>> signed_distance_fields{};
+
+        /**
+         * Collider transform of each body at the start of the current step, indexed by dense index.
+         * @details Includes the collider scale. Updated by updateCurrentTransforms().
+         */
+        std::vector<Eigen::Matrix4d> current_transforms{};
+
+        /**
+         * Predicted collider transform of each body at the end of the current step, indexed by dense index.
+         * @details Includes the collider scale. Updated by updateFutureTransforms().
+         */
+        std::vector<Eigen::Matrix4d> future_transforms{};
+
+        /**
+         * Collision data CollisionBounds built from each collider, or null until it runs, indexed by dense index.
+         * @details Destroying a body frees what was built for it.
+         */
+        std::vector<std::shared_ptr<const ColliderBake>> collider_bakes{};
+
+        /**
+         * Add a body.
+         * @param description Initial body state.
+         * @throws RuntimeException Scale is not positive, or a dynamic body with a height field or signed distance field.
+         * @return Handle to the new body.
+         */
+        BodyHandle createBody(const BodyDescription& description);
+
+        /**
+         * Remove a body. The last body is moved into its dense index.
+         * @param handle Body to remove.
+         * @throws RuntimeException Handle is not valid.
+         */
+        void destroyBody(BodyHandle handle);
+
+        /**
+         * Check if a handle refers to a body that still exists.
+         */
+        [[nodiscard]] bool isValid(BodyHandle handle) const;
+
+        /**
+         * Get the current dense index of a body.
+         * @throws RuntimeException Handle is not valid.
+         */
+        [[nodiscard]] uint32_t getIndex(BodyHandle handle) const;
+
+        /**
+         * Get the handle of the body at a dense index.
+         */
+        [[nodiscard]] BodyHandle getHandle(uint32_t index) const {
+            uint32_t slot = index_to_slot[index];
+            return {slot, slot_generations[slot]};
+        }
+
+        /**
+         * Get the number of bodies.
+         */
+        [[nodiscard]] uint32_t getBodyCount() const {
+            return states.size();
+        }
+
+        /**
+         * Get the handle bookkeeping, to save a world with its handles.
+         */
+        [[nodiscard]] HandleTable getHandleTable() const {
+            return {slot_to_index, slot_generations, index_to_slot, free_slots};
+        }
+
+        /**
+         * Replace the handle bookkeeping of a world with the same bodies.
+         * @param table Table from getHandleTable().
+         * @throws RuntimeException Table does not match the bodies.
+         */
+        void setHandleTable(HandleTable table);
+
+        /**
+         * Hash the simulation state, handles and excluded pairs of all bodies.
+         * @details Values are hashed bit for bit, so two worlds only hash the same if a simulation would continue identically from them.
+         * Colliders and the cached transforms are not hashed.
+         * @return 64 bit FNV-1a hash.
+         */
+        [[nodiscard]] uint64_t hashState() const;
+
+        /**
+         * Reserve storage for a number of bodies.
+         */
+        void reserve(uint32_t count);
+
+        [[nodiscard]] Eigen::Vector3d getPosition(uint32_t index) const {
+            return {states.position_x[index], states.position_y[index], states.position_z[index]};
+        }
+        void setPosition(uint32_t index, const Eigen::Vector3d& position) {
+            states.position_x[index] = position.x(); states.position_y[index] = position.y(); states.position_z[index] = position.z();
+        }
+
+        [[nodiscard]] Eigen::Quaterniond getRotation(uint32_t index) const {
+            return {states.rotation_w[index], states.rotation_x[index], states.rotation_y[index], states.rotation_z[index]};
+        }
+        void setRotation(uint32_t index, const Eigen::Quaterniond& rotation) {
+            states.rotation_w[index] = rotation.w(); states.rotation_x[index] = rotation.x(); states.rotation_y[index] = rotation.y(); states.rotation_z[index] = rotation.z();
+        }
+
+        [[nodiscard]] Eigen::Vector3d getVelocity(uint32_t index) const {
+            return {states.velocity_x[index], states.velocity_y[index], states.velocity_z[index]};
+        }
+        void setVelocity(uint32_t index, const Eigen::Vector3d& velocity) {
+            states.velocity_x[index] = velocity.x(); states.velocity_y[index] = velocity.y(); states.velocity_z[index] = velocity.z();
+        }
+
+        [[nodiscard]] Eigen::Vector3d getAngularVelocity(uint32_t index) const {
+            return {states.angular_velocity_x[index], states.angular_velocity_y[index], states.angular_velocity_z[index]};
+        }
+        void setAngularVelocity(uint32_t index, const Eigen::Vector3d& angular_velocity) {
+            states.angular_velocity_x[index] = angular_velocity.x(); states.angular_velocity_y[index] = angular_velocity.y(); states.angular_velocity_z[index] = angular_velocity.z();
+        }
+
+        [[nodiscard]] Eigen::Vector3d getForce(uint32_t index) const {
+            return {states.force_x[index], states.force_y[index], states.force_z[index]};
+        }
+        void setForce(uint32_t index, const Eigen::Vector3d& force) {
+            states.force_x[index] = force.x(); states.force_y[index] = force.y(); states.force_z[index] = force.z();
+        }
+
+        [[nodiscard]] Eigen::Vector3d getScale(uint32_t index) const {
+            return {states.scale_x[index], states.scale_y[index], states.scale_z[index]};
+        }
+        /**
+         * Set the collider scale, which takes effect at the next step.
+         * @throws RuntimeException Scale is not positive.
+         */
+        void setScale(uint32_t index, const Eigen::Vector3d& scale);
+
+        [[nodiscard]] bool hasFlag(uint32_t index, BodyFlags flag) const {
+            return (states.flags[index] & flag) != 0;
+        }
+        void setFlag(uint32_t index, BodyFlags flag, bool value) {
+            states.flags[index] = value ? (states.flags[index] | flag) : (states.flags[index] & ~flag);
+        }
+
+        [[nodiscard]] BodyType getBodyType(uint32_t index) const {
+            if(hasFlag(index, BODY_FLAG_STATIC)) return BodyType::STATIC;
+            return hasFlag(index, BODY_FLAG_KINEMATIC) ? BodyType::KINEMATIC : BodyType::DYNAMIC;
+        }
+
+        /**
+         * Check if a body is moved by forces and contacts.
+         */
+        [[nodiscard]] bool isDynamic(uint32_t index) const {
+            return (states.flags[index] & (BODY_FLAG_STATIC | BODY_FLAG_KINEMATIC)) == 0;
+        }
+
+        [[nodiscard]] uint32_t getCollisionLayer(uint32_t index) const {
+            return states.collision_layer[index];
+        }
+        [[nodiscard]] uint32_t getCollisionMask(uint32_t index) const {
+            return states.collision_mask[index];
+        }
+        void setCollisionFilter(uint32_t index, uint32_t layer, uint32_t mask) {
+            states.collision_layer[index] = layer;
+            states.collision_mask[index] = mask;
+        }
+
+        /**
+         * Stop a pair of bodies from colliding, whatever their layers.
+         * @param body_a,body_b Different bodies.
+         * @throws RuntimeException A handle is not valid, or both are the same body.
+         * @return True if the pair was not excluded before.
+         */
+        bool excludePair(BodyHandle body_a, BodyHandle body_b);
+
+        /**
+         * Let an excluded pair of bodies collide again.
+         * @throws RuntimeException A handle is not valid.
+         * @return True if the pair was excluded.
+         */
+        bool includePair(BodyHandle body_a, BodyHandle body_b);
+
+        /**
+         * Check if a pair was excluded with excludePair().
+         * @param body_a,body_b Dense indices.
+         */
+        [[nodiscard]] bool isPairExcluded(uint32_t body_a, uint32_t body_b) const {
+            return excluded_pairs.contains(index_to_slot[body_a], index_to_slot[body_b]);
+        }
+
+        /**
+         * Check if the layers of two bodies let them collide.
+         * @param body_a,body_b Dense indices.
+         */
+        [[nodiscard]] bool doLayersCollide(uint32_t body_a, uint32_t body_b) const {
+            return (states.collision_layer[body_a] & states.collision_mask[body_b]) != 0 && (states.collision_layer[body_b] & states.collision_mask[body_a]) != 0;
+        }
+
+        /**
+         * Check if a pair of bodies needs a collision test: at least one of them is dynamic, at least one of them can move,
+         * their layers collide, and the pair is not excluded.
+         * @details Cheapest checks first, the exclusion set is only probed when it is not empty.
+         */
+        [[nodiscard]] bool canPairCollide(uint32_t body_a, uint32_t body_b) const {
+            constexpr uint32_t frozen = BODY_FLAG_SLEEPING | BODY_FLAG_STATIC;
+            return (isDynamic(body_a) || isDynamic(body_b)) && !((states.flags[body_a] & frozen) && (states.flags[body_b] & frozen)) &&
+                   doLayersCollide(body_a, body_b) && !isPairExcluded(body_a, body_b);
+        }
+
+        /**
+         * Get the excluded pairs, keyed by handle slot.
+         */
+        [[nodiscard]] const PairExclusions& getPairExclusions() const {
+            return excluded_pairs;
+        }
+
+        /**
+         * Replace the excluded pairs, to restore a saved world along with its handle table.
+         */
+        void setPairExclusions(PairExclusions exclusions) {
+            excluded_pairs = std::move(exclusions);
+        }
+
+        /**
+         * Set the velocities of a kinematic body so that it reaches a pose at the end of the next step.
+         * @details The rotation is reached exactly by the integrator, as long as it turns less than half a turn in the step.
+         * @param index Kinematic body.
+         * @param position Target position.
+         * @param rotation Target rotation.
+         * @param delta_time Length of the next step.
+         * @throws RuntimeException Body is not kinematic.
+         */
+        void setKinematicTarget(uint32_t index, const Eigen::Vector3d& position, const Eigen::Quaterniond& rotation, double delta_time);
+
+        /**
+         * Get the mass of a body, or zero if it is immovable.
+         */
+        [[nodiscard]] double getMass(uint32_t index) const {
+            return states.inverse_mass[index] == 0.0 ? 0.0 : 1.0 / states.inverse_mass[index];
+        }
+
+        /**
+         * Get the local space inverse inertia tensor.
+         */
+        [[nodiscard]] Eigen::Matrix3d getInverseInertiaLocal(uint32_t index) const;
+
+        /**
+         * Get the world space inverse inertia tensor, using the current rotation.
+         */
+        [[nodiscard]] Eigen::Matrix3d getInverseInertiaWorld(uint32_t index) const;
+
+        /**
+         * Get the velocity of a point attached to a body.
+         * @param point World space point.
+         */
+        [[nodiscard]] Eigen::Vector3d getVelocityAtPoint(uint32_t index, const Eigen::Vector3d& point) const {
+            return getVelocity(index) + getAngularVelocity(index).cross(point - getPosition(index));
+        }
+
+        /**
+         * Change the velocity of a point attached to a body, ignoring mass.
+         * @param point World space point.
+         * @param add_velocity Velocity to add.
+         */
+        void addVelocityAtPoint(uint32_t index, const Eigen::Vector3d& point, const Eigen::Vector3d& add_velocity) {
+            setVelocity(index, getVelocity(index) + add_velocity);
+            setAngularVelocity(index, getAngularVelocity(index) + (point - getPosition(index)).cross(add_velocity)); //Center of gravity is the origin
+        }
+
+        /**
+         * Get the transform of a body from its current position and rotation.
+         */
+        [[nodiscard]] Eigen::Matrix4d getTransform(uint32_t index) const;
+
+        /**
+         * Get the transform of the collider of a body, its transform with the collider scale applied first.
+         */
+        [[nodiscard]] Eigen::Matrix4d getColliderTransform(uint32_t index) const;
+
+        /**
+         * Wake a body up, for example after its state was edited.
+         * @details Must be called when changing a sleeping body, or the change is ignored until something hits it.
+         */
+        void wakeBody(uint32_t index);
+
+        /**
+         * Put a body to sleep, freezing it in place.
+         */
+        void sleepBody(uint32_t index);
+
+        /**
+         * Apply constant forces and gravity to the velocities of awake bodies.
+         * @param delta_time Length of the step.
+         * @param gravity Acceleration applied to bodies with BODY_FLAG_GRAVITY.
+         */
+        void integrateForces(double delta_time, const Eigen::Vector3d& gravity);
+
+        /**
+         * Move awake bodies along their velocities.
+         * @param delta_time Length of the step.
+         */
+        void integratePositions(double delta_time);
+
+        /**
+         * Move only some bodies along their velocities.
+         * @param delta_time Length of the step.
+         * @param move_mask Non-zero for each dense index that should move.
+         */
+        void integratePositions(double delta_time, const std::vector<uint8_t>& move_mask);
+
+        /**
+         * Rebuild current_transforms from positions, rotations and scales.
+         */
+        void updateCurrentTransforms();
+
+        /**
+         * Rebuild future_transforms by predicting where each body will be after a step.
+         * @details Sleeping and static bodies do not move, their future transform is their current transform.
+         * @param delta_time Length of the step.
+         */
+        void updateFutureTransforms(double delta_time);
+
+        /**
+         * Put resting islands to sleep, and wake islands that were hit by a moving body.
+         * @param islands Islands from this step's contacts, indexed by dense index.
+         * @param delta_time Length of the step.
+         * @param settings Sleep settings.
+         */
+        void updateSleep(IslandGraph& islands, double delta_time, const SleepSettings& settings);
+
+        /**
+         * Wake a sleeping body that a moving body ran into, so the contact solver can push it.
+         * @param body_a,body_b Dense indices of the pair that hit.
+         * @param settings Velocity thresholds a body must pass to count as moving.
+         */
+        void wakeOnImpact(uint32_t body_a, uint32_t body_b, const SleepSettings& settings);
+
+    private:
+        std::vector<uint32_t> slot_to_index{};
+        std::vector<uint32_t> slot_generations{};
+        std::vector<uint32_t> index_to_slot{};
+        std::vector<uint32_t> free_slots{};
+        PairExclusions excluded_pairs{};
+    };
+
+} // EngiGraph
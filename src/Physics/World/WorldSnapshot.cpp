@@ -0,0 +1,99 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "WorldSnapshot.h"
+#include <algorithm>
+#include <cstring>
+#include "src/Exceptions/RuntimeException.h"
+#include "src/Profiling/Trace.h"
+
+namespace EngiGraph {
+
+    WorldSnapshot WorldSnapshot::capture(const PhysicsWorld& world, const WorldSnapshot* previous) {
+        ENGIGRAPH_TRACE_SCOPE("WorldSnapshot::capture");
+        WorldSnapshot snapshot;
+        snapshot.body_count = world.getBodyCount();
+        const bool can_share = previous && previous->body_count == snapshot.body_count;
+        world.states.forEachArray([&](const auto& array){
+            using Array = std::decay_t<decltype(array)>;
+            const size_t k = snapshot.arrays.size();
+            if(can_share){
+                const auto& shared = *std::static_pointer_cast<const Array>(previous->arrays[k]);
+                if(std::memcmp(shared.data(), array.data(), array.size() * sizeof(typename Array::value_type)) == 0){
+                    snapshot.arrays.push_back(previous->arrays[k]);
+                    return;
+                }
+            }
+            snapshot.arrays.push_back(std::make_shared<const Array>(array));
+        });
+        if(can_share && std::equal(world.colliders.begin(), world.colliders.end(), previous->colliders->begin())){
+            snapshot.colliders = previous->colliders;
+        }else{
+            snapshot.colliders = std::make_shared<const std::vector<std::shared_ptr<const Mesh>>>(world.colliders);
+        }
+        if(can_share && std::equal(world.compound_colliders.begin(), world.compound_colliders.end(), previous->compound_colliders->begin())){
+            snapshot.compound_colliders = previous->compound_colliders;
+        }else{
+            snapshot.compound_colliders = std::make_shared<const std::vector<std::shared_ptr<const CompoundCollider>>>(world.compound_colliders);
+        }
+        if(can_share && std::equal(world.height_fields.begin(), world.height_fields.end(), previous->height_fields->begin())){
+            snapshot.height_fields = previous->height_fields;
+        }else{
+            snapshot.height_fields = std::make_shared<const std::vector<std::shared_ptr<const HeightField>>>(world.height_fields);
+        }
+        if(can_share && std::equal(world.signed_distance_fields.begin(), world.signed_distance_fields.end(), previous->signed_distance_fields->begin())){
+            snapshot.signed_distance_fields = previous->signed_distance_fields;
+        }else{
+            snapshot.signed_distance_fields = std::make_shared<const std::vector<std::shared_ptr<const SignedDistanceField>>>(world.signed_distance_fields);
+        }
+        snapshot.handles = world.getHandleTable();
+        snapshot.excluded_pairs = world.getPairExclusions();
+        return snapshot;
+    }
+
+    void WorldSnapshot::restore(PhysicsWorld& world) const {
+        ENGIGRAPH_TRACE_SCOPE("WorldSnapshot::restore");
+        if(arrays.empty()){
+            //Default constructed, never captured
+            world = PhysicsWorld{};
+            return;
+        }
+        size_t k = 0;
+        world.states.forEachArray([&](auto& array){
+            array = *std::static_pointer_cast<const std::decay_t<decltype(array)>>(arrays[k++]);
+        });
+        world.colliders = *colliders;
+        world.compound_colliders = *compound_colliders;
+        world.height_fields = *height_fields;
+        world.signed_distance_fields = *signed_distance_fields;
+        world.setHandleTable(handles);
+        world.setPairExclusions(excluded_pairs);
+        world.current_transforms.resize(body_count);
+        world.updateCurrentTransforms();
+        world.future_transforms = world.current_transforms;
+    }
+
+    WorldSnapshotRing::WorldSnapshotRing(uint32_t capacity, uint32_t interval) : capacity(std::max(capacity, 1u)), interval(std::max(interval, 1u)) {}
+
+    bool WorldSnapshotRing::update(const PhysicsWorld& world, uint64_t step) {
+        if(!snapshots.empty() && step < snapshots.back().step + interval) return false;
+        const WorldSnapshot* previous = snapshots.empty() ? nullptr : &snapshots.back().snapshot;
+        WorldSnapshot snapshot = WorldSnapshot::capture(world, previous);
+        if(snapshots.size() >= capacity) snapshots.pop_front();
+        snapshots.push_back({step, std::move(snapshot)});
+        return true;
+    }
+
+    uint64_t WorldSnapshotRing::rewind(PhysicsWorld& world, uint64_t step) {
+        if(snapshots.empty()) throw RuntimeException("No snapshots to rewind to.");
+        auto after = std::upper_bound(snapshots.begin(), snapshots.end(), step, [](uint64_t value, const Entry& entry){ return value < entry.step; });
+        if(after == snapshots.begin()) after++;
+        const Entry& target = *(after - 1);
+        target.snapshot.restore(world);
+        const uint64_t restored_step = target.step;
+        snapshots.erase(after, snapshots.end());
+        return restored_step;
+    }
+
+} // EngiGraph
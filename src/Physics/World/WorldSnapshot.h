@@ -0,0 +1,136 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <vector>
+#include "PhysicsWorld.h"
+
+namespace EngiGraph {
+
+    /**
+     * Saved state of a PhysicsWorld that can be restored later, for start/stop and rewinding.
+     * @details Only the body state arrays, the collider table and the handle table are kept. Cached transforms are rebuilt on restore.
+     * @details Data is immutable and shared copy-on-write: capturing after another snapshot shares every array and the collider table that did not change since,
+     * so static bodies and unchanged colliders are stored once across a whole rewind history. Colliders themselves are always shared with the world.
+     */
+    class WorldSnapshot {
+    public:
+        /**
+         * Capture the state of a world.
+         * @param world World to save.
+         * @param previous Earlier snapshot to share unchanged data with, usually of the same world.
+         * @return Snapshot.
+         */
+        static WorldSnapshot capture(const PhysicsWorld& world, const WorldSnapshot* previous = nullptr);
+
+        /**
+         * Put a world back into the saved state. Bodies created since are removed, and removed bodies come back with the same handles.
+         * @details A default constructed snapshot restores an empty world.
+         * @param world World to restore.
+         */
+        void restore(PhysicsWorld& world) const;
+
+        [[nodiscard]] uint32_t getBodyCount() const {
+            return body_count;
+        }
+
+        /**
+         * Check if two snapshots share an array, for testing the sharing.
+         * @param other Other snapshot.
+         * @param array Index of the array, in BodyStates::forEachArray order.
+         */
+        [[nodiscard]] bool isArrayShared(const WorldSnapshot& other, size_t array) const {
+            return arrays[array] == other.arrays[array];
+        }
+
+        /**
+         * Check if two snapshots share their collider table.
+         */
+        [[nodiscard]] bool isColliderTableShared(const WorldSnapshot& other) const {
+            return colliders == other.colliders;
+        }
+
+    private:
+        uint32_t body_count = 0;
+        /**
+         * One immutable std::vector per BodyStates array, in BodyStates::forEachArray order.
+         */
+        std::vector<std::shared_ptr<const void>> arrays{};
+        std::shared_ptr<const std::vector<std::shared_ptr<const Mesh>>> colliders{};
+        std::shared_ptr<const std::vector<std::shared_ptr<const CompoundCollider>>> compound_colliders{};
+        std::shared_ptr<const std::vector<std::shared_ptr<const HeightField>>> height_fields{};
+        std::shared_ptr<const std::vector<std::shared_ptr<const SignedDistanceField>>> signed_distance_fields{};
+        HandleTable handles{};
+        PairExclusions excluded_pairs{};
+    };
+
+    /**
+     * Ring of periodic world snapshots, to rewind a simulation.
+     * @details With a capture every step, rewinding lands on the exact step. Longer intervals keep a longer history in the same memory,
+     * and land on the closest saved step before the target.
+     */
+    class WorldSnapshotRing {
+    public:
+        /**
+         * @param capacity Most snapshots kept. The oldest is dropped first.
+         * @param interval Steps between snapshots.
+         */
+        explicit WorldSnapshotRing(uint32_t capacity = 256, uint32_t interval = 1);
+
+        /**
+         * Call after every step, captures a snapshot when one is due.
+         * @param world World after the step.
+         * @param step Number of the step that was just done.
+         * @return True if a snapshot was captured.
+         */
+        bool update(const PhysicsWorld& world, uint64_t step);
+
+        /**
+         * Restore the newest snapshot at or before a step, or the oldest one if none is that old, and drop every snapshot after it.
+         * @param world World to restore.
+         * @param step Step to go back to.
+         * @throws RuntimeException No snapshots.
+         * @return Step that was restored.
+         */
+        uint64_t rewind(PhysicsWorld& world, uint64_t step);
+
+        /**
+         * Forget all snapshots, for example when the world was replaced.
+         */
+        void clear() {
+            snapshots.clear();
+        }
+
+        [[nodiscard]] size_t getCount() const {
+            return snapshots.size();
+        }
+
+        /**
+         * Get the oldest step that can be rewound to, or 0 if empty.
+         */
+        [[nodiscard]] uint64_t getOldestStep() const {
+            return snapshots.empty() ? 0 : snapshots.front().step;
+        }
+
+        /**
+         * Get the newest saved step, or 0 if empty.
+         */
+        [[nodiscard]] uint64_t getNewestStep() const {
+            return snapshots.empty() ? 0 : snapshots.back().step;
+        }
+
+    private:
+        struct Entry {
+            uint64_t step;
+            WorldSnapshot snapshot;
+        };
+        std::deque<Entry> snapshots{};
+        uint32_t capacity;
+        uint32_t interval;
+    };
+
+} // EngiGraph
@@ -0,0 +1,125 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <array>
+#include <chrono>
+
+namespace EngiGraph {
+
+    /**
+     * Where the time of a single solver step went.
+     */
+    struct StepProfile {
+        /**
+         * Parts of a step. Not every solver has every phase.
+         */
+        enum Phase {
+            /**
+             * Applying forces and predicting transforms.
+             */
+            PHASE_INTEGRATE_FORCES,
+            /**
+             * Pair generation and CCD.
+             */
+            PHASE_COLLISION,
+            /**
+             * Merging hits into contacts.
+             */
+            PHASE_CONTACTS,
+            /**
+             * Velocity solve.
+             */
+            PHASE_CONTACT_SOLVE,
+            PHASE_INTEGRATE_POSITIONS,
+            PHASE_SLEEP,
+            PHASE_COUNT
+        };
+
+        /**
+         * Seconds spent in each phase.
+         */
+        std::array<double, PHASE_COUNT> phase_seconds{};
+        /**
+         * Seconds spent in the whole step.
+         */
+        double total_seconds = 0.0;
+
+        /**
+         * Body pairs run through CCD.
+         */
+        uint64_t pairs_tested = 0;
+        /**
+         * CCD hits found.
+         */
+        uint64_t hits = 0;
+        /**
+         * Contacts given to the contact solver.
+         */
+        uint64_t contacts = 0;
+        /**
+         * Times the TOI solver rolled back to a time of impact.
+         */
+        uint64_t toi_iterations = 0;
+        /**
+         * Velocity solver passes.
+         */
+        uint64_t solver_iterations = 0;
+
+        /**
+         * Add the times and counters of another profile, for totals over many steps.
+         */
+        void accumulate(const StepProfile& other) {
+            for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+                phase_seconds[phase] += other.phase_seconds[phase];
+            }
+            total_seconds += other.total_seconds;
+            pairs_tested += other.pairs_tested;
+            hits += other.hits;
+            contacts += other.contacts;
+            toi_iterations += other.toi_iterations;
+            solver_iterations += other.solver_iterations;
+        }
+
+        /**
+         * Get a readable name for a phase.
+         */
+        static const char* getPhaseName(Phase phase) {
+            switch (phase) {
+                case PHASE_INTEGRATE_FORCES: return "Integrate forces";
+                case PHASE_COLLISION: return "Collision";
+                case PHASE_CONTACTS: return "Contacts";
+                case PHASE_CONTACT_SOLVE: return "Contact solve";
+                case PHASE_INTEGRATE_POSITIONS: return "Integrate positions";
+                case PHASE_SLEEP: return "Sleep";
+                default: return "Unknown";
+            }
+        }
+    };
+
+    /**
+     * Adds the time between its construction and destruction to a counter.
+     */
+    class ScopedTimer {
+    public:
+        /**
+         * Start timing.
+         * @param seconds Counter to add the elapsed seconds to.
+         */
+        explicit ScopedTimer(double& seconds) : seconds(seconds), start(std::chrono::steady_clock::now()) {}
+
+        ~ScopedTimer() {
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        double& seconds;
+        std::chrono::steady_clock::time_point start;
+    };
+
+} // EngiGraph
@@ -0,0 +1,57 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "StepProfileHistory.h"
+#include "src/Exceptions/RuntimeException.h"
+
+namespace EngiGraph {
+
+    StepProfileHistory::StepProfileHistory(uint32_t capacity) {
+        if(capacity == 0) throw RuntimeException("Step profile history needs room for at least one profile.");
+        profiles.resize(capacity);
+    }
+
+    void StepProfileHistory::push(const StepProfile& profile) {
+        if(count < profiles.size()){
+            profiles[(first + count) % profiles.size()] = profile;
+            count++;
+        }else{
+            profiles[first] = profile;
+            first = (first + 1) % profiles.size();
+        }
+    }
+
+    void StepProfileHistory::clear() {
+        first = 0;
+        count = 0;
+    }
+
+    StepProfile StepProfileHistory::getAverage() const {
+        StepProfile total{};
+        if(count == 0) return total;
+        for (uint32_t i = 0; i < count; ++i) {
+            total.accumulate(get(i));
+        }
+        for (double& seconds : total.phase_seconds) {
+            seconds /= count;
+        }
+        total.total_seconds /= count;
+        total.pairs_tested /= count;
+        total.hits /= count;
+        total.contacts /= count;
+        total.toi_iterations /= count;
+        total.solver_iterations /= count;
+        return total;
+    }
+
+    std::vector<float> StepProfileHistory::getMilliseconds(StepProfile::Phase phase) const {
+        std::vector<float> milliseconds(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const StepProfile& profile = get(i);
+            milliseconds[i] = (float)(1000.0 * (phase == StepProfile::PHASE_COUNT ? profile.total_seconds : profile.phase_seconds[phase]));
+        }
+        return milliseconds;
+    }
+
+} // EngiGraph
@@ -0,0 +1,67 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <vector>
+#include "StepProfile.h"
+
+namespace EngiGraph {
+
+    /**
+     * The most recent step profiles, for graphing.
+     * @details Fixed size ring buffer, old profiles are overwritten.
+     */
+    class StepProfileHistory {
+    public:
+        /**
+         * Create an empty history.
+         * @param capacity Number of profiles kept.
+         */
+        explicit StepProfileHistory(uint32_t capacity = 240);
+
+        /**
+         * Add the profile of a step, dropping the oldest one when full.
+         */
+        void push(const StepProfile& profile);
+
+        /**
+         * Remove all profiles.
+         */
+        void clear();
+
+        /**
+         * Get the number of profiles kept.
+         */
+        [[nodiscard]] uint32_t getCount() const {
+            return count;
+        }
+
+        /**
+         * Get a profile by age.
+         * @param index 0 for the oldest profile, getCount()-1 for the newest.
+         */
+        [[nodiscard]] const StepProfile& get(uint32_t index) const {
+            return profiles[(first + index) % profiles.size()];
+        }
+
+        /**
+         * Get the mean of all kept profiles. Counters are rounded down.
+         */
+        [[nodiscard]] StepProfile getAverage() const;
+
+        /**
+         * Get the time of a phase for each kept profile, oldest first.
+         * @param phase Phase to get, or PHASE_COUNT for the whole step.
+         * @return Milliseconds per profile.
+         */
+        [[nodiscard]] std::vector<float> getMilliseconds(StepProfile::Phase phase) const;
+
+    private:
+        std::vector<StepProfile> profiles;
+        uint32_t first = 0;
+        uint32_t count = 0;
+    };
+
+} // EngiGraph
@@ -0,0 +1,154 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "Trace.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include "src/Exceptions/RuntimeException.h"
+
+namespace EngiGraph {
+
+    namespace {
+
+        struct TraceEvent {
+            const char* name;
+            uint64_t start;
+            uint64_t duration;
+        };
+
+        /**
+         * Events of one thread.
+         * @details Only the owning thread records, the mutex is only contended while the trace is read.
+         */
+        struct TraceBuffer {
+            static constexpr size_t CAPACITY = 1 << 16;
+
+            std::mutex mutex;
+            std::vector<TraceEvent> events;
+            /**
+             * Total events recorded. Events wrap around once this passes the capacity.
+             */
+            uint64_t recorded = 0;
+            uint32_t thread_id = 0;
+            std::string thread_name;
+        };
+
+        std::atomic<bool> tracing_enabled{false};
+        const auto trace_epoch = std::chrono::steady_clock::now();
+
+        std::mutex registry_mutex;
+        /**
+         * Buffers of every thread that recorded, kept after their thread exits.
+         */
+        std::vector<std::shared_ptr<TraceBuffer>>& getBuffers() {
+            static std::vector<std::shared_ptr<TraceBuffer>> buffers;
+            return buffers;
+        }
+
+        TraceBuffer& getThreadBuffer() {
+            thread_local std::shared_ptr<TraceBuffer> buffer = [](){
+                auto new_buffer = std::make_shared<TraceBuffer>();
+                new_buffer->events.resize(TraceBuffer::CAPACITY);
+                std::lock_guard<std::mutex> lock(registry_mutex);
+                new_buffer->thread_id = (uint32_t)getBuffers().size() + 1;
+                new_buffer->thread_name = "Thread " + std::to_string(new_buffer->thread_id);
+                getBuffers().push_back(new_buffer);
+                return new_buffer;
+            }();
+            return *buffer;
+        }
+
+        uint64_t getTraceTime() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace_epoch).count();
+        }
+
+        /**
+         * Write a string as a JSON string literal.
+         */
+        void writeJsonString(std::ostream& stream, const std::string& text) {
+            stream << '"';
+            for (char character : text) {
+                if(character == '"' || character == '\\') stream << '\\' << character;
+                else if((unsigned char)character < 0x20) stream << ' ';
+                else stream << character;
+            }
+            stream << '"';
+        }
+
+    }
+
+    void setTracingEnabled(bool enabled) {
+        tracing_enabled.store(enabled);
+    }
+
+    bool isTracingEnabled() {
+        return tracing_enabled.load(std::memory_order_relaxed);
+    }
+
+    void setTraceThreadName(const std::string& name) {
+        TraceBuffer& buffer = getThreadBuffer();
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        buffer.thread_name = name;
+    }
+
+    void clearTrace() {
+        std::lock_guard<std::mutex> registry_lock(registry_mutex);
+        for (const auto& buffer : getBuffers()) {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            buffer->recorded = 0;
+        }
+    }
+
+    std::string getChromeTraceJson() {
+        std::ostringstream json;
+        json.precision(3);
+        json << std::fixed << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        std::lock_guard<std::mutex> registry_lock(registry_mutex);
+        for (const auto& buffer : getBuffers()) {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            if(!first) json << ',';
+            first = false;
+            json << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->thread_id << ",\"args\":{\"name\":";
+            writeJsonString(json, buffer->thread_name);
+            json << "}}";
+            const uint64_t count = std::min<uint64_t>(buffer->recorded, TraceBuffer::CAPACITY);
+            for (uint64_t i = buffer->recorded - count; i < buffer->recorded; ++i) {
+                const TraceEvent& event = buffer->events[i % TraceBuffer::CAPACITY];
+                //Chrome traces are in microseconds
+                json << ",{\"name\":";
+                writeJsonString(json, event.name);
+                json << ",\"cat\":\"EngiGraph\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->thread_id
+                     << ",\"ts\":" << event.start / 1000.0 << ",\"dur\":" << event.duration / 1000.0 << '}';
+            }
+        }
+        json << "]}";
+        return json.str();
+    }
+
+    void writeChromeTrace(const std::string& filename) {
+        std::ofstream file(filename);
+        if(!file) throw RuntimeException("Problem writing trace file : " + filename);
+        file << getChromeTraceJson();
+        if(!file) throw RuntimeException("Problem writing trace file : " + filename);
+    }
+
+    TraceScope::TraceScope(const char* name) : name(name), start(isTracingEnabled() ? getTraceTime() : UINT64_MAX) {}
+
+    TraceScope::~TraceScope() {
+        if(start == UINT64_MAX) return;
+        const uint64_t end = getTraceTime();
+        TraceBuffer& buffer = getThreadBuffer();
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        buffer.events[buffer.recorded % TraceBuffer::CAPACITY] = {name, start, end - start};
+        buffer.recorded++;
+    }
+
+} // EngiGraph
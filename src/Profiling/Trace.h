@@ -0,0 +1,82 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace EngiGraph {
+
+    /**
+     * Start or stop recording trace events. Off by default.
+     */
+    void setTracingEnabled(bool enabled);
+
+    /**
+     * Check if trace events are being recorded.
+     */
+    [[nodiscard]] bool isTracingEnabled();
+
+    /**
+     * Name the calling thread in traces. Unnamed threads are shown as "Thread N".
+     */
+    void setTraceThreadName(const std::string& name);
+
+    /**
+     * Remove all recorded events.
+     */
+    void clearTrace();
+
+    /**
+     * Get the recorded events as Chrome trace event JSON, for chrome://tracing or Perfetto.
+     */
+    [[nodiscard]] std::string getChromeTraceJson();
+
+    /**
+     * Write the recorded events to a Chrome trace event JSON file.
+     * @param filename Location of the file.
+     * @throws RuntimeException Problem writing the file.
+     */
+    void writeChromeTrace(const std::string& filename);
+
+    /**
+     * Records the time between its construction and destruction as a trace event, if tracing is enabled.
+     * @details Events go into a ring buffer owned by the recording thread, so when it fills up the oldest events are dropped.
+     * Use ENGIGRAPH_TRACE_SCOPE instead, so tracing can be compiled out.
+     */
+    class TraceScope {
+    public:
+        /**
+         * Start an event.
+         * @param name Event name. Must outlive the trace, like a string literal.
+         */
+        explicit TraceScope(const char* name);
+
+        ~TraceScope();
+
+        TraceScope(const TraceScope&) = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+
+    private:
+        const char* name;
+        /**
+         * Nanoseconds since the trace clock started, or UINT64_MAX if tracing was off.
+         */
+        uint64_t start;
+    };
+
+} // EngiGraph
+
+//Tracing is compiled in only if ENGIGRAPH_TRACING is defined
+#ifdef ENGIGRAPH_TRACING
+#define ENGIGRAPH_TRACE_CONCATENATE_INNER(a, b) a##b
+#define ENGIGRAPH_TRACE_CONCATENATE(a, b) ENGIGRAPH_TRACE_CONCATENATE_INNER(a, b)
+/**
+ * Trace the rest of the current scope as an event with a name.
+ */
+#define ENGIGRAPH_TRACE_SCOPE(name) EngiGraph::TraceScope ENGIGRAPH_TRACE_CONCATENATE(trace_scope_, __LINE__)(name)
+#else
+#define ENGIGRAPH_TRACE_SCOPE(name) ((void)0)
+#endif
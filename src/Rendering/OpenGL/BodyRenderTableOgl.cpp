@@ -0,0 +1,56 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "BodyRenderTableOgl.h"
+
+namespace EngiGraph {
+
+    void BodyRenderTableOgl::set(BodyHandle body, const Entry& entry) {
+        if(body.slot >= entries.size()){
+            entries.resize(body.slot + 1);
+            owners.resize(body.slot + 1);
+        }
+        entries[body.slot] = entry;
+        owners[body.slot] = body;
+    }
+
+    void BodyRenderTableOgl::remove(BodyHandle body) {
+        if(find(body) == nullptr) return;
+        entries[body.slot] = Entry{};
+        owners[body.slot] = BodyHandle{};
+    }
+
+    const BodyRenderTableOgl::Entry* BodyRenderTableOgl::find(BodyHandle body) const {
+        if(body.slot >= entries.size() || owners[body.slot] != body) return nullptr;
+        return &entries[body.slot];
+    }
+
+    void BodyRenderTableOgl::submitDrawCalls(DeferredPipelineOgl& pipeline, const PhysicsWorld& world) const {
+        for (uint32_t j = 0; j < world.getBodyCount(); ++j) {
+            const Entry* entry = find(world.getHandle(j));
+            if(entry == nullptr) continue;
+            Eigen::Matrix4d transform = world.getTransform(j) * entry->local_transform;
+            pipeline.submitDrawCall(DeferredPipelineOgl::DrawCall{entry->mesh, entry->albedo, transform.cast<float>()});
+        }
+    }
+
+    void BodyRenderTableOgl::submitDrawCalls(DeferredPipelineOgl& pipeline, const TransformSnapshot& previous, const TransformSnapshot& current, double alpha) const {
+        for (uint32_t j = 0; j < current.getBodyCount(); ++j) {
+            const Entry* entry = find(current.handles[j]);
+            if(entry == nullptr) continue;
+            Eigen::Matrix4d transform = current.getInterpolatedTransform(previous, j, alpha) * entry->local_transform;
+            pipeline.submitDrawCall(DeferredPipelineOgl::DrawCall{entry->mesh, entry->albedo, transform.cast<float>()});
+        }
+    }
+
+    void BodyRenderTableOgl::submitDrawCalls(DeferredPipelineOgl& pipeline, const TrajectoryFrame& frame) const {
+        for (uint32_t j = 0; j < frame.getBodyCount(); ++j) {
+            const Entry* entry = find(frame.handles[j]);
+            if(entry == nullptr) continue;
+            Eigen::Matrix4d transform = frame.getTransform(j) * entry->local_transform;
+            pipeline.submitDrawCall(DeferredPipelineOgl::DrawCall{entry->mesh, entry->albedo, transform.cast<float>()});
+        }
+    }
+
+} // EngiGraph
@@ -0,0 +1,83 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "./src/Rendering/OpenGL/PipeLines/DeferredPipelineOgl.h"
+#include "./src/Physics/World/PhysicsWorld.h"
+#include "./src/Physics/Threading/TransformSnapshot.h"
+#include "./src/FileIO/TrajectoryFile.h"
+
+namespace EngiGraph {
+
+    /**
+     * Render data for the bodies of a physics world, kept apart from the simulation state.
+     * @details Entries are keyed by body handle, so they stay attached to their body when the world reorders bodies.
+     */
+    class BodyRenderTableOgl {
+    public:
+        /**
+         * How to draw a single body.
+         */
+        struct Entry {
+            std::shared_ptr<MeshResourceOgl> mesh;
+            std::shared_ptr<TextureResourceOgl> albedo;
+            /**
+             * Transform from render mesh space to body space, applied before the body transform.
+             */
+            Eigen::Matrix4d local_transform = Eigen::Matrix4d::Identity();
+        };
+
+        /**
+         * Set how a body is drawn.
+         * @param body Body handle.
+         * @param entry Render data.
+         */
+        void set(BodyHandle body, const Entry& entry);
+
+        /**
+         * Stop drawing a body.
+         * @param body Body handle.
+         */
+        void remove(BodyHandle body);
+
+        /**
+         * Get the render data of a body.
+         * @param body Body handle.
+         * @return Nullptr if the body has no render data.
+         */
+        [[nodiscard]] const Entry* find(BodyHandle body) const;
+
+        /**
+         * Submit a draw call for every body in a world that has render data.
+         * @param pipeline Pipeline to draw with.
+         * @param world World containing body transforms.
+         */
+        void submitDrawCalls(DeferredPipelineOgl& pipeline, const PhysicsWorld& world) const;
+
+        /**
+         * Submit a draw call for every body in a snapshot that has render data, blending from an older snapshot.
+         * @param pipeline Pipeline to draw with.
+         * @param previous Older snapshot.
+         * @param current Newer snapshot. Only bodies in this snapshot are drawn.
+         * @param alpha 0 to draw the previous state, 1 to draw the current state.
+         */
+        void submitDrawCalls(DeferredPipelineOgl& pipeline, const TransformSnapshot& previous, const TransformSnapshot& current, double alpha) const;
+
+        /**
+         * Submit a draw call for every body in a trajectory frame that has render data.
+         * @param pipeline Pipeline to draw with.
+         * @param frame Poses read from a trajectory file.
+         */
+        void submitDrawCalls(DeferredPipelineOgl& pipeline, const TrajectoryFrame& frame) const;
+
+    private:
+        //Both indexed by handle slot
+        std::vector<Entry> entries{};
+        std::vector<BodyHandle> owners{};
+    };
+
+} // EngiGraph
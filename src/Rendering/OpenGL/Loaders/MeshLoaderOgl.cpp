@@ -4,10 +4,12 @@
 
 #include "MeshLoaderOgl.h"
 #include "./src/Exceptions/RuntimeException.h"
+#include "./src/Profiling/Trace.h"
 
 namespace EngiGraph {
 
     std::shared_ptr<MeshResourceOgl> loadMeshOgl(const VisualMesh &cpu_mesh) {
+        ENGIGRAPH_TRACE_SCOPE("loadMeshOgl");
         auto gpu_mesh = std::make_shared<MeshResourceOgl>();
 
         //make sure mesh is render-able as a triangle mesh.
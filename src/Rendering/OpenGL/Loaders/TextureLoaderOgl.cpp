@@ -3,10 +3,12 @@
 //
 
 #include "TextureLoaderOgl.h"
+#include "./src/Profiling/Trace.h"
 
 namespace EngiGraph {
 
     std::shared_ptr<TextureResourceOgl> loadTextureOgl(const Image<uint32_t> &cpu_image) {
+        ENGIGRAPH_TRACE_SCOPE("loadTextureOgl");
         auto gpu_texture = std::make_shared<TextureResourceOgl>();
 
         glGenTextures(1, &gpu_texture->texture_id);
@@ -7,6 +7,7 @@
 #include "./src/Rendering/OpenGL/Loaders/MeshLoaderOgl.h"
 #include "./src/FileIO/ImageIo.h"
 #include "./src/Rendering/OpenGL/Loaders/TextureLoaderOgl.h"
+#include "./src/Profiling/Trace.h"
 
 //todo instanced lighting rendering
 
@@ -27,6 +28,7 @@ namespace EngiGraph {
     }
 
     void DeferredPipelineOgl::render() {
+        ENGIGRAPH_TRACE_SCOPE("DeferredPipelineOgl::render");
         glViewport(0,0,getMainFramebuffer().width,getMainFramebuffer().height);
 
         glEnable(GL_DEPTH_TEST);
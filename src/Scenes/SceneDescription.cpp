@@ -0,0 +1,239 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "SceneDescription.h"
+#include <fstream>
+#include <sstream>
+#include "src/Exceptions/RuntimeException.h"
+#include "src/FileIO/FileUtils.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+
+namespace EngiGraph {
+
+    /**
+     * Read a vector from a scene line.
+     */
+    static Eigen::Vector3d readVector(std::istringstream& line, const std::string& error) {
+        Eigen::Vector3d vector;
+        if(!(line >> vector.x() >> vector.y() >> vector.z())) throw RuntimeException(error);
+        return vector;
+    }
+
+    SceneDescription parseScene(const std::string& text) {
+        SceneDescription scene{};
+        std::istringstream lines(text);
+        std::string raw_line;
+        uint32_t line_number = 0;
+        while (std::getline(lines, raw_line)) {
+            line_number++;
+            raw_line = raw_line.substr(0, raw_line.find('#'));
+            std::istringstream line(raw_line);
+            std::string command;
+            if(!(line >> command)) continue;
+            const std::string error = "Bad scene line " + std::to_string(line_number) + ": " + raw_line;
+
+            if(command == "solver"){
+                std::string name;
+                line >> name;
+                if(name == "vbd") scene.solver = SceneSolver::VBD;
+                else if(name == "toi") scene.solver = SceneSolver::TOI;
+                else if(name == "speculative") scene.solver = SceneSolver::TOI_SPECULATIVE;
+                else throw RuntimeException(error);
+            }else if(command == "delta_time"){
+                if(!(line >> scene.delta_time) || scene.delta_time <= 0.0) throw RuntimeException(error);
+            }else if(command == "steps"){
+                if(!(line >> scene.steps)) throw RuntimeException(error);
+            }else if(command == "gravity"){
+                scene.gravity = readVector(line, error);
+            }else if(command == "box"){
+                SceneBody body{};
+                body.scale = readVector(line, error);
+                scene.bodies.push_back(body);
+            }else if(command == "torus"){
+                SceneBody body{};
+                body.shape = SceneShape::TORUS;
+                if(!(line >> body.scale.x() >> body.scale.y()) || body.scale.y() <= 0.0 || body.scale.x() <= body.scale.y()) throw RuntimeException(error);
+                body.scale.z() = 0.0;
+                scene.bodies.push_back(body);
+            }else if(command == "mesh" || command == "compound" || command == "terrain"){
+                SceneBody body{};
+                if(command == "mesh") body.shape = SceneShape::MESH;
+                else if(command == "compound") body.shape = SceneShape::COMPOUND;
+                else{
+                    body.shape = SceneShape::TERRAIN;
+                    body.description.type = BodyType::STATIC;
+                    body.description.mass = 0.0;
+                    body.description.gravity = false;
+                }
+                if(!(line >> body.mesh_file)) throw RuntimeException(error);
+                double scale_x;
+                if(line >> scale_x){
+                    double scale_y, scale_z;
+                    if(!(line >> scale_y >> scale_z)) throw RuntimeException(error);
+                    body.scale = {scale_x, scale_y, scale_z};
+                }
+                scene.bodies.push_back(body);
+            }else{
+                //Everything else changes the last body
+                if(scene.bodies.empty()) throw RuntimeException(error + " (no body to change)");
+                BodyDescription& description = scene.bodies.back().description;
+                if(command == "position"){
+                    description.position = readVector(line, error);
+                }else if(command == "rotation"){
+                    Eigen::Vector3d axis = readVector(line, error);
+                    double degrees;
+                    if(!(line >> degrees) || axis.norm() == 0.0) throw RuntimeException(error);
+                    description.rotation = Eigen::AngleAxisd(degrees * M_PI / 180.0, axis.normalized());
+                }else if(command == "velocity"){
+                    description.velocity = readVector(line, error);
+                }else if(command == "angular_velocity"){
+                    description.angular_velocity = readVector(line, error);
+                }else if(command == "force"){
+                    description.force = readVector(line, error);
+                }else if(command == "mass"){
+                    if(!(line >> description.mass) || description.mass < 0.0) throw RuntimeException(error);
+                }else if(command == "static"){
+                    description.type = BodyType::STATIC;
+                    description.mass = 0.0;
+                    description.gravity = false;
+                }else if(command == "kinematic"){
+                    description.type = BodyType::KINEMATIC;
+                    description.mass = 0.0;
+                    description.gravity = false;
+                }else if(command == "layer"){
+                    if(!(line >> description.collision_layer)) throw RuntimeException(error);
+                }else if(command == "mask"){
+                    if(!(line >> description.collision_mask)) throw RuntimeException(error);
+                }else if(command == "distance_field"){
+                    SceneBody& body = scene.bodies.back();
+                    if(!(line >> body.distance_field_cell_size) || body.distance_field_cell_size <= 0.0 || body.shape == SceneShape::TERRAIN) throw RuntimeException(error);
+                    if(description.type == BodyType::DYNAMIC){
+                        description.type = BodyType::STATIC;
+                        description.mass = 0.0;
+                        description.gravity = false;
+                    }
+                }else if(command == "exclude"){
+                    uint32_t other;
+                    if(!(line >> other) || other + 1 >= scene.bodies.size()) throw RuntimeException(error + " (exclude needs an earlier body)");
+                    scene.bodies.back().excluded_bodies.push_back(other);
+                }else{
+                    throw RuntimeException(error + " (unknown command)");
+                }
+            }
+        }
+        return scene;
+    }
+
+    SceneDescription loadScene(const std::string& filename) {
+        validateFileExistence(filename);
+        std::ifstream file(filename);
+        if(!file) throw RuntimeException("Problem reading scene file : " + filename);
+        std::stringstream text;
+        text << file.rdbuf();
+        return parseScene(text.str());
+    }
+
+    std::string writeScene(const SceneDescription& scene) {
+        std::ostringstream text;
+        text.precision(17);
+        auto write_vector = [&](const char* command, const Eigen::Vector3d& vector){
+            text << command << ' ' << vector.x() << ' ' << vector.y() << ' ' << vector.z() << '\n';
+        };
+        const char* solver_names[] = {"vbd", "toi", "speculative"};
+        text << "solver " << solver_names[(int)scene.solver] << '\n';
+        text << "delta_time " << scene.delta_time << '\n';
+        text << "steps " << scene.steps << '\n';
+        write_vector("gravity", scene.gravity);
+        const BodyDescription defaults{};
+        for (const auto& body : scene.bodies) {
+            text << '\n';
+            if(body.shape == SceneShape::BOX) write_vector("box", body.scale);
+            else if(body.shape == SceneShape::TORUS) text << "torus " << body.scale.x() << ' ' << body.scale.y() << '\n';
+            else text << (body.shape == SceneShape::MESH ? "mesh " : body.shape == SceneShape::COMPOUND ? "compound " : "terrain ") << body.mesh_file << ' ' << body.scale.x() << ' ' << body.scale.y() << ' ' << body.scale.z() << '\n';
+            const BodyDescription& description = body.description;
+            if(description.position != defaults.position) write_vector("position", description.position);
+            if(!description.rotation.coeffs().isApprox(defaults.rotation.coeffs(), 0.0)){
+                Eigen::AngleAxisd rotation(description.rotation);
+                text << "rotation " << rotation.axis().x() << ' ' << rotation.axis().y() << ' ' << rotation.axis().z() << ' ' << rotation.angle() * 180.0 / M_PI << '\n';
+            }
+            if(description.velocity != defaults.velocity) write_vector("velocity", description.velocity);
+            if(description.angular_velocity != defaults.angular_velocity) write_vector("angular_velocity", description.angular_velocity);
+            if(description.force != defaults.force) write_vector("force", description.force);
+            if(description.type == BodyType::KINEMATIC){
+                text << "kinematic\n";
+            }else if(description.type == BodyType::STATIC || (description.mass == 0.0 && !description.gravity)){
+                text << "static\n";
+            }else if(description.mass != defaults.mass){
+                text << "mass " << description.mass << '\n';
+            }
+            if(description.collision_layer != defaults.collision_layer) text << "layer " << description.collision_layer << '\n';
+            if(description.collision_mask != defaults.collision_mask) text << "mask " << description.collision_mask << '\n';
+            if(body.distance_field_cell_size > 0.0) text << "distance_field " << body.distance_field_cell_size << '\n';
+            for (uint32_t other : body.excluded_bodies) text << "exclude " << other << '\n';
+        }
+        return text.str();
+    }
+
+    void saveScene(const SceneDescription& scene, const std::string& filename) {
+        std::ofstream file(filename);
+        if(!file) throw RuntimeException("Problem writing scene file : " + filename);
+        file << writeScene(scene);
+        if(!file) throw RuntimeException("Problem writing scene file : " + filename);
+    }
+
+    std::vector<BodyHandle> buildScene(const SceneDescription& scene, PhysicsWorld& world) {
+        ColliderRegistry& registry = ColliderRegistry::getShared();
+        std::vector<BodyHandle> handles;
+        handles.reserve(scene.bodies.size());
+        world.reserve(world.getBodyCount() + (uint32_t)scene.bodies.size());
+        for (const auto& body : scene.bodies) {
+            BodyDescription description = body.description;
+            //Box and mesh sizes are body scales, so every body of a shape shares one collider
+            if(body.shape == SceneShape::TORUS){
+                description.collider = registry.getTorus((float)body.scale.x(), (float)body.scale.y());
+            }else if(body.shape == SceneShape::COMPOUND){
+                description.compound = registry.loadCompound(body.mesh_file);
+                description.collider = description.compound->getMergedMesh();
+                description.scale = body.scale;
+            }else if(body.shape == SceneShape::TERRAIN){
+                description.height_field = registry.loadHeightField(body.mesh_file);
+                description.scale = body.scale;
+            }else{
+                description.collider = body.shape == SceneShape::BOX ? registry.getBox() : registry.loadMesh(body.mesh_file);
+                description.scale = body.scale;
+            }
+            if(body.distance_field_cell_size > 0.0){
+                description.signed_distance_field = registry.getSignedDistanceField(description.collider, body.distance_field_cell_size);
+            }
+            if(description.mass > 0.0 && description.collider && !description.collider->vertices.empty()){
+                const Mesh& collider = *description.collider;
+                //Solid inertia of the collider, computed once per collider and scaled to the body
+                MassProperties properties = registry.getMassProperties(description.collider, MassModel::SOLID, 1.0, description.scale);
+                if(properties.mass > 0.0){
+                    description.inertia_tensor = properties.getInertiaTensor() * (description.mass / properties.mass);
+                }else{
+                    //Open or inside out meshes have no volume, use a solid box filling the bounds instead
+                    Eigen::Vector3d minimum = collider.vertices[0].cast<double>();
+                    Eigen::Vector3d maximum = minimum;
+                    for (const auto& vertex : collider.vertices) {
+                        minimum = minimum.cwiseMin(vertex.cast<double>());
+                        maximum = maximum.cwiseMax(vertex.cast<double>());
+                    }
+                    Eigen::Vector3d size = (maximum - minimum).cwiseProduct(description.scale);
+                    Eigen::Vector3d squared = size.cwiseProduct(size);
+                    description.inertia_tensor = Eigen::Vector3d{squared.y() + squared.z(), squared.x() + squared.z(), squared.x() + squared.y()}.asDiagonal();
+                    description.inertia_tensor *= description.mass / 12.0;
+                }
+            }
+            handles.push_back(world.createBody(description));
+        }
+        for (size_t i = 0; i < scene.bodies.size(); ++i) {
+            for (uint32_t other : scene.bodies[i].excluded_bodies) {
+                world.excludePair(handles[i], handles[other]);
+            }
+        }
+        return handles;
+    }
+
+} // EngiGraph
@@ -0,0 +1,138 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <Eigen>
+#include <memory>
+#include <string>
+#include <vector>
+#include "src/Physics/World/PhysicsWorld.h"
+
+namespace EngiGraph {
+
+    /**
+     * Solvers a scene can be run with.
+     */
+    enum class SceneSolver {
+        VBD,
+        TOI,
+        /**
+         * TOISolver in speculative contact mode.
+         */
+        TOI_SPECULATIVE
+    };
+
+    /**
+     * Collider shapes of scene bodies.
+     */
+    enum class SceneShape {
+        BOX,
+        /**
+         * Torus around the local y axis.
+         */
+        TORUS,
+        /**
+         * Geometry from an OBJ file.
+         */
+        MESH,
+        /**
+         * Compound collider with one child per shape of an OBJ file.
+         */
+        COMPOUND,
+        /**
+         * Height field from the red channel of an image, always static or kinematic.
+         */
+        TERRAIN
+    };
+
+    /**
+     * A body in a scene file.
+     */
+    struct SceneBody {
+        SceneShape shape = SceneShape::BOX;
+        /**
+         * OBJ file of the collider for SceneShape::MESH and SceneShape::COMPOUND, or the image for SceneShape::TERRAIN.
+         */
+        std::string mesh_file{};
+        /**
+         * Box side lengths, scale of the OBJ geometry, or the major and minor radius of a torus in x and y.
+         * For terrain, the sample spacing in x and z, and the height of a full red value in y.
+         */
+        Eigen::Vector3d scale = {1,1,1};
+        /**
+         * Cell size of a signed distance field to collide with, in collider space before the scale, or zero for none.
+         */
+        double distance_field_cell_size = 0.0;
+        /**
+         * Initial state. A mass of zero makes the body static.
+         */
+        BodyDescription description{};
+        /**
+         * Indices of earlier scene bodies this body never collides with.
+         */
+        std::vector<uint32_t> excluded_bodies{};
+    };
+
+    /**
+     * Everything needed to run a simulation without a window.
+     */
+    struct SceneDescription {
+        SceneSolver solver = SceneSolver::VBD;
+        double delta_time = 0.01;
+        uint32_t steps = 1000;
+        Eigen::Vector3d gravity = {0.0,-9.8,0.0};
+        std::vector<SceneBody> bodies{};
+    };
+
+    /**
+     * Read a scene from text.
+     * @param text Scene text.
+     * @details One command per line, # starts a comment. Global settings:
+     * solver vbd|toi|speculative, delta_time seconds, steps count, gravity x y z.
+     * Bodies start with "box sx sy sz", "torus major_radius minor_radius", "mesh file.obj [sx sy sz]", "compound file.obj [sx sy sz]"
+     * or "terrain file.png [sx sy sz]", and following lines change the last body:
+     * position x y z, rotation axis_x axis_y axis_z degrees, velocity x y z, angular_velocity x y z, force x y z, mass m, static, kinematic,
+     * layer bits, mask bits, exclude body_index, distance_field cell_size. Terrain starts out static. Bodies with a distance field become static
+     * unless they are kinematic, and can not be terrain. Kinematic bodies keep their initial velocity. Exclude takes the index of an earlier body, counted from 0.
+     * @throws RuntimeException Unknown command or bad arguments.
+     * @return Scene.
+     */
+    SceneDescription parseScene(const std::string& text);
+
+    /**
+     * Load a scene file.
+     * @param filename Location of the scene file. Mesh files are relative to the working directory.
+     * @throws RuntimeException Problem reading or parsing the file.
+     * @return Scene.
+     */
+    SceneDescription loadScene(const std::string& filename);
+
+    /**
+     * Write a scene as text that parseScene() reads back.
+     * @details Numbers are written with full precision. Rotations are written as axis and angle, so they round-trip to within rounding.
+     */
+    std::string writeScene(const SceneDescription& scene);
+
+    /**
+     * Save a scene file.
+     * @param scene Scene to save.
+     * @param filename Location of the scene file.
+     * @throws RuntimeException Problem writing the file.
+     */
+    void saveScene(const SceneDescription& scene, const std::string& filename);
+
+    /**
+     * Add the bodies of a scene to a world.
+     * @details Colliders come from the shared ColliderRegistry. Box and mesh sizes become the body scale, so bodies of the same shape share one collider.
+     * Inertia is that of the solid collider about its center of mass, or of a solid box filling its bounds if the collider is not closed.
+     * Excluded bodies become excluded pairs of the world.
+     * @param scene Scene to add.
+     * @param world World to add bodies to.
+     * @throws RuntimeException Problem loading a mesh or image, or baking a distance field.
+     * @return Handle of each scene body, in order.
+     */
+    std::vector<BodyHandle> buildScene(const SceneDescription& scene, PhysicsWorld& world);
+
+} // EngiGraph
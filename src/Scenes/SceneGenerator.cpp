@@ -0,0 +1,203 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "SceneGenerator.h"
+#include <cmath>
+#include <random>
+#include "src/Exceptions/RuntimeException.h"
+
+namespace EngiGraph {
+
+    namespace {
+
+        /**
+         * Random numbers that are the same on every standard library.
+         * @details The mt19937 sequence is fixed by the standard, but the distributions are not.
+         */
+        class SceneRandom {
+        public:
+            explicit SceneRandom(uint32_t seed) : engine(seed) {}
+
+            double uniform(double minimum, double maximum) {
+                return minimum + (maximum - minimum) * (engine() / 4294967296.0);
+            }
+
+            Eigen::Quaterniond rotation() {
+                //Uniform random rotation from three uniform numbers
+                const double u1 = uniform(0, 1), u2 = uniform(0, 2.0 * M_PI), u3 = uniform(0, 2.0 * M_PI);
+                return Eigen::Quaterniond(std::sqrt(u1) * std::cos(u3), std::sqrt(1 - u1) * std::sin(u2), std::sqrt(1 - u1) * std::cos(u2), std::sqrt(u1) * std::sin(u3));
+            }
+
+        private:
+            std::mt19937 engine;
+        };
+
+        SceneBody makeBox(const Eigen::Vector3d& dimensions, const Eigen::Vector3d& position) {
+            SceneBody body{};
+            body.scale = dimensions;
+            body.description.position = position;
+            return body;
+        }
+
+        SceneBody makeStatic(SceneBody body) {
+            body.description.type = BodyType::STATIC;
+            body.description.mass = 0.0;
+            body.description.gravity = false;
+            return body;
+        }
+
+        /**
+         * Number of groups so that count bodies fill a square grid.
+         */
+        uint32_t gridSide(uint32_t count) {
+            return std::max(1u, (uint32_t)std::ceil(std::sqrt((double)count)));
+        }
+
+        /**
+         * Add a floor under everything generated so far.
+         */
+        void addFloor(SceneDescription& scene) {
+            Eigen::Vector2d minimum{0, 0}, maximum{0, 0};
+            for (const auto& body : scene.bodies) {
+                const Eigen::Vector3d& position = body.description.position;
+                minimum = minimum.cwiseMin(Eigen::Vector2d{position.x(), position.z()});
+                maximum = maximum.cwiseMax(Eigen::Vector2d{position.x(), position.z()});
+            }
+            const Eigen::Vector2d center = 0.5 * (minimum + maximum);
+            const Eigen::Vector2d size = (maximum - minimum).array() + 10.0;
+            scene.bodies.insert(scene.bodies.begin(), makeStatic(makeBox({size.x(), 1.0, size.y()}, {center.x(), -0.5, center.y()})));
+        }
+
+        void generateBoxStacks(SceneDescription& scene, uint32_t count, SceneRandom& random) {
+            const uint32_t height = 10;
+            const uint32_t side = gridSide((count + height - 1) / height);
+            for (uint32_t i = 0; i < count; ++i) {
+                const uint32_t stack = i / height, level = i % height;
+                SceneBody box = makeBox({1, 1, 1}, {(stack % side) * 2.5 + random.uniform(-0.02, 0.02), 0.5 + level * 1.01, (stack / side) * 2.5 + random.uniform(-0.02, 0.02)});
+                box.description.rotation = Eigen::AngleAxisd(random.uniform(-0.05, 0.05), Eigen::Vector3d::UnitY());
+                scene.bodies.push_back(box);
+            }
+        }
+
+        void generateRandomPile(SceneDescription& scene, uint32_t count, SceneRandom& random) {
+            //One body per cell of a 3D grid. Cells are wider than the largest box's diagonal, so nothing starts overlapping.
+            const double cell = 3.2;
+            const uint32_t side = std::max(1u, (uint32_t)std::ceil(std::cbrt((double)count)));
+            for (uint32_t i = 0; i < count; ++i) {
+                Eigen::Vector3d position{(i % side) * cell, 2.0 + (i / side / side) * cell, (i / side % side) * cell};
+                position += Eigen::Vector3d{random.uniform(-0.2, 0.2), random.uniform(-0.2, 0.2), random.uniform(-0.2, 0.2)};
+                SceneBody box = makeBox({random.uniform(0.5, 1.5), random.uniform(0.5, 1.5), random.uniform(0.5, 1.5)}, position);
+                box.description.rotation = random.rotation();
+                box.description.mass = box.scale.prod();
+                scene.bodies.push_back(box);
+            }
+        }
+
+        void generateDominoes(SceneDescription& scene, uint32_t count, SceneRandom& random) {
+            const uint32_t row_length = 100;
+            const Eigen::Vector3d size{0.2, 1.0, 0.5};
+            for (uint32_t i = 0; i < count; ++i) {
+                const uint32_t row = i / row_length, place = i % row_length;
+                SceneBody domino = makeBox(size, {place * 0.6, 0.5, row * 1.5 + random.uniform(-0.01, 0.01)});
+                domino.description.mass = 0.2;
+                if(place == 0){
+                    //Push the first domino into the next one
+                    domino.description.angular_velocity = {0, 0, -3.0};
+                }
+                scene.bodies.push_back(domino);
+            }
+        }
+
+        void generateTorusChains(SceneDescription& scene, uint32_t count, SceneRandom& random) {
+            const double major_radius = 0.4, minor_radius = 0.1;
+            const uint32_t chain_length = 20;
+            //Links alternate between lying flat and standing up, each passing through the hole of the one before
+            const Eigen::Quaterniond standing(Eigen::AngleAxisd(M_PI / 2.0, Eigen::Vector3d::UnitX()));
+            const uint32_t chain_count = (count + chain_length - 1) / chain_length;
+            const uint32_t side = gridSide(chain_count);
+            for (uint32_t i = 0; i < count; ++i) {
+                const uint32_t chain = i / chain_length, link = i % chain_length;
+                SceneBody torus{};
+                torus.shape = SceneShape::TORUS;
+                torus.scale = {major_radius, minor_radius, 0};
+                torus.description.position = {(chain % side) * (chain_length * major_radius + 2.0) + link * major_radius, 10.0, (chain / side) * 2.0};
+                torus.description.rotation = (link % 2 == 0) ? Eigen::Quaterniond::Identity() : standing;
+                torus.description.velocity = {0, 0, random.uniform(-0.1, 0.1)};
+                if(link == 0) torus = makeStatic(torus);
+                scene.bodies.push_back(torus);
+            }
+        }
+
+        void generateProjectiles(SceneDescription& scene, uint32_t count, SceneRandom& random) {
+            //Each range is one thin wall with up to 9 projectiles fired at it
+            const uint32_t range_size = 10;
+            const uint32_t side = gridSide((count + range_size - 1) / range_size);
+            for (uint32_t i = 0; i < count; ++i) {
+                const uint32_t range = i / range_size, shot = i % range_size;
+                const Eigen::Vector3d range_center{(range % side) * 10.0, 3.0, (range / side) * 6.0};
+                if(shot == 0){
+                    scene.bodies.push_back(makeStatic(makeBox({0.05, 4, 4}, range_center)));
+                    continue;
+                }
+                //Spread along the firing line, so projectiles start apart
+                Eigen::Vector3d position = range_center + Eigen::Vector3d{-1.0 - shot * 0.4, random.uniform(-1.5, 1.5), random.uniform(-1.5, 1.5)};
+                SceneBody projectile = makeBox({0.2, 0.2, 0.2}, position);
+                projectile.description.velocity = {random.uniform(100, 300), 0, 0};
+                projectile.description.angular_velocity = {random.uniform(-10, 10), random.uniform(-10, 10), random.uniform(-10, 10)};
+                projectile.description.mass = 0.1;
+                scene.bodies.push_back(projectile);
+            }
+        }
+
+    }
+
+    const char* getStressSceneName(StressScene type) {
+        switch (type) {
+            case StressScene::BOX_STACKS: return "stacks";
+            case StressScene::RANDOM_PILE: return "pile";
+            case StressScene::DOMINOES: return "dominoes";
+            case StressScene::TORUS_CHAINS: return "chains";
+            case StressScene::PROJECTILES: return "projectiles";
+            default: return "unknown";
+        }
+    }
+
+    StressScene parseStressSceneName(const std::string& name) {
+        for (StressScene type : {StressScene::BOX_STACKS, StressScene::RANDOM_PILE, StressScene::DOMINOES, StressScene::TORUS_CHAINS, StressScene::PROJECTILES}) {
+            if(name == getStressSceneName(type)) return type;
+        }
+        throw RuntimeException("Unknown stress scene : " + name + " (expected stacks, pile, dominoes, chains or projectiles)");
+    }
+
+    SceneDescription generateStressScene(StressScene type, uint32_t body_count, uint32_t seed) {
+        if(body_count < 2) throw RuntimeException("Stress scenes need at least 2 bodies.");
+        SceneDescription scene{};
+        scene.bodies.reserve(body_count);
+        SceneRandom random(seed);
+        switch (type) {
+            case StressScene::BOX_STACKS:
+                generateBoxStacks(scene, body_count - 1, random);
+                addFloor(scene);
+                break;
+            case StressScene::RANDOM_PILE:
+                generateRandomPile(scene, body_count - 1, random);
+                addFloor(scene);
+                break;
+            case StressScene::DOMINOES:
+                generateDominoes(scene, body_count - 1, random);
+                addFloor(scene);
+                break;
+            case StressScene::TORUS_CHAINS:
+                generateTorusChains(scene, body_count, random);
+                break;
+            case StressScene::PROJECTILES:
+                //Fast bodies would cross a whole range in one step at the default step length
+                scene.delta_time = 0.005;
+                generateProjectiles(scene, body_count, random);
+                break;
+        }
+        return scene;
+    }
+
+} // EngiGraph
@@ -0,0 +1,61 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <string>
+#include "SceneDescription.h"
+
+namespace EngiGraph {
+
+    /**
+     * Kinds of generated stress scenes.
+     */
+    enum class StressScene {
+        /**
+         * Towers of 10 boxes on a floor.
+         */
+        BOX_STACKS,
+        /**
+         * Boxes of random size and rotation dropped onto a floor.
+         */
+        RANDOM_PILE,
+        /**
+         * Rows of dominoes on a floor, the first of each row tipping over.
+         */
+        DOMINOES,
+        /**
+         * Chains of interlocked tori hanging from a static link.
+         */
+        TORUS_CHAINS,
+        /**
+         * Small fast boxes shot at thin static walls, to stress CCD.
+         */
+        PROJECTILES
+    };
+
+    /**
+     * Get the name of a stress scene, as used on the command line.
+     */
+    const char* getStressSceneName(StressScene type);
+
+    /**
+     * Find a stress scene by name.
+     * @throws RuntimeException Unknown name.
+     */
+    StressScene parseStressSceneName(const std::string& name);
+
+    /**
+     * Generate a stress scene.
+     * @details The same type, body count and seed always give the same scene, on every platform.
+     * Bodies are placed apart from each other, so the scene starts without overlaps.
+     * @param type Kind of scene.
+     * @param body_count Total number of bodies, including static ones. At least 2.
+     * @param seed Seed for random placement.
+     * @throws RuntimeException Body count too small.
+     * @return Scene with zero mass static geometry, loadable by both solvers.
+     */
+    SceneDescription generateStressScene(StressScene type, uint32_t body_count, uint32_t seed = 1);
+
+} // EngiGraph
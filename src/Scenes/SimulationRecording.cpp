@@ -0,0 +1,542 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#include "SimulationRecording.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include "src/Exceptions/RuntimeException.h"
+#include "src/FileIO/FileUtils.h"
+
+namespace EngiGraph {
+
+    namespace {
+
+        constexpr char RECORDING_MAGIC[8] = {'E','G','R','E','C','0','0','6'};
+
+        /**
+         * Appends raw values to a buffer.
+         */
+        class BinaryWriter {
+        public:
+            std::vector<char> data{};
+
+            template<typename T> void write(const T& value) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                const char* bytes = reinterpret_cast<const char*>(&value);
+                data.insert(data.end(), bytes, bytes + sizeof(T));
+            }
+
+            template<typename T> void writeArray(const std::vector<T>& values) {
+                write((uint64_t)values.size());
+                writeValues(values);
+            }
+
+            /**
+             * Write values without their count, when the reader already knows it.
+             */
+            template<typename T> void writeValues(const std::vector<T>& values) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                const char* bytes = reinterpret_cast<const char*>(values.data());
+                data.insert(data.end(), bytes, bytes + values.size() * sizeof(T));
+            }
+        };
+
+        /**
+         * Reads raw values from a buffer, checking that the buffer is long enough.
+         */
+        class BinaryReader {
+        public:
+            explicit BinaryReader(const std::vector<char>& data) : data(data) {}
+
+            template<typename T> T read() {
+                static_assert(std::is_trivially_copyable_v<T>);
+                T value;
+                std::memcpy(&value, take(sizeof(T)), sizeof(T));
+                return value;
+            }
+
+            template<typename T> std::vector<T> readArray() {
+                return readValues<T>(read<uint64_t>());
+            }
+
+            template<typename T> std::vector<T> readValues(uint64_t count) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                if(count > (data.size() - offset) / sizeof(T)) throwCutShort();
+                std::vector<T> values(count);
+                std::memcpy(values.data(), take(count * sizeof(T)), count * sizeof(T));
+                return values;
+            }
+
+        private:
+            const std::vector<char>& data;
+            size_t offset = 0;
+
+            const char* take(size_t size) {
+                if(size > data.size() - offset) throwCutShort();
+                const char* bytes = data.data() + offset;
+                offset += size;
+                return bytes;
+            }
+
+            [[noreturn]] static void throwCutShort() {
+                throw RuntimeException("Recording file is cut short.");
+            }
+        };
+
+        /**
+         * Id of no compound collider.
+         */
+        constexpr uint32_t NO_COMPOUND = 0xFFFFFFFF;
+
+        /**
+         * Id of no height field.
+         */
+        constexpr uint32_t NO_HEIGHT_FIELD = 0xFFFFFFFF;
+
+        /**
+         * Id of no signed distance field.
+         */
+        constexpr uint32_t NO_SIGNED_DISTANCE_FIELD = 0xFFFFFFFF;
+
+        /**
+         * Ids of every collider in a recording, in order of first use.
+         * @details Compound colliders are stored as their children. Bodies with a compound collider store the compound id instead of a mesh id,
+         * and bodies with a height field store its id. Every body then stores the id of its signed distance field.
+         */
+        struct ColliderTable {
+            std::map<const Mesh*, uint32_t> ids{};
+            std::vector<std::shared_ptr<const Mesh>> meshes{};
+            std::map<const CompoundCollider*, uint32_t> compound_ids{};
+            std::vector<std::shared_ptr<const CompoundCollider>> compounds{};
+            std::map<const HeightField*, uint32_t> height_field_ids{};
+            std::vector<std::shared_ptr<const HeightField>> height_fields{};
+            std::map<const SignedDistanceField*, uint32_t> signed_distance_field_ids{};
+            std::vector<std::shared_ptr<const SignedDistanceField>> signed_distance_fields{};
+
+            void add(const std::shared_ptr<const Mesh>& mesh) {
+                if(ids.emplace(mesh.get(), (uint32_t)meshes.size()).second) meshes.push_back(mesh);
+            }
+
+            /**
+             * Add the collider of a body.
+             */
+            void addBody(const std::shared_ptr<const Mesh>& mesh, const std::shared_ptr<const CompoundCollider>& compound,
+                         const std::shared_ptr<const HeightField>& height_field, const std::shared_ptr<const SignedDistanceField>& signed_distance_field) {
+                if(signed_distance_field && signed_distance_field_ids.emplace(signed_distance_field.get(), (uint32_t)signed_distance_fields.size()).second){
+                    signed_distance_fields.push_back(signed_distance_field);
+                }
+                if(height_field){
+                    if(height_field_ids.emplace(height_field.get(), (uint32_t)height_fields.size()).second) height_fields.push_back(height_field);
+                }else if(!compound){
+                    add(mesh);
+                }else if(compound_ids.emplace(compound.get(), (uint32_t)compounds.size()).second){
+                    compounds.push_back(compound);
+                    for (const auto& child : compound->getChildren()) add(child.mesh);
+                }
+            }
+
+            void addWorld(const PhysicsWorld& world) {
+                for (uint32_t index = 0; index < world.getBodyCount(); ++index) addBody(world.colliders[index], world.compound_colliders[index], world.height_fields[index], world.signed_distance_fields[index]);
+            }
+        };
+
+        /**
+         * Colliders read back from a recording, by id.
+         */
+        struct LoadedColliders {
+            std::vector<std::shared_ptr<const Mesh>> meshes{};
+            std::vector<std::shared_ptr<const CompoundCollider>> compounds{};
+            std::vector<std::shared_ptr<const HeightField>> height_fields{};
+            std::vector<std::shared_ptr<const SignedDistanceField>> signed_distance_fields{};
+        };
+
+        void writeSettings(BinaryWriter& writer, const RecordedSettings& settings) {
+            writer.write(settings.gravity.x()); writer.write(settings.gravity.y()); writer.write(settings.gravity.z());
+            writer.write((uint8_t)settings.sleep_settings.enabled);
+            writer.write(settings.sleep_settings.linear_velocity_threshold);
+            writer.write(settings.sleep_settings.angular_velocity_threshold);
+            writer.write(settings.sleep_settings.time_until_sleep);
+            writer.write(settings.contact_settings.max_iterations);
+            writer.write(settings.contact_settings.residual_tolerance);
+            writer.write(settings.contact_settings.relaxation);
+            writer.write(settings.contact_settings.friction);
+            writer.write((uint8_t)settings.contact_settings.warm_starting);
+            writer.write((uint8_t)settings.contact_settings.parallel);
+        }
+
+        RecordedSettings readSettings(BinaryReader& reader) {
+            RecordedSettings settings{};
+            settings.gravity.x() = reader.read<double>(); settings.gravity.y() = reader.read<double>(); settings.gravity.z() = reader.read<double>();
+            settings.sleep_settings.enabled = reader.read<uint8_t>() != 0;
+            settings.sleep_settings.linear_velocity_threshold = reader.read<double>();
+            settings.sleep_settings.angular_velocity_threshold = reader.read<double>();
+            settings.sleep_settings.time_until_sleep = reader.read<double>();
+            settings.contact_settings.max_iterations = reader.read<uint32_t>();
+            settings.contact_settings.residual_tolerance = reader.read<double>();
+            settings.contact_settings.relaxation = reader.read<double>();
+            settings.contact_settings.friction = reader.read<double>();
+            settings.contact_settings.warm_starting = reader.read<uint8_t>() != 0;
+            settings.contact_settings.parallel = reader.read<uint8_t>() != 0;
+            return settings;
+        }
+
+        void writeStates(BinaryWriter& writer, const BodyStates& states) {
+            writer.write(states.size());
+            states.forEachArray([&](const auto& array){ writer.writeValues(array); });
+        }
+
+        BodyStates readStates(BinaryReader& reader) {
+            BodyStates states{};
+            const uint32_t count = reader.read<uint32_t>();
+            states.forEachArray([&](auto& array){
+                array = reader.readValues<typename std::decay_t<decltype(array)>::value_type>(count);
+            });
+            return states;
+        }
+
+        std::shared_ptr<const Mesh> readCollider(BinaryReader& reader, const std::vector<std::shared_ptr<const Mesh>>& colliders) {
+            const uint32_t id = reader.read<uint32_t>();
+            if(id >= colliders.size()) throw RuntimeException("Recording references a missing collider.");
+            return colliders[id];
+        }
+
+        void writeBodyCollider(BinaryWriter& writer, const ColliderTable& colliders, const std::shared_ptr<const Mesh>& mesh,
+                               const std::shared_ptr<const CompoundCollider>& compound, const std::shared_ptr<const HeightField>& height_field,
+                               const std::shared_ptr<const SignedDistanceField>& signed_distance_field) {
+            writer.write(compound ? colliders.compound_ids.at(compound.get()) : NO_COMPOUND);
+            if(!compound){
+                writer.write(height_field ? colliders.height_field_ids.at(height_field.get()) : NO_HEIGHT_FIELD);
+                if(!height_field) writer.write(colliders.ids.at(mesh.get()));
+            }
+            writer.write(signed_distance_field ? colliders.signed_distance_field_ids.at(signed_distance_field.get()) : NO_SIGNED_DISTANCE_FIELD);
+        }
+
+        /**
+         * Read the collider of a body into its description.
+         */
+        BodyDescription readBodyCollider(BinaryReader& reader, const LoadedColliders& colliders) {
+            BodyDescription description{};
+            const uint32_t compound = reader.read<uint32_t>();
+            if(compound == NO_COMPOUND){
+                const uint32_t height_field = reader.read<uint32_t>();
+                if(height_field == NO_HEIGHT_FIELD){
+                    description.collider = readCollider(reader, colliders.meshes);
+                }else{
+                    if(height_field >= colliders.height_fields.size()) throw RuntimeException("Recording references a missing collider.");
+                    description.height_field = colliders.height_fields[height_field];
+                    //The recorded state replaces the body type right after
+                    description.type = BodyType::STATIC;
+                }
+            }else{
+                if(compound >= colliders.compounds.size()) throw RuntimeException("Recording references a missing collider.");
+                description.compound = colliders.compounds[compound];
+            }
+            const uint32_t signed_distance_field = reader.read<uint32_t>();
+            if(signed_distance_field != NO_SIGNED_DISTANCE_FIELD){
+                if(signed_distance_field >= colliders.signed_distance_fields.size()) throw RuntimeException("Recording references a missing collider.");
+                description.signed_distance_field = colliders.signed_distance_fields[signed_distance_field];
+                description.type = BodyType::STATIC;
+            }
+            return description;
+        }
+
+        void writeWorld(BinaryWriter& writer, const PhysicsWorld& world, const ColliderTable& colliders) {
+            writeStates(writer, world.states);
+            for (uint32_t index = 0; index < world.getBodyCount(); ++index) {
+                writeBodyCollider(writer, colliders, world.colliders[index], world.compound_colliders[index], world.height_fields[index], world.signed_distance_fields[index]);
+            }
+            const HandleTable handles = world.getHandleTable();
+            writer.writeArray(handles.slot_to_index);
+            writer.writeArray(handles.slot_generations);
+            writer.writeArray(handles.index_to_slot);
+            writer.writeArray(handles.free_slots);
+            writer.writeArray(world.getPairExclusions().getSortedKeys());
+        }
+
+        PhysicsWorld readWorld(BinaryReader& reader, const LoadedColliders& colliders) {
+            BodyStates states = readStates(reader);
+            //Create the bodies through the world so every table has the right size, then put the exact state back
+            PhysicsWorld world;
+            world.reserve(states.size());
+            for (uint32_t index = 0; index < states.size(); ++index) {
+                world.createBody(readBodyCollider(reader, colliders));
+            }
+            world.states = std::move(states);
+            HandleTable handles{};
+            handles.slot_to_index = reader.readArray<uint32_t>();
+            handles.slot_generations = reader.readArray<uint32_t>();
+            handles.index_to_slot = reader.readArray<uint32_t>();
+            handles.free_slots = reader.readArray<uint32_t>();
+            world.setHandleTable(std::move(handles));
+            PairExclusions exclusions{};
+            exclusions.setKeys(reader.readArray<uint64_t>());
+            world.setPairExclusions(std::move(exclusions));
+            world.updateCurrentTransforms();
+            world.future_transforms = world.current_transforms;
+            return world;
+        }
+
+        BodyStates copySingleBody(const BodyStates& states, uint32_t index) {
+            BodyStates body{};
+            body.pushBack();
+            body.copyBody(0, states, index);
+            return body;
+        }
+
+    }
+
+    void saveRecording(const SimulationRecording& recording, const std::string& filename) {
+        ColliderTable colliders{};
+        colliders.addWorld(recording.initial_world);
+        for (const auto& edit : recording.edits) {
+            if(edit.type == RecordedEditType::BODY_ADDED) colliders.addBody(edit.collider, edit.compound, edit.height_field, edit.signed_distance_field);
+            if(edit.type == RecordedEditType::WORLD_RESET) colliders.addWorld(*edit.world);
+        }
+
+        BinaryWriter writer{};
+        for (char c : RECORDING_MAGIC) writer.write(c);
+        writer.write((uint8_t)recording.solver);
+        writer.write((uint32_t)colliders.meshes.size());
+        for (const auto& mesh : colliders.meshes) {
+            //Eigen vectors are not trivially copyable, so vertices go through a flat array
+            std::vector<float> vertices;
+            vertices.reserve(mesh->vertices.size() * 3);
+            for (const auto& vertex : mesh->vertices) vertices.insert(vertices.end(), {vertex.x(), vertex.y(), vertex.z()});
+            writer.writeArray(vertices);
+            writer.writeArray(mesh->triangle_indices);
+            writer.writeArray(mesh->edge_indices);
+        }
+        writer.write((uint32_t)colliders.compounds.size());
+        for (const auto& compound : colliders.compounds) {
+            writer.write((uint32_t)compound->getChildCount());
+            for (const auto& child : compound->getChildren()) {
+                writer.write(colliders.ids.at(child.mesh.get()));
+                for (int i = 0; i < 16; ++i) writer.write(child.local_transform(i));
+            }
+        }
+        writer.write((uint32_t)colliders.height_fields.size());
+        for (const auto& height_field : colliders.height_fields) {
+            writer.write(height_field->getColumns());
+            writer.write(height_field->getRows());
+            writer.write(height_field->getSpacing().x());
+            writer.write(height_field->getSpacing().y());
+            writer.writeArray(height_field->getHeights());
+        }
+        writer.write((uint32_t)colliders.signed_distance_fields.size());
+        for (const auto& field : colliders.signed_distance_fields) {
+            for (int axis = 0; axis < 3; ++axis) writer.write(field->getOrigin()[axis]);
+            writer.write(field->getCellSize());
+            writer.write(field->getBand());
+            for (int axis = 0; axis < 3; ++axis) writer.write((int32_t)field->getBrickCounts()[axis]);
+            writer.writeArray(field->getBricks());
+            writer.writeArray(field->getSamples());
+        }
+        writeSettings(writer, recording.initial_settings);
+        writeWorld(writer, recording.initial_world, colliders);
+
+        writer.write((uint64_t)recording.edits.size());
+        for (const auto& edit : recording.edits) {
+            writer.write((uint8_t)edit.type);
+            writer.write(edit.step);
+            writer.write(edit.index);
+            switch (edit.type) {
+                case RecordedEditType::BODY_ADDED:
+                    writeBodyCollider(writer, colliders, edit.collider, edit.compound, edit.height_field, edit.signed_distance_field);
+                    writeStates(writer, edit.body);
+                    break;
+                case RecordedEditType::BODY_CHANGED:
+                    writeStates(writer, edit.body);
+                    break;
+                case RecordedEditType::BODY_REMOVED:
+                    break;
+                case RecordedEditType::WORLD_RESET:
+                    writeWorld(writer, *edit.world, colliders);
+                    break;
+                case RecordedEditType::SETTINGS:
+                    writeSettings(writer, edit.settings);
+                    break;
+            }
+        }
+        writer.writeArray(recording.steps);
+
+        std::ofstream file(filename, std::ios::binary);
+        file.write(writer.data.data(), (std::streamsize)writer.data.size());
+        if(!file) throw RuntimeException("Could not write recording file: " + filename);
+    }
+
+    SimulationRecording loadRecording(const std::string& filename) {
+        validateFileExistence(filename);
+        std::ifstream file(filename, std::ios::binary);
+        const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        BinaryReader reader(data);
+        for (char c : RECORDING_MAGIC) {
+            if(reader.read<char>() != c) throw RuntimeException("Not a recording file, or from a different version: " + filename);
+        }
+
+        SimulationRecording recording{};
+        const uint8_t solver = reader.read<uint8_t>();
+        if(solver > (uint8_t)SceneSolver::TOI_SPECULATIVE) throw RuntimeException("Recording has an unknown solver.");
+        recording.solver = (SceneSolver)solver;
+        LoadedColliders colliders{};
+        colliders.meshes.resize(reader.read<uint32_t>());
+        for (auto& collider : colliders.meshes) {
+            auto mesh = std::make_shared<Mesh>();
+            const std::vector<float> vertices = reader.readArray<float>();
+            if(vertices.size() % 3 != 0) throw RuntimeException("Recording has a broken collider.");
+            for (size_t i = 0; i < vertices.size(); i += 3) mesh->vertices.emplace_back(vertices[i], vertices[i + 1], vertices[i + 2]);
+            mesh->triangle_indices = reader.readArray<uint32_t>();
+            mesh->edge_indices = reader.readArray<uint32_t>();
+            collider = mesh;
+        }
+        colliders.compounds.resize(reader.read<uint32_t>());
+        for (auto& compound : colliders.compounds) {
+            std::vector<CompoundChild> children(reader.read<uint32_t>());
+            for (auto& child : children) {
+                child.mesh = readCollider(reader, colliders.meshes);
+                for (int i = 0; i < 16; ++i) child.local_transform(i) = reader.read<double>();
+            }
+            compound = std::make_shared<const CompoundCollider>(std::move(children));
+        }
+        colliders.height_fields.resize(reader.read<uint32_t>());
+        for (auto& height_field : colliders.height_fields) {
+            const uint32_t columns = reader.read<uint32_t>();
+            const uint32_t rows = reader.read<uint32_t>();
+            Eigen::Vector2d spacing;
+            spacing.x() = reader.read<double>();
+            spacing.y() = reader.read<double>();
+            height_field = std::make_shared<const HeightField>(columns, rows, reader.readArray<float>(), spacing);
+        }
+        colliders.signed_distance_fields.resize(reader.read<uint32_t>());
+        for (auto& field : colliders.signed_distance_fields) {
+            Eigen::Vector3d origin;
+            for (int axis = 0; axis < 3; ++axis) origin[axis] = reader.read<double>();
+            const double cell_size = reader.read<double>();
+            const double band = reader.read<double>();
+            Eigen::Vector3i brick_counts;
+            for (int axis = 0; axis < 3; ++axis) brick_counts[axis] = reader.read<int32_t>();
+            std::vector<int32_t> bricks = reader.readArray<int32_t>();
+            field = std::make_shared<const SignedDistanceField>(origin, cell_size, band, brick_counts, std::move(bricks), reader.readArray<float>());
+        }
+        recording.initial_settings = readSettings(reader);
+        recording.initial_world = readWorld(reader, colliders);
+
+        recording.edits.resize(reader.read<uint64_t>());
+        for (auto& edit : recording.edits) {
+            const uint8_t type = reader.read<uint8_t>();
+            if(type > (uint8_t)RecordedEditType::SETTINGS) throw RuntimeException("Recording has an unknown edit.");
+            edit.type = (RecordedEditType)type;
+            edit.step = reader.read<uint64_t>();
+            edit.index = reader.read<uint32_t>();
+            switch (edit.type) {
+                case RecordedEditType::BODY_ADDED: {
+                    const BodyDescription description = readBodyCollider(reader, colliders);
+                    edit.collider = description.collider;
+                    edit.compound = description.compound;
+                    edit.height_field = description.height_field;
+                    edit.signed_distance_field = description.signed_distance_field;
+                    edit.body = readStates(reader);
+                    break;
+                }
+                case RecordedEditType::BODY_CHANGED:
+                    edit.body = readStates(reader);
+                    break;
+                case RecordedEditType::BODY_REMOVED:
+                    break;
+                case RecordedEditType::WORLD_RESET:
+                    edit.world = std::make_shared<PhysicsWorld>(readWorld(reader, colliders));
+                    break;
+                case RecordedEditType::SETTINGS:
+                    edit.settings = readSettings(reader);
+                    break;
+            }
+        }
+        recording.steps = reader.readArray<RecordedStep>();
+        return recording;
+    }
+
+    void applyRecordedEdit(const RecordedEdit& edit, PhysicsWorld& world) {
+        switch (edit.type) {
+            case RecordedEditType::BODY_ADDED: {
+                BodyDescription description{edit.collider};
+                description.compound = edit.compound;
+                description.height_field = edit.height_field;
+                description.signed_distance_field = edit.signed_distance_field;
+                if(edit.height_field || edit.signed_distance_field) description.type = BodyType::STATIC;
+                world.createBody(description);
+                world.states.copyBody(world.getBodyCount() - 1, edit.body, 0);
+                break;
+            }
+            case RecordedEditType::BODY_CHANGED:
+                if(edit.index >= world.getBodyCount()) throw RuntimeException("Recorded edit of a body that does not exist.");
+                world.states.copyBody(edit.index, edit.body, 0);
+                break;
+            case RecordedEditType::BODY_REMOVED:
+                if(edit.index >= world.getBodyCount()) throw RuntimeException("Recorded edit of a body that does not exist.");
+                world.destroyBody(world.getHandle(edit.index));
+                break;
+            case RecordedEditType::WORLD_RESET:
+                world = *edit.world;
+                break;
+            case RecordedEditType::SETTINGS:
+                break;
+        }
+    }
+
+    void SimulationRecorder::recordBodyChanged(const PhysicsWorld& world, uint32_t index) {
+        if(!recording_active) return;
+        addEdit(RecordedEditType::BODY_CHANGED, index).body = copySingleBody(world.states, index);
+    }
+
+    void SimulationRecorder::recordBodyAdded(const PhysicsWorld& world, BodyHandle handle) {
+        if(!recording_active) return;
+        const uint32_t index = world.getIndex(handle);
+        RecordedEdit& edit = addEdit(RecordedEditType::BODY_ADDED, index);
+        edit.body = copySingleBody(world.states, index);
+        edit.collider = world.colliders[index];
+        edit.compound = world.compound_colliders[index];
+        edit.height_field = world.height_fields[index];
+        edit.signed_distance_field = world.signed_distance_fields[index];
+    }
+
+    void SimulationRecorder::recordBodyRemoved(const PhysicsWorld& world, BodyHandle handle) {
+        if(!recording_active) return;
+        addEdit(RecordedEditType::BODY_REMOVED, world.getIndex(handle));
+    }
+
+    void SimulationRecorder::recordWorldReset(const PhysicsWorld& world) {
+        if(!recording_active) return;
+        addEdit(RecordedEditType::WORLD_RESET, 0).world = std::make_shared<PhysicsWorld>(world);
+    }
+
+    bool SimulationRecorder::isSameSettings(const RecordedSettings& a, const RecordedSettings& b) {
+        const auto& sleep_a = a.sleep_settings;
+        const auto& sleep_b = b.sleep_settings;
+        const auto& contact_a = a.contact_settings;
+        const auto& contact_b = b.contact_settings;
+        return a.gravity == b.gravity && sleep_a.enabled == sleep_b.enabled && sleep_a.linear_velocity_threshold == sleep_b.linear_velocity_threshold &&
+               sleep_a.angular_velocity_threshold == sleep_b.angular_velocity_threshold && sleep_a.time_until_sleep == sleep_b.time_until_sleep &&
+               contact_a.max_iterations == contact_b.max_iterations && contact_a.residual_tolerance == contact_b.residual_tolerance &&
+               contact_a.relaxation == contact_b.relaxation && contact_a.friction == contact_b.friction &&
+               contact_a.warm_starting == contact_b.warm_starting && contact_a.parallel == contact_b.parallel;
+    }
+
+    RecordedEdit& SimulationRecorder::addEdit(RecordedEditType type, uint32_t index) {
+        RecordedEdit& edit = recording.edits.emplace_back();
+        edit.type = type;
+        edit.step = recording.steps.size();
+        edit.index = index;
+        return edit;
+    }
+
+    void SimulationReplay::throwWrongSolver() {
+        throw RuntimeException("Replay solver does not match the recorded solver.");
+    }
+
+    void SimulationReplay::throwFinished() {
+        throw RuntimeException("Replay already reached the end of the recording.");
+    }
+
+} // EngiGraph
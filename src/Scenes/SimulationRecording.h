@@ -0,0 +1,357 @@
+//
+// Created by Philip on 10/19/2026.
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "SceneDescription.h"
+#include "src/Physics/TOISolver/ToiSolver.h"
+#include "src/Physics/VBD/VbdSolver.h"
+
+namespace EngiGraph {
+
+    /**
+     * Solver settings that change how a step turns out.
+     */
+    struct RecordedSettings {
+        Eigen::Vector3d gravity = {0,0,0};
+        SleepSettings sleep_settings{};
+        ContactSolverSettings contact_settings{};
+    };
+
+    /**
+     * Kinds of changes made to a simulation between steps.
+     */
+    enum class RecordedEditType : uint8_t {
+        /**
+         * State of one body was overwritten.
+         */
+        BODY_CHANGED,
+        /**
+         * A body was created at the end of the world.
+         */
+        BODY_ADDED,
+        /**
+         * A body was destroyed.
+         */
+        BODY_REMOVED,
+        /**
+         * The whole world was replaced.
+         */
+        WORLD_RESET,
+        /**
+         * Solver settings changed.
+         */
+        SETTINGS
+    };
+
+    /**
+     * A change made to a simulation between steps.
+     */
+    struct RecordedEdit {
+        RecordedEditType type = RecordedEditType::BODY_CHANGED;
+        /**
+         * The edit happened right before this step, counted from the start of the recording.
+         */
+        uint64_t step = 0;
+        /**
+         * Dense index of the body, for body edits.
+         */
+        uint32_t index = 0;
+        /**
+         * Full state of the body after the edit, a single body, for BODY_CHANGED and BODY_ADDED.
+         */
+        BodyStates body{};
+        /**
+         * Collider of an added body.
+         */
+        std::shared_ptr<const Mesh> collider{};
+        /**
+         * Compound collider of an added body, if it has one.
+         */
+        std::shared_ptr<const CompoundCollider> compound{};
+        /**
+         * Height field of an added body, if it has one.
+         */
+        std::shared_ptr<const HeightField> height_field{};
+        /**
+         * Signed distance field of an added body, if it has one.
+         */
+        std::shared_ptr<const SignedDistanceField> signed_distance_field{};
+        /**
+         * New world, for WORLD_RESET.
+         */
+        std::shared_ptr<const PhysicsWorld> world{};
+        /**
+         * New settings, for SETTINGS.
+         */
+        RecordedSettings settings{};
+    };
+
+    /**
+     * A recorded step.
+     */
+    struct RecordedStep {
+        double delta_time = 0.0;
+        /**
+         * PhysicsWorld::hashState() after the step.
+         */
+        uint64_t state_hash = 0;
+    };
+
+    /**
+     * Everything needed to re-run a simulation bit for bit: the starting state, and every edit and step after it.
+     */
+    struct SimulationRecording {
+        SceneSolver solver = SceneSolver::VBD;
+        /**
+         * World when recording started, with its handles.
+         */
+        PhysicsWorld initial_world{};
+        RecordedSettings initial_settings{};
+        /**
+         * Edits in the order they happened.
+         */
+        std::vector<RecordedEdit> edits{};
+        std::vector<RecordedStep> steps{};
+    };
+
+    /**
+     * Write a recording to a compact binary file.
+     * @details Colliders shared between bodies are stored once. Values are stored as their raw bits in native byte order, so nothing is lost.
+     * @param recording Recording to write.
+     * @param filename .egrec file to write.
+     * @throws RuntimeException File could not be written.
+     */
+    void saveRecording(const SimulationRecording& recording, const std::string& filename);
+
+    /**
+     * Read a recording written by saveRecording().
+     * @param filename .egrec file.
+     * @throws RuntimeException File is missing, not a recording, or cut short.
+     * @return Recording.
+     */
+    SimulationRecording loadRecording(const std::string& filename);
+
+    /**
+     * Get the scene solver a solver runs as.
+     */
+    inline SceneSolver getSceneSolver(const VBDSolver&) {
+        return SceneSolver::VBD;
+    }
+    inline SceneSolver getSceneSolver(const TOISolver& solver) {
+        return solver.integration_mode == TOISolver::IntegrationMode::SPECULATIVE ? SceneSolver::TOI_SPECULATIVE : SceneSolver::TOI;
+    }
+
+    /**
+     * Get the settings of a solver that a recording tracks.
+     */
+    template<typename Solver> RecordedSettings getRecordedSettings(const Solver& solver) {
+        return {solver.gravity, solver.sleep_settings, solver.contact_solver.settings};
+    }
+
+    /**
+     * Set the settings of a solver that a recording tracks.
+     */
+    template<typename Solver> void applyRecordedSettings(const RecordedSettings& settings, Solver& solver) {
+        solver.gravity = settings.gravity;
+        solver.sleep_settings = settings.sleep_settings;
+        solver.contact_solver.settings = settings.contact_settings;
+    }
+
+    /**
+     * Forget what a solver kept from earlier steps, so it continues like a fresh solver would.
+     */
+    inline void resetSolverCaches(VBDSolver& solver) {
+        solver.manifolds.clear();
+    }
+    inline void resetSolverCaches(TOISolver& solver) {
+        solver.manifolds.clear();
+    }
+
+    /**
+     * Apply an edit to a world.
+     * @param edit Body or world edit.
+     * @param world World to change.
+     */
+    void applyRecordedEdit(const RecordedEdit& edit, PhysicsWorld& world);
+
+    /**
+     * Records a running simulation.
+     * @details Steps must go through step(), and every edit of the world between steps must be reported, otherwise a replay drifts
+     * apart from the original. Solver settings are compared every step, so they do not need to be reported.
+     * Changes to excluded pairs are reported with recordWorldReset().
+     */
+    class SimulationRecorder {
+    public:
+        /**
+         * Start a new recording from the current state of a solver.
+         * @details Clears caches the solver keeps between steps, like contact manifolds, since they are not recorded.
+         */
+        template<typename Solver> void start(Solver& solver) {
+            resetSolverCaches(solver);
+            recording = SimulationRecording{};
+            recording.solver = getSceneSolver(solver);
+            recording.initial_world = solver.world;
+            recording.initial_settings = getRecordedSettings(solver);
+            last_settings = recording.initial_settings;
+            recording_active = true;
+        }
+
+        /**
+         * Stop recording.
+         * @return The recording, which is also kept until the next start().
+         */
+        const SimulationRecording& stop() {
+            recording_active = false;
+            return recording;
+        }
+
+        [[nodiscard]] bool isRecording() const {
+            return recording_active;
+        }
+
+        /**
+         * Get the recording so far.
+         */
+        [[nodiscard]] const SimulationRecording& getRecording() const {
+            return recording;
+        }
+
+        /**
+         * Step a solver, recording the step if recording.
+         * @param solver Solver that was passed to start().
+         * @param delta_time Length of the step.
+         */
+        template<typename Solver> void step(Solver& solver, double delta_time) {
+            if(!recording_active){
+                solver.step(delta_time);
+                return;
+            }
+            RecordedSettings settings = getRecordedSettings(solver);
+            if(!isSameSettings(settings, last_settings)){
+                addEdit(RecordedEditType::SETTINGS, 0).settings = settings;
+                last_settings = settings;
+            }
+            solver.step(delta_time);
+            recording.steps.push_back({delta_time, solver.world.hashState()});
+        }
+
+        /**
+         * Report that the state of a body was changed.
+         * @param world World after the change.
+         * @param index Dense index of the body.
+         */
+        void recordBodyChanged(const PhysicsWorld& world, uint32_t index);
+
+        /**
+         * Report that a body was created.
+         * @param world World after the body was created.
+         * @param handle New body.
+         */
+        void recordBodyAdded(const PhysicsWorld& world, BodyHandle handle);
+
+        /**
+         * Report that a body is about to be destroyed.
+         * @param world World before the body is destroyed.
+         * @param handle Body to be destroyed.
+         */
+        void recordBodyRemoved(const PhysicsWorld& world, BodyHandle handle);
+
+        /**
+         * Report that the whole world was replaced.
+         * @param world New world.
+         */
+        void recordWorldReset(const PhysicsWorld& world);
+
+    private:
+        SimulationRecording recording{};
+        RecordedSettings last_settings{};
+        bool recording_active = false;
+
+        [[nodiscard]] static bool isSameSettings(const RecordedSettings& a, const RecordedSettings& b);
+
+        /**
+         * Start an edit at the current step.
+         */
+        RecordedEdit& addEdit(RecordedEditType type, uint32_t index);
+    };
+
+    /**
+     * Re-runs a recording.
+     */
+    class SimulationReplay {
+    public:
+        /**
+         * @param recording Recording to replay. Must outlive the replay.
+         */
+        explicit SimulationReplay(const SimulationRecording& recording) : recording(recording) {}
+
+        /**
+         * Reset a solver to the start of the recording.
+         * @param solver Fresh solver of the type the recording was made with.
+         * @throws RuntimeException Solver is not the recorded type.
+         */
+        template<typename Solver> void start(Solver& solver) {
+            if constexpr (std::is_same_v<Solver, TOISolver>){
+                solver.integration_mode = recording.solver == SceneSolver::TOI_SPECULATIVE ? TOISolver::IntegrationMode::SPECULATIVE : TOISolver::IntegrationMode::TIME_OF_IMPACT;
+            }
+            if(getSceneSolver(solver) != recording.solver) throwWrongSolver();
+            resetSolverCaches(solver);
+            solver.world = recording.initial_world;
+            applyRecordedSettings(recording.initial_settings, solver);
+            next_step = 0;
+            next_edit = 0;
+        }
+
+        /**
+         * Apply the edits made before the next step, and do the step.
+         * @throws RuntimeException Recording is finished.
+         */
+        template<typename Solver> void step(Solver& solver) {
+            if(isFinished()) throwFinished();
+            for (; next_edit < recording.edits.size() && recording.edits[next_edit].step == next_step; ++next_edit) {
+                const RecordedEdit& edit = recording.edits[next_edit];
+                if(edit.type == RecordedEditType::SETTINGS){
+                    applyRecordedSettings(edit.settings, solver);
+                }else{
+                    applyRecordedEdit(edit, solver.world);
+                }
+            }
+            solver.step(recording.steps[next_step].delta_time);
+            next_step++;
+        }
+
+        /**
+         * Check that a world matches the recording after the last step.
+         * @return True if the state hash matches, or no step was done yet.
+         */
+        [[nodiscard]] bool verify(const PhysicsWorld& world) const {
+            return next_step == 0 || world.hashState() == recording.steps[next_step - 1].state_hash;
+        }
+
+        [[nodiscard]] bool isFinished() const {
+            return next_step >= recording.steps.size();
+        }
+
+        /**
+         * Get the number of steps done.
+         */
+        [[nodiscard]] uint64_t getStep() const {
+            return next_step;
+        }
+
+    private:
+        const SimulationRecording& recording;
+        uint64_t next_step = 0;
+        size_t next_edit = 0;
+
+        [[noreturn]] static void throwWrongSolver();
+        [[noreturn]] static void throwFinished();
+    };
+
+} // EngiGraph
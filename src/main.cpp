@@ -12,8 +12,17 @@
 #include "src/Physics/Collisions/LinearPointCcd.h"
 #include "src/Physics/TOISolver/ToiSolver.h"
 #include "src/Physics/VBD/VbdSolver.h"
+#include "src/Physics/Threading/PhysicsThread.h"
+#include "src/Physics/World/WorldSnapshot.h"
+#include "src/Profiling/StepProfileHistory.h"
+#include "src/Profiling/Trace.h"
+#include "src/Scenes/SimulationRecording.h"
+#include "src/FileIO/TrajectoryFile.h"
+#include "src/Rendering/OpenGL/BodyRenderTableOgl.h"
 
 #include <GLFW/glfw3.h>
+#include <cfloat>
+#include <cstdio>
 
 /**
  * Callback if error occurs in glfw window.
@@ -56,6 +65,7 @@ int main(int, char**)
     //Error can now be caught and displayed in a user-friendly gui.
     try {
 
+        EngiGraph::setTraceThreadName("Main");
         EngiGraph::initOpenGl((GLADloadproc) glfwGetProcAddress);
 
         EngiGraph::Camera camera{EngiGraph::AngleDegrees<float>(90.0f), 1.0f, 0.001, 1000, {0, -1, 0}};
@@ -71,6 +81,7 @@ int main(int, char**)
         auto mesh_cube_visual = EngiGraph::loadMeshOgl(mesh_cube);
 
         EngiGraph::VBDSolver solver;
+        EngiGraph::BodyRenderTableOgl render_table;
 
         ImVec4 clear_color = ImVec4(0.45f, 0.55f, 0.60f, 1.00f);
         Eigen::Vector3f cam_pos = {5.0f, 5.0f, 5.0f};
@@ -85,17 +96,38 @@ int main(int, char**)
         int last_width = 500;
         int last_height = 500;
 
-        std::vector<EngiGraph::VBDSolver::Box> last_rigidbody_data;
+        //Snapshots share colliders and unchanged arrays, so starting, stopping and rewinding only copy the changing body state
+        EngiGraph::WorldSnapshot start_snapshot;
+        EngiGraph::WorldSnapshotRing rewind_history(256, 4);
+        uint64_t simulation_step = 0;
+        int rewind_steps = 100;
 
         float delta_time = 0.01;
 
         Eigen::Vector3d box_dimensions = {1,1,1};
         double mass = 1.0;
 
-        bool step = false;
-
         solver.step(delta_time);
 
+        //Solver state is owned by the physics thread from here on, change it only through physics.edit
+        //Every step and edit goes through the recorder, so a session can be replayed in EngiGraphSim
+        EngiGraph::SimulationRecorder recorder;
+        char recording_file[256] = "session.egrec";
+        //Poses of every step for offline analysis, written on the physics thread. Only changed through physics.edit
+        std::unique_ptr<EngiGraph::TrajectoryWriter> trajectory_writer;
+        std::unique_ptr<EngiGraph::TrajectoryReader> trajectory_reader;
+        char trajectory_file[256] = "session.egtrj";
+        std::string trajectory_error{};
+        uint64_t trajectory_step = 0;
+        double trajectory_time = 0.0;
+        bool trajectory_playing = false;
+        EngiGraph::PhysicsThread physics([&](double step_delta_time){
+            recorder.step(solver, step_delta_time);
+            rewind_history.update(solver.world, ++simulation_step);
+            if(trajectory_writer) trajectory_writer->append(solver.world);
+        }, solver.world, delta_time, &solver.profile);
+        EngiGraph::StepProfileHistory profile_history;
+
         while (!glfwWindowShouldClose(window)) {
             glfwPollEvents();
 
@@ -107,8 +139,17 @@ int main(int, char**)
             }
 
 
-            for (const auto& body : solver.bodies) {
-                pipeline.submitDrawCall(EngiGraph::DeferredPipelineOgl::DrawCall{mesh_cube_visual,albedo_blue,body.getRenderTransform().cast<float>()});
+            const auto& snapshot = physics.getSnapshot();
+            if(physics.updateSnapshots()){
+                for (const auto& step_profile : snapshot.step_profiles) {
+                    profile_history.push(step_profile);
+                }
+            }
+            if(trajectory_reader){
+                //Playback draws the recorded poses instead of the live simulation
+                render_table.submitDrawCalls(pipeline, trajectory_reader->readStep(trajectory_step));
+            }else{
+                render_table.submitDrawCalls(pipeline, physics.getPreviousSnapshot(), snapshot, physics.getInterpolationFactor());
             }
             pipeline.render();
 
@@ -119,35 +160,146 @@ int main(int, char**)
             ImGui::NewFrame();
 
             if(ImGui::CollapsingHeader("Physics")){
-                ImGui::DragFloat("delta time", &delta_time,0.001f,0.0001f);
+                if(ImGui::DragFloat("delta time", &delta_time,0.001f,0.0001f)){
+                    physics.setDeltaTime(std::max(delta_time, 0.0001f));
+                }
+                //Only this thread writes settings, so reading them without the lock is fine
+                bool allow_sleeping = solver.sleep_settings.enabled;
+                if(ImGui::Checkbox("Allow sleeping", &allow_sleeping)){
+                    physics.edit([&](){ solver.sleep_settings.enabled = allow_sleeping; });
+                }
+                auto contact_settings = solver.contact_solver.settings;
+                bool settings_edited = ImGui::DragScalar("Solver iterations", ImGuiDataType_U32, &contact_settings.max_iterations);
+                settings_edited |= ImGui::DragScalar("Relaxation", ImGuiDataType_Double, &contact_settings.relaxation, 0.01f);
+                settings_edited |= ImGui::DragScalar("Friction", ImGuiDataType_Double, &contact_settings.friction, 0.01f);
+                settings_edited |= ImGui::Checkbox("Warm starting", &contact_settings.warm_starting);
+                if(settings_edited){
+                    physics.edit([&](){ solver.contact_solver.settings = contact_settings; });
+                }
                 if(ImGui::Button("Step")){
-                    solver.step(delta_time);
+                    physics.requestStep();
                 }
-                if(step){
+                if(physics.isRunning()){
                     if(ImGui::Button("Stop")){
-                        solver.bodies = last_rigidbody_data;
-                        step = false;
+                        physics.setRunning(false);
+                        physics.edit([&](){
+                            start_snapshot.restore(solver.world);
+                            EngiGraph::resetSolverCaches(solver);
+                            recorder.recordWorldReset(solver.world);
+                            rewind_history.clear();
+                        });
                     }
                 }else{
                     if(ImGui::Button("Start")){
-                        last_rigidbody_data = solver.bodies;
-                        step = true;
+                        physics.edit([&](){ start_snapshot = EngiGraph::WorldSnapshot::capture(solver.world); });
+                        physics.setRunning(true);
+                    }
+                }
+                ImGui::Text("Steps: %llu", (unsigned long long)physics.getStepCount());
+
+                ImGui::DragInt("Rewind steps", &rewind_steps, 1.0f, 1, 100000);
+                if(ImGui::Button("Rewind")){
+                    physics.edit([&](){
+                        if(rewind_history.getCount() == 0) return;
+                        const uint64_t target = simulation_step > (uint64_t)rewind_steps ? simulation_step - rewind_steps : 0;
+                        simulation_step = rewind_history.rewind(solver.world, target);
+                        EngiGraph::resetSolverCaches(solver);
+                        recorder.recordWorldReset(solver.world);
+                    });
+                }
+
+                ImGui::InputText("Recording file", recording_file, sizeof(recording_file));
+                //Only this thread starts and stops recording, so reading the flag without the lock is fine
+                if(!recorder.isRecording()){
+                    if(ImGui::Button("Start recording")){
+                        physics.edit([&](){ recorder.start(solver); });
+                    }
+                }else{
+                    if(ImGui::Button("Stop and save recording")){
+                        physics.edit([&](){ recorder.stop(); });
+                        //The physics thread no longer touches the recording once stopped
+                        EngiGraph::saveRecording(recorder.getRecording(), recording_file);
+                    }
+                    ImGui::SameLine();
+                    ImGui::Text("Recording");
+                }
+
+                if(ImGui::CollapsingHeader("Trajectory")){
+                    ImGui::InputText("Trajectory file", trajectory_file, sizeof(trajectory_file));
+                    try {
+                        //Only this thread creates and destroys the writer, so reading the pointer without the lock is fine
+                        if(!trajectory_writer){
+                            if(ImGui::Button("Record trajectory")){
+                                auto writer = std::make_unique<EngiGraph::TrajectoryWriter>(trajectory_file, delta_time);
+                                physics.edit([&](){ trajectory_writer = std::move(writer); });
+                            }
+                        }else if(ImGui::Button("Stop trajectory")){
+                            std::unique_ptr<EngiGraph::TrajectoryWriter> writer;
+                            physics.edit([&](){ writer = std::move(trajectory_writer); });
+                            writer->close();
+                        }
+                        if(!trajectory_reader){
+                            if(ImGui::Button("Open for playback")){
+                                trajectory_reader = std::make_unique<EngiGraph::TrajectoryReader>(trajectory_file);
+                                trajectory_step = 0;
+                                trajectory_time = 0.0;
+                                trajectory_error.clear();
+                            }
+                        }else{
+                            const uint64_t first_step = 0;
+                            const uint64_t last_step = std::max<uint64_t>(trajectory_reader->getStepCount(), 1) - 1;
+                            if(ImGui::SliderScalar("Step", ImGuiDataType_U64, &trajectory_step, &first_step, &last_step)){
+                                trajectory_time = (double)trajectory_step * trajectory_reader->getDeltaTime();
+                            }
+                            ImGui::Checkbox("Play", &trajectory_playing);
+                            if(trajectory_playing && trajectory_reader->getDeltaTime() > 0.0){
+                                trajectory_time += io.DeltaTime;
+                                trajectory_step = (uint64_t)(trajectory_time / trajectory_reader->getDeltaTime());
+                                if(trajectory_step > last_step){
+                                    trajectory_step = 0;
+                                    trajectory_time = 0.0;
+                                }
+                            }
+                            if(trajectory_reader->getStepCount() == 0 || ImGui::Button("Close playback")){
+                                trajectory_reader.reset();
+                            }
+                        }
+                    } catch (const EngiGraph::RuntimeException& e) {
+                        trajectory_error = e.what();
+                        trajectory_reader.reset();
                     }
+                    if(!trajectory_error.empty()) ImGui::TextWrapped("%s", trajectory_error.c_str());
                 }
 
                 ImGui::Indent();
-                int i = 0;
-                for ( auto& body : solver.bodies) {
-                    ImGui::PushID(i);
-                    i++;
+                for (uint32_t i = 0; i < snapshot.getBodyCount(); ++i) {
+                    const EngiGraph::BodyHandle handle = snapshot.handles[i];
+                    ImGui::PushID((int)handle.slot);
                     if (ImGui::CollapsingHeader("Body")) {
-                        if(ImGui::DragScalarN("Position", ImGuiDataType_Double,body.position.data(),3)){
-                            body.updateCurrentTransform();
+                        //Show the published state, and write edits back between steps
+                        Eigen::Vector3d position = snapshot.positions[i];
+                        Eigen::Vector3d force = snapshot.forces[i];
+                        Eigen::Vector3d velocity = snapshot.velocities[i];
+                        Eigen::Vector3d angular_velocity = snapshot.angular_velocities[i];
+                        bool edited = ImGui::DragScalarN("Position", ImGuiDataType_Double,position.data(),3);
+                        edited |= ImGui::DragScalarN("Force", ImGuiDataType_Double,force.data(),3);
+                        edited |= ImGui::DragScalarN("Velocity", ImGuiDataType_Double,velocity.data(),3);
+                        edited |= ImGui::DragScalarN("Angular Velocity", ImGuiDataType_Double,angular_velocity.data(),3);
+                        if(edited){
+                            physics.edit([&](){
+                                auto& world = solver.world;
+                                if(!world.isValid(handle)) return;
+                                uint32_t index = world.getIndex(handle);
+                                world.setPosition(index, position);
+                                world.setForce(index, force);
+                                world.setVelocity(index, velocity);
+                                world.setAngularVelocity(index, angular_velocity);
+                                //Edits to a sleeping body would otherwise be ignored
+                                world.wakeBody(index);
+                                recorder.recordBodyChanged(world, index);
+                            });
                         }
-                        ImGui::DragScalarN("Force", ImGuiDataType_Double,body.force.data(),3);
-
-                        ImGui::DragScalarN("Velocity", ImGuiDataType_Double,body.velocity.data(),3);
-                        ImGui::DragScalarN("Angular Velocity", ImGuiDataType_Double,body.angular_velocity.data(),3);
+                        ImGui::Text((snapshot.flags[i] & EngiGraph::BODY_FLAG_SLEEPING) ? "Sleeping" : "Awake");
                     }
                     ImGui::PopID();
                 }
@@ -158,19 +310,21 @@ int main(int, char**)
 
 
                     if(ImGui::Button("Add box")){
-                        EngiGraph::VBDSolver::Box box{mass,box_dimensions};
-                        solver.bodies.push_back(box);
+                        auto body = physics.edit([&](){
+                            auto handle = solver.addBox(mass, box_dimensions);
+                            recorder.recordBodyAdded(solver.world, handle);
+                            return handle;
+                        });
+                        //The render cube spans 0 to 1, while the collider is centered
+                        Eigen::Transform<double,3,Eigen::Affine> render_transform = Eigen::Transform<double,3,Eigen::Affine>::Identity();
+                        render_transform.scale(box_dimensions).translate(Eigen::Vector3d{-0.5,-0.5,-0.5});
+                        render_table.set(body, {mesh_cube_visual, albedo_blue, render_transform.matrix()});
                     }
 
                 }
             }
 
 
-            if(step){
-                solver.step(delta_time);
-            }
-
-
             if (ImGui::CollapsingHeader("Lights")) {
                 ImGui::Indent();
                 int i = 0;
@@ -201,12 +355,49 @@ int main(int, char**)
                     pipeline.camera.setLookTarget(cam_look);
                 }
             }
+            if (ImGui::CollapsingHeader("Tracing")) {
+                bool tracing = EngiGraph::isTracingEnabled();
+                if(ImGui::Checkbox("Record trace", &tracing)){
+                    EngiGraph::setTracingEnabled(tracing);
+                }
+                if(ImGui::Button("Save trace.json")){
+                    EngiGraph::writeChromeTrace("trace.json");
+                }
+                ImGui::SameLine();
+                if(ImGui::Button("Clear trace")){
+                    EngiGraph::clearTrace();
+                }
+            }
             if (ImGui::CollapsingHeader("World")) {
                 ImGui::ColorEdit3("Ambient", pipeline.ambient_color.data());
             }
 
             ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
 
+            ImGui::Begin("Physics profiler");
+            if(profile_history.getCount() == 0){
+                ImGui::Text("No steps taken yet");
+            }else{
+                const auto& last = profile_history.get(profile_history.getCount() - 1);
+                const auto average = profile_history.getAverage();
+                ImGui::Text("Step: %.3f ms (average %.3f ms over %u steps)", last.total_seconds * 1000.0, average.total_seconds * 1000.0, profile_history.getCount());
+                ImGui::Text("Pairs tested: %llu  Hits: %llu  Contacts: %llu", (unsigned long long)last.pairs_tested, (unsigned long long)last.hits, (unsigned long long)last.contacts);
+                ImGui::Text("TOI iterations: %llu  Solver iterations: %llu", (unsigned long long)last.toi_iterations, (unsigned long long)last.solver_iterations);
+                auto step_milliseconds = profile_history.getMilliseconds(EngiGraph::StepProfile::PHASE_COUNT);
+                ImGui::PlotLines("Step ms", step_milliseconds.data(), (int)step_milliseconds.size(), 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 60));
+                for (int phase = 0; phase < EngiGraph::StepProfile::PHASE_COUNT; ++phase) {
+                    auto phase_milliseconds = profile_history.getMilliseconds((EngiGraph::StepProfile::Phase)phase);
+                    char overlay[32];
+                    std::snprintf(overlay, sizeof(overlay), "avg %.3f ms", average.phase_seconds[phase] * 1000.0);
+                    ImGui::PlotLines(EngiGraph::StepProfile::getPhaseName((EngiGraph::StepProfile::Phase)phase), phase_milliseconds.data(),
+                                     (int)phase_milliseconds.size(), 0, overlay, 0.0f, FLT_MAX, ImVec2(0, 40));
+                }
+                if(ImGui::Button("Clear history")){
+                    profile_history.clear();
+                }
+            }
+            ImGui::End();
+
             //Render OpenGL pipeline to sub window
             ImGui::Begin("GameWindow");
             {
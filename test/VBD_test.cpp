@@ -17,9 +17,16 @@ TEST(PHYSICS_TESTS, TEST_INERTIA_TENSOR){
     ASSERT_DOUBLE_EQ(rigidbody.mass, 0.1 * 6.0);
 
     //row, column
-    //todo fix
     //see https://physics.stackexchange.com/questions/105229/tensor-of-inertia-of-a-hollow-cube for how analytical values were calculated
-    std::cout << rigidbody.inertia_tensor << "\n";
-  //  ASSERT_NEAR(rigidbody.inertia_tensor.coeff(0,0), 5.0/3.0 * 0.1 * 1.0 , 0.0001); //5/3 ma^2
+    //5/18 ma^2 with a the side length
+    ASSERT_NEAR(rigidbody.inertia_tensor.coeff(0,0), 5.0/18.0 * 0.6, 1e-9);
+    ASSERT_NEAR(rigidbody.inertia_tensor.coeff(1,1), 5.0/18.0 * 0.6, 1e-9);
+    ASSERT_NEAR(rigidbody.inertia_tensor.coeff(0,1), 0.0, 1e-9);
+
+    //Scaling is applied to the cached properties
+    auto scaled = EngiGraph::RigidBody(mesh_cube_ptr,1.0,0.1,{2,2,2});
+    ASSERT_DOUBLE_EQ(scaled.mass, 4.0 * 0.6);
+    ASSERT_TRUE(scaled.center_of_mass.isApprox(Eigen::Vector3d{1,1,1}));
+    ASSERT_NEAR(scaled.inertia_tensor.coeff(2,2), 5.0/18.0 * 2.4 * 4.0, 1e-9);
 
 }
\ No newline at end of file
@@ -0,0 +1,62 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/World/PhysicsWorld.h"
+#include "src/Physics/World/BatchIntegrator.h"
+
+TEST(PHYSICS_TESTS, TEST_BATCH_INTEGRATOR){
+    //Odd count, so both the vector and the scalar remainder paths run
+    const uint32_t body_count = 23;
+    const double delta_time = 0.02;
+    EngiGraph::PhysicsWorld world;
+    std::vector<uint8_t> move_mask(body_count);
+    for (uint32_t i = 0; i < body_count; ++i) {
+        EngiGraph::BodyDescription description{};
+        description.position = {i * 1.0, i * -0.5, 2.0};
+        description.velocity = {0.1 * i, 1.0, -0.3 * i};
+        description.angular_velocity = {0.2 * i, -1.0, 0.05 * i};
+        description.rotation = Eigen::Quaterniond(Eigen::AngleAxisd(0.1 * i, Eigen::Vector3d{1, (double)i, 2}.normalized()));
+        description.scale = {1.0 + 0.1 * i, 1.0, 2.0};
+        world.createBody(description);
+        if(i % 5 == 0) world.sleepBody(i);
+        move_mask[i] = i % 3 != 0;
+    }
+
+    //Reference Eigen quaternion update
+    auto predict = [&](uint32_t i, double step){
+        Eigen::Quaterniond rotation = world.getRotation(i);
+        Eigen::Vector3d half_angular = 0.5 * step * world.getAngularVelocity(i);
+        Eigen::Quaterniond predicted = Eigen::Quaterniond(0, half_angular.x(), half_angular.y(), half_angular.z()) * rotation;
+        predicted.coeffs() += rotation.coeffs();
+        Eigen::Transform<double,3,Eigen::Affine> transform = Eigen::Transform<double,3,Eigen::Affine>::Identity();
+        transform.translate(world.getPosition(i) + world.getVelocity(i) * step).rotate(predicted.normalized()).scale(world.getScale(i));
+        return transform;
+    };
+
+    std::vector<Eigen::Matrix4d> transforms(body_count);
+    EngiGraph::writePoseTransforms(world.states, delta_time, transforms.data(), 0, body_count);
+    std::vector<Eigen::Matrix4d> expected(body_count);
+    for (uint32_t i = 0; i < body_count; ++i) {
+        const double step = world.hasFlag(i, EngiGraph::BODY_FLAG_SLEEPING) ? 0.0 : delta_time;
+        ASSERT_TRUE(transforms[i].isApprox(predict(i, step).matrix(), 1e-12));
+        expected[i] = predict(i, (step == 0.0 || move_mask[i] == 0) ? 0.0 : delta_time).matrix();
+    }
+
+    //A body gets the same result whether it is in a vector group or the scalar remainder
+    EngiGraph::PhysicsWorld one_by_one = world;
+    std::vector<Eigen::Matrix4d> one_by_one_transforms(body_count);
+    for (uint32_t i = 0; i < body_count; ++i) {
+        EngiGraph::writePoseTransforms(one_by_one.states, delta_time, one_by_one_transforms.data(), i, i + 1);
+        ASSERT_EQ(one_by_one_transforms[i], transforms[i]);
+        EngiGraph::integratePoses(one_by_one.states, delta_time, move_mask.data(), i, i + 1);
+    }
+
+    EngiGraph::integratePoses(world.states, delta_time, move_mask.data(), 0, body_count);
+    for (uint32_t i = 0; i < body_count; ++i) {
+        ASSERT_TRUE(world.getColliderTransform(i).isApprox(expected[i], 1e-12));
+        ASSERT_NEAR(world.getRotation(i).norm(), 1.0, 1e-12);
+        ASSERT_EQ(world.getPosition(i), one_by_one.getPosition(i));
+        ASSERT_EQ(world.getRotation(i).coeffs(), one_by_one.getRotation(i).coeffs());
+    }
+}
@@ -0,0 +1,106 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include <future>
+#include <thread>
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Physics/Collisions/LinearPointCcd.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Geometry/MeshUtilities.h"
+#include "src/Exceptions/RuntimeException.h"
+
+TEST(COLLIDER_REGISTRY_TESTS, TEST_SHARING){
+    EngiGraph::ColliderRegistry registry;
+    auto box_a = registry.getBox();
+    auto box_b = registry.getBox();
+    ASSERT_EQ(box_a.get(), box_b.get());
+    ASSERT_NE(registry.getTorus(1.0f, 0.2f).get(), registry.getTorus(1.0f, 0.3f).get());
+
+    //Cooking parameters are part of the key
+    auto cube = registry.loadMesh("test_files/cube.obj");
+    ASSERT_EQ(cube.get(), registry.loadMesh("test_files/cube.obj").get());
+    ASSERT_NE(cube.get(), registry.loadMesh("test_files/cube.obj", 0.01f).get());
+    ASSERT_EQ(cube->vertices.size(), 8u);
+    ASSERT_THROW(registry.loadMesh("test_files/missing.obj"), EngiGraph::RuntimeException);
+
+    //The registry does not keep colliders alive
+    ASSERT_EQ(registry.getLiveCount(), 2u);
+    const uint64_t cooked = registry.getCookCount();
+    box_a.reset();
+    box_b.reset();
+    ASSERT_EQ(registry.getLiveCount(), 1u);
+    registry.getBox();
+    ASSERT_EQ(registry.getCookCount(), cooked + 1);
+}
+
+TEST(COLLIDER_REGISTRY_TESTS, TEST_COOK_WITHOUT_LOCK){
+    EngiGraph::ColliderRegistry registry;
+    //Other threads can use the registry while a collider cooks
+    auto slow = registry.getOrCook({"slow"}, [&](){
+        auto box = std::async(std::launch::async, [&](){
+            return registry.getBox();
+        });
+        EXPECT_EQ(box.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+        return EngiGraph::makeBoxMesh({1, 1, 1});
+    });
+    ASSERT_EQ(registry.getLiveCount(), 1u);
+
+    //Threads cooking the same key at once share the first one stored
+    std::vector<std::shared_ptr<const EngiGraph::Mesh>> cubes(8);
+    std::vector<std::thread> threads;
+    for (auto& cube : cubes) {
+        threads.emplace_back([&](){
+            cube = registry.loadMesh("test_files/cube.obj");
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    for (const auto& cube : cubes) ASSERT_EQ(cube.get(), cubes[0].get());
+    ASSERT_EQ(registry.getLiveCount(), 2u);
+}
+
+TEST(COLLIDER_REGISTRY_TESTS, TEST_BOXES_SHARE_COLLIDER){
+    EngiGraph::VBDSolver solver;
+    const uint64_t cooked = EngiGraph::ColliderRegistry::getShared().getCookCount();
+    for (int i = 0; i < 100; ++i) {
+        solver.addBox(1.0, {1.0 + i, 2.0, 0.5}, {3.0 * i, 0, 0});
+    }
+    ASSERT_LE(EngiGraph::ColliderRegistry::getShared().getCookCount(), cooked + 1);
+    ASSERT_EQ(solver.world.colliders[0].get(), solver.world.colliders[99].get());
+    ASSERT_EQ(solver.world.getScale(5), Eigen::Vector3d(6.0, 2.0, 0.5));
+    ASSERT_THROW(solver.addBox(1.0, {1.0, 0.0, 1.0}), EngiGraph::RuntimeException);
+}
+
+TEST(COLLIDER_REGISTRY_TESTS, TEST_SCALED_CCD){
+    //A unit box scaled by the transform must collide like a box with the size baked in
+    const Eigen::Vector3d dimensions = {2.0, 0.5, 1.0};
+    auto unit_box = EngiGraph::makeBoxMesh({1, 1, 1});
+    auto baked_box = EngiGraph::makeBoxMesh(dimensions.cast<float>());
+    auto floor = EngiGraph::makeBoxMesh({10, 1, 10});
+
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    description.position = {0.3, 1.0, 0.0};
+    description.rotation = Eigen::Quaterniond(Eigen::AngleAxisd(0.2, Eigen::Vector3d::UnitY()));
+    description.scale = dimensions;
+    world.createBody(description);
+    Eigen::Matrix4d pose_initial = world.getTransform(0);
+    Eigen::Matrix4d scaled_initial = world.getColliderTransform(0);
+    world.setPosition(0, {0.3, 0.2, 0.0});
+    Eigen::Matrix4d pose_final = world.getTransform(0);
+    Eigen::Matrix4d scaled_final = world.getColliderTransform(0);
+
+    Eigen::Matrix4d floor_transform = Eigen::Matrix4d::Identity();
+    floor_transform(1, 3) = -0.5;
+    auto baked_hits = EngiGraph::linearCCD(baked_box, floor, pose_initial, floor_transform, pose_final, floor_transform);
+    auto scaled_hits = EngiGraph::linearCCD(unit_box, floor, scaled_initial, floor_transform, scaled_final, floor_transform);
+    ASSERT_FALSE(baked_hits.empty());
+    ASSERT_EQ(baked_hits.size(), scaled_hits.size());
+    for (size_t i = 0; i < baked_hits.size(); ++i) {
+        ASSERT_NEAR(baked_hits[i].time, scaled_hits[i].time, 1e-6);
+        ASSERT_TRUE(baked_hits[i].global_point.isApprox(scaled_hits[i].global_point, 1e-6));
+        ASSERT_TRUE(baked_hits[i].normal_a_to_b.isApprox(scaled_hits[i].normal_a_to_b, 1e-6));
+    }
+    //The box bottom is 0.25 below its center, so it touches the floor top after moving 0.75 of 0.8
+    ASSERT_NEAR(scaled_hits[0].time, 0.75 / 0.8, 1e-6);
+}
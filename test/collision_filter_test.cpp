@@ -0,0 +1,90 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Physics/World/WorldSnapshot.h"
+#include "src/Scenes/SceneDescription.h"
+#include "src/Exceptions/RuntimeException.h"
+
+TEST(PHYSICS_TESTS, TEST_COLLISION_LAYERS){
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    description.collision_layer = 0b01;
+    description.collision_mask = 0b10;
+    world.createBody(description); //Debris, only hits the ground
+    world.createBody(description);
+    description.collision_layer = 0b10;
+    description.collision_mask = 0xFFFFFFFF;
+    world.createBody(description); //Ground
+    ASSERT_FALSE(world.canPairCollide(0, 1));
+    ASSERT_TRUE(world.canPairCollide(0, 2));
+    ASSERT_TRUE(world.canPairCollide(2, 1));
+    //Both masks have to agree
+    world.setCollisionFilter(2, 0b10, 0b100);
+    ASSERT_FALSE(world.canPairCollide(0, 2));
+    ASSERT_EQ(world.getCollisionMask(2), 0b100u);
+}
+
+TEST(PHYSICS_TESTS, TEST_PAIR_EXCLUSIONS){
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    auto a = world.createBody(description);
+    auto b = world.createBody(description);
+    auto c = world.createBody(description);
+    ASSERT_THROW(world.excludePair(a, a), EngiGraph::RuntimeException);
+    ASSERT_TRUE(world.excludePair(b, a));
+    ASSERT_FALSE(world.excludePair(a, b));
+    ASSERT_TRUE(world.isPairExcluded(0, 1));
+    ASSERT_TRUE(world.isPairExcluded(1, 0));
+    ASSERT_FALSE(world.canPairCollide(0, 1));
+    ASSERT_TRUE(world.canPairCollide(0, 2));
+
+    //Exclusions follow bodies when they move between dense indices
+    world.excludePair(a, c);
+    const uint64_t hash = world.hashState();
+    auto snapshot = EngiGraph::WorldSnapshot::capture(world);
+    world.destroyBody(a);
+    ASSERT_EQ(world.getPairExclusions().size(), 0u);
+    ASSERT_NE(world.hashState(), hash);
+    //A new body in the freed slot starts without exclusions
+    world.createBody(description);
+    ASSERT_TRUE(world.canPairCollide(world.getIndex(b), 2));
+
+    snapshot.restore(world);
+    ASSERT_EQ(world.hashState(), hash);
+    ASSERT_TRUE(world.includePair(a, b));
+    ASSERT_FALSE(world.includePair(a, b));
+    ASSERT_TRUE(world.isPairExcluded(world.getIndex(a), world.getIndex(c)));
+}
+
+TEST(SCENE_TESTS, TEST_SCENE_FILTERING){
+    auto scene = EngiGraph::parseScene("box 4 0.5 4\nstatic\nlayer 2\nbox 1 1 1\nlayer 1\nmask 2\nbox 1 1 1\nexclude 1\n");
+    ASSERT_EQ(scene.bodies[1].description.collision_mask, 2u);
+    ASSERT_EQ(scene.bodies[2].excluded_bodies, std::vector<uint32_t>{1});
+    EXPECT_THROW(EngiGraph::parseScene("box 1 1 1\nexclude 0\n"), EngiGraph::RuntimeException);
+    auto reparsed = EngiGraph::parseScene(EngiGraph::writeScene(scene));
+    ASSERT_EQ(reparsed.bodies[0].description.collision_layer, 2u);
+    ASSERT_EQ(reparsed.bodies[2].excluded_bodies, scene.bodies[2].excluded_bodies);
+
+    EngiGraph::PhysicsWorld world;
+    auto handles = EngiGraph::buildScene(scene, world);
+    ASSERT_TRUE(world.isPairExcluded(world.getIndex(handles[1]), world.getIndex(handles[2])));
+    ASSERT_TRUE(world.canPairCollide(world.getIndex(handles[0]), world.getIndex(handles[1])));
+}
+
+TEST(PHYSICS_TESTS, TEST_VBD_EXCLUDED_PAIR_PASSES_THROUGH){
+    EngiGraph::VBDSolver solver;
+    solver.sleep_settings.enabled = false;
+    auto a = solver.addBox(1.0, {1,1,1}, {0,0,0});
+    auto b = solver.addBox(1.0, {1,1,1}, {3,0,0});
+    auto& world = solver.world;
+    world.setVelocity(world.getIndex(b), {-10,0,0});
+    world.excludePair(a, b);
+    for (int j = 0; j < 60; ++j) {
+        solver.step(0.01);
+    }
+    ASSERT_EQ(solver.profile.pairs_tested, 0u);
+    ASSERT_NEAR(world.getPosition(world.getIndex(b)).x(), -3.0, 1e-9);
+    ASSERT_EQ(world.getPosition(world.getIndex(a)), Eigen::Vector3d(0,0,0));
+}
@@ -0,0 +1,115 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include <cstdio>
+#include "src/Physics/Collisions/BodyCollision.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Scenes/SceneDescription.h"
+#include "src/Scenes/SimulationRecording.h"
+#include "src/Exceptions/RuntimeException.h"
+
+/**
+ * Two unit boxes centered at x = -1.5 and x = 1.5.
+ */
+static std::shared_ptr<const EngiGraph::CompoundCollider> makeDumbbell() {
+    auto box = EngiGraph::ColliderRegistry::getShared().getBox();
+    Eigen::Affine3d left = Eigen::Affine3d::Identity();
+    left.translate(Eigen::Vector3d{-1.5, 0, 0});
+    Eigen::Affine3d right = Eigen::Affine3d::Identity();
+    right.translate(Eigen::Vector3d{1.5, 0, 0});
+    return std::make_shared<const EngiGraph::CompoundCollider>(std::vector<EngiGraph::CompoundChild>{{box, left.matrix()}, {box, right.matrix()}});
+}
+
+TEST(INTERSECTION_TESTS, TEST_COMPOUND_COLLIDER){
+    ASSERT_THROW(EngiGraph::CompoundCollider({}), EngiGraph::RuntimeException);
+    auto compound = makeDumbbell();
+    ASSERT_EQ(compound->getMergedMesh()->vertices.size(), 16u);
+    ASSERT_EQ(compound->getMergedMesh()->triangle_indices.size(), 72u);
+    ASSERT_EQ(compound->getChildBounds(1).minimum, Eigen::Vector3d(1, -0.5, -0.5));
+
+    //Only the child near the box is found, also when the compound moves toward it during the step
+    EngiGraph::Aabb near_left{{-2, 1, -0.1}, {-1.8, 1.2, 0.1}};
+    std::vector<uint32_t> found;
+    compound->queryChildren(Eigen::Matrix4d::Identity(), Eigen::Matrix4d::Identity(), near_left, found);
+    ASSERT_EQ(found, std::vector<uint32_t>{});
+    Eigen::Matrix4d raised = Eigen::Matrix4d::Identity();
+    raised(1,3) = 1.0;
+    compound->queryChildren(Eigen::Matrix4d::Identity(), raised, near_left, found);
+    ASSERT_EQ(found, std::vector<uint32_t>{0});
+}
+
+TEST(INTERSECTION_TESTS, TEST_COMPOUND_CCD){
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    description.compound = makeDumbbell();
+    description.collider = EngiGraph::ColliderRegistry::getShared().getBox(); //Ignored
+    const uint32_t dumbbell = world.getIndex(world.createBody(description));
+    ASSERT_EQ(world.colliders[dumbbell], description.compound->getMergedMesh());
+    description.compound = nullptr;
+    description.scale = {0.5, 0.5, 0.5};
+    description.position = {0, 1, 0};
+    description.velocity = {0, -100, 0};
+    const uint32_t through_gap = world.getIndex(world.createBody(description));
+    description.position = {1.5, 1, 0};
+    const uint32_t onto_right = world.getIndex(world.createBody(description));
+    world.updateCurrentTransforms();
+    world.updateFutureTransforms(0.01);
+    EngiGraph::CollisionBounds bounds;
+    bounds.update(world);
+
+    //Falls between the children, so no hit even though it crosses the merged bounds
+    ASSERT_TRUE(bounds.overlaps(dumbbell, through_gap));
+    ASSERT_TRUE(EngiGraph::collideBodies(world, bounds, dumbbell, through_gap).empty());
+
+    //Same earliest hit as CCD against the merged mesh
+    auto hits = EngiGraph::collideBodies(world, bounds, dumbbell, onto_right);
+    auto merged_hits = EngiGraph::linearCCD(*world.colliders[dumbbell], *world.colliders[onto_right], world.current_transforms[dumbbell],
+                                            world.current_transforms[onto_right], world.future_transforms[dumbbell], world.future_transforms[onto_right]);
+    ASSERT_FALSE(hits.empty());
+    ASSERT_FALSE(merged_hits.empty());
+    ASSERT_NEAR(hits[0].time, merged_hits[0].time, 1e-9);
+    ASSERT_NEAR(hits[0].time, 0.25, 1e-6);
+    for (const auto& hit : hits) {
+        ASSERT_NEAR(hit.global_point.y(), 0.5, 1e-6);
+        ASSERT_GT(hit.global_point.x(), 1.0 - 1e-9);
+    }
+}
+
+TEST(SCENE_TESTS, TEST_COMPOUND_SCENE_AND_RECORDING){
+    auto& registry = EngiGraph::ColliderRegistry::getShared();
+    auto compound = registry.loadCompound("test_files/two_cubes.obj");
+    ASSERT_EQ(compound.get(), registry.loadCompound("test_files/two_cubes.obj").get());
+    ASSERT_EQ(compound->getChildCount(), 2u);
+    ASSERT_THROW(registry.loadCompound("test_files/missing.obj"), EngiGraph::RuntimeException);
+
+    auto scene = EngiGraph::parseScene("compound test_files/two_cubes.obj 1 1 1\nstatic\nbox 0.5 0.5 0.5\nposition 0 2 0\nbox 0.5 0.5 0.5\nposition 1.5 2 0\n");
+    ASSERT_EQ(EngiGraph::parseScene(EngiGraph::writeScene(scene)).bodies[0].shape, EngiGraph::SceneShape::COMPOUND);
+    EngiGraph::VBDSolver solver;
+    solver.gravity = scene.gravity;
+    auto handles = EngiGraph::buildScene(scene, solver.world);
+    ASSERT_EQ(solver.world.compound_colliders[0], compound);
+
+    EngiGraph::SimulationRecorder recorder;
+    recorder.start(solver);
+    for (int j = 0; j < 100; ++j) {
+        recorder.step(solver, scene.delta_time);
+    }
+    //One box fell through the gap, the other landed on a cube
+    ASSERT_LT(solver.world.getPosition(solver.world.getIndex(handles[1])).y(), -1.0);
+    ASSERT_NEAR(solver.world.getPosition(solver.world.getIndex(handles[2])).y(), 0.75, 0.05);
+
+    EngiGraph::saveRecording(recorder.stop(), "compound_test.egrec");
+    auto recording = EngiGraph::loadRecording("compound_test.egrec");
+    std::remove("compound_test.egrec");
+    ASSERT_EQ(recording.initial_world.compound_colliders[0]->getChildCount(), 2u);
+    ASSERT_EQ(recording.initial_world.compound_colliders[1], nullptr);
+    EngiGraph::VBDSolver replay_solver;
+    EngiGraph::SimulationReplay replay(recording);
+    replay.start(replay_solver);
+    while (!replay.isFinished()) {
+        replay.step(replay_solver);
+        ASSERT_TRUE(replay.verify(replay_solver.world));
+    }
+}
@@ -0,0 +1,62 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/Contacts/ContactManifold.h"
+
+TEST(PHYSICS_TESTS, TEST_MANIFOLD_REDUCTION){
+    //A 3x3 grid of points on a square reduces to its corners
+    std::vector<EngiGraph::ManifoldPoint> points{};
+    for (int x = -1; x <= 1; ++x) {
+        for (int z = -1; z <= 1; ++z) {
+            Eigen::Vector3d point{(double)x, 0.0, (double)z};
+            points.push_back({point, point, {0,1,0}});
+        }
+    }
+    EngiGraph::reduceManifoldPoints(points);
+    ASSERT_EQ(points.size(), 4);
+    for (const auto& point : points) {
+        ASSERT_DOUBLE_EQ(std::abs(point.local_point_a.x()), 1.0);
+        ASSERT_DOUBLE_EQ(std::abs(point.local_point_a.z()), 1.0);
+    }
+}
+
+TEST(PHYSICS_TESTS, TEST_MANIFOLD_PERSISTENCE){
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    auto ground = world.createBody(description);
+    description.position = {0,1,0};
+    auto box = world.createBody(description);
+
+    std::vector<EngiGraph::CCDHit> hits{};
+    for (int j = 0; j < 8; ++j) {
+        hits.push_back({0.0, {std::cos(j * 0.785), 0.5, std::sin(j * 0.785)}, {0,1,0}});
+    }
+    EngiGraph::ContactManifolds manifolds;
+    manifolds.addHits(world, 0, 1, hits);
+    auto contacts = manifolds.getContacts(world);
+    ASSERT_EQ(contacts.size(), 4);
+
+    //Impulses stay with the points when the same hits come back next step
+    for (auto& contact : contacts) {
+        contact.normal_impulse = 2.0;
+    }
+    manifolds.storeImpulses(world, contacts);
+    manifolds.refresh(world);
+    manifolds.addHits(world, 0, 1, hits);
+    contacts = manifolds.getContacts(world);
+    ASSERT_EQ(contacts.size(), 4);
+    for (const auto& contact : contacts) {
+        ASSERT_DOUBLE_EQ(contact.normal_impulse, 2.0);
+    }
+
+    //Hits of the reversed pair land in the same manifold
+    manifolds.addHits(world, 1, 0, {{0.0, {0,0.5,0}, {0,-1,0}}});
+    ASSERT_EQ(manifolds.getManifoldCount(), 1);
+    ASSERT_TRUE(manifolds.find(ground, box)->points.back().local_normal_a.isApprox(Eigen::Vector3d{0,1,0}));
+
+    //Separating the bodies breaks the contact
+    world.setPosition(1, {0,2,0});
+    manifolds.refresh(world);
+    ASSERT_EQ(manifolds.getManifoldCount(), 0);
+}
@@ -0,0 +1,97 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/Contacts/ContactSolver.h"
+#include "src/Physics/Contacts/ContactColoring.h"
+#include "src/Physics/VBD/VbdSolver.h"
+
+TEST(PHYSICS_TESTS, TEST_CONTACT_SOLVER){
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    description.mass = 0.0;
+    world.createBody(description); //Immovable ground
+    description.mass = 2.0;
+    description.position = {0,1,0};
+    description.velocity = {1,-3,0};
+    world.createBody(description);
+
+    //Two points under the body, so it can not start spinning
+    std::vector<EngiGraph::Contact> contacts = {{0, 1, {-0.5,0.5,0}, {0,1,0}}, {0, 1, {0.5,0.5,0}, {0,1,0}}};
+    EngiGraph::ContactSolver solver;
+    solver.settings.friction = 0.0;
+    auto stats = solver.solve(world, contacts, 0.01);
+    ASSERT_NEAR(world.getVelocity(1).y(), 0.0, 1e-3);
+    ASSERT_NEAR(world.getVelocity(1).x(), 1.0, 1e-9); //No friction, keeps sliding
+    ASSERT_NEAR(contacts[0].normal_impulse + contacts[1].normal_impulse, 6.0, 1e-2);
+    ASSERT_LE(stats.residual, solver.settings.residual_tolerance);
+
+    //Warm starting from the solved impulses solves the same contact right away
+    world.setVelocity(1, {1,-3,0});
+    auto warm_stats = solver.solve(world, contacts, 0.01);
+    ASSERT_LT(warm_stats.iterations, stats.iterations);
+    ASSERT_NEAR(world.getVelocity(1).y(), 0.0, 1e-3);
+
+    //Friction stops sliding once the normal impulse is big enough
+    world.setVelocity(1, {1,-3,0});
+    solver.settings.friction = 1.0;
+    solver.solve(world, contacts, 0.01);
+    ASSERT_NEAR(world.getVelocity(1).x(), 0.0, 1e-3);
+}
+
+TEST(PHYSICS_TESTS, TEST_CONTACT_SOLVER_MOMENTUM){
+    //Equal bodies colliding head on stop each other, keeping momentum
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    description.velocity = {1,0,0};
+    world.createBody(description);
+    description.position = {1,0,0};
+    description.velocity = {-1,0,0};
+    world.createBody(description);
+
+    std::vector<EngiGraph::Contact> contacts = {{0, 1, {0.5,0,0}, {1,0,0}}};
+    EngiGraph::ContactSolver solver;
+    solver.solve(world, contacts, 0.01);
+    ASSERT_NEAR(world.getVelocity(0).x(), 0.0, 1e-6);
+    ASSERT_NEAR(world.getVelocity(1).x(), 0.0, 1e-6);
+    ASSERT_NEAR(contacts[0].normal_impulse, 1.0, 1e-6);
+}
+
+TEST(PHYSICS_TESTS, TEST_VBD_CONTACT){
+    //A box thrown at a resting box pushes it
+    EngiGraph::VBDSolver solver;
+    solver.sleep_settings.enabled = false;
+    auto box_a = solver.addBox(1.0, Eigen::Vector3d{1,1,1});
+    auto box_b = solver.addBox(1.0, Eigen::Vector3d{1,1,1}, {1.5,0,0});
+    auto& world = solver.world;
+    world.setVelocity(world.getIndex(box_b), {-10,0,0});
+    for (int j = 0; j < 10; ++j) {
+        solver.step(0.01);
+    }
+    ASSERT_LT(world.getVelocity(world.getIndex(box_a)).x(), -1.0);
+    ASSERT_GT(world.getPosition(world.getIndex(box_b)).x() - world.getPosition(world.getIndex(box_a)).x(), 0.99);
+}
+
+TEST(PHYSICS_TESTS, TEST_CONTACT_COLORING){
+    //A chain resting on immovable body 0
+    std::vector<EngiGraph::Contact> contacts = {{0, 1, {}, {}}, {0, 2, {}, {}}, {1, 2, {}, {}}, {2, 3, {}, {}}, {1, 2, {}, {}}};
+    std::vector<uint8_t> dynamic = {0, 1, 1, 1};
+    auto pairs = EngiGraph::groupContactPairs(contacts);
+    ASSERT_EQ(pairs.size(), 4);
+    ASSERT_EQ(pairs[2].contacts, (std::vector<uint32_t>{2, 4})); //Both contacts between 1 and 2 are solved together
+    auto colors = EngiGraph::colorContactPairs(pairs, dynamic);
+    ASSERT_EQ(colors.size(), 3); //Body 2 is in 3 pairs
+    uint32_t colored_count = 0;
+    for (const auto& color : colors) {
+        std::vector<uint32_t> uses(dynamic.size(), 0);
+        for (uint32_t pair : color) {
+            uses[pairs[pair].body_a]++;
+            uses[pairs[pair].body_b]++;
+        }
+        for (uint32_t body = 1; body < dynamic.size(); ++body) {
+            ASSERT_LE(uses[body], 1);
+        }
+        colored_count += color.size();
+    }
+    ASSERT_EQ(colored_count, pairs.size());
+}
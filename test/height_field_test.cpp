@@ -0,0 +1,152 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include <cstdio>
+#include "src/Physics/Collisions/BodyCollision.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Scenes/SceneDescription.h"
+#include "src/Scenes/SimulationRecording.h"
+#include "src/Exceptions/RuntimeException.h"
+
+TEST(INTERSECTION_TESTS, TEST_HEIGHT_FIELD){
+    ASSERT_THROW(EngiGraph::HeightField(1, 2, {0, 0}), EngiGraph::RuntimeException);
+    ASSERT_THROW(EngiGraph::HeightField(2, 2, {0, 0, 0}), EngiGraph::RuntimeException);
+    ASSERT_THROW(EngiGraph::HeightField(2, 2, {0, 0, 0, 0}, {0, 1}), EngiGraph::RuntimeException);
+
+    //3 by 2 samples, 2 apart in x and 1 in z, centered on the origin
+    EngiGraph::HeightField field(3, 2, {0, 1, 2, 3, 4, 5}, {2, 1});
+    ASSERT_EQ(field.getSamplePosition(0, 0), Eigen::Vector3d(-2, 0, -0.5));
+    ASSERT_EQ(field.getSamplePosition(2, 1), Eigen::Vector3d(2, 5, 0.5));
+    ASSERT_EQ(field.getBounds().minimum, Eigen::Vector3d(-2, 0, -0.5));
+    ASSERT_EQ(field.getBounds().maximum, Eigen::Vector3d(2, 5, 0.5));
+    ASSERT_EQ(field.getBoundsMesh()->vertices.size(), 8u);
+    ASSERT_TRUE(field.getBoundsMesh()->triangle_indices.empty());
+    //Heights follow the triangles of each cell, and clamp outside the grid
+    ASSERT_NEAR(field.sampleHeight(-2, -0.5), 0.0, 1e-12);
+    ASSERT_NEAR(field.sampleHeight(-1, -0.5), 0.5, 1e-12);
+    ASSERT_NEAR(field.sampleHeight(1, 0), 3.0, 1e-12);
+    ASSERT_NEAR(field.sampleHeight(10, 10), 5.0, 1e-12);
+
+    EngiGraph::HeightField::CellRange cells;
+    ASSERT_TRUE(field.findCells({{0.5, 0, -0.1}, {1, 1, 0.1}}, cells));
+    ASSERT_EQ(cells.first_column, 1u);
+    ASSERT_EQ(cells.last_column, 1u);
+    ASSERT_FALSE(field.findCells({{0.5, 6, -0.1}, {1, 7, 0.1}}, cells));
+    ASSERT_FALSE(field.findCells({{3, 0, -0.1}, {4, 1, 0.1}}, cells));
+
+    const EngiGraph::Mesh patch = field.buildPatch(cells);
+    ASSERT_EQ(patch.vertices.size(), 4u);
+    ASSERT_EQ(patch.triangle_indices.size(), 6u);
+    ASSERT_EQ(patch.edge_indices.size(), 10u);
+    const EngiGraph::Mesh whole = field.triangulate();
+    ASSERT_EQ(whole.triangle_indices.size(), 12u);
+    ASSERT_EQ(whole.edge_indices.size(), 2u * 9);
+}
+
+TEST(INTERSECTION_TESTS, TEST_HEIGHT_FIELD_IMAGE){
+    auto& registry = EngiGraph::ColliderRegistry::getShared();
+    auto field = registry.loadHeightField("test_files/terrain.png");
+    ASSERT_EQ(field.get(), registry.loadHeightField("test_files/terrain.png").get());
+    ASSERT_THROW(registry.loadHeightField("test_files/missing.png"), EngiGraph::RuntimeException);
+    ASSERT_EQ(field->getColumns(), 16u);
+    ASSERT_EQ(field->getRows(), 16u);
+    //Red of 0.5 + 0.5 * sin(x / 2.5) * cos(y / 3)
+    ASSERT_NEAR(field->getSamplePosition(0, 0).y(), 128.0 / 255.0, 1e-6);
+    ASSERT_NEAR(field->getSamplePosition(4, 0).y(), std::round(255.0 * (0.5 + 0.5 * std::sin(4 / 2.5))) / 255.0, 1e-6);
+    ASSERT_NEAR(field->getSamplePosition(4, 9).y(), std::round(255.0 * (0.5 + 0.5 * std::sin(4 / 2.5) * std::cos(3.0))) / 255.0, 1e-6);
+
+    //Far smaller than the same grid as a mesh
+    const EngiGraph::Mesh mesh = field->triangulate();
+    const size_t mesh_bytes = mesh.vertices.size() * sizeof(Eigen::Vector3f) + (mesh.triangle_indices.size() + mesh.edge_indices.size()) * sizeof(uint32_t);
+    ASSERT_LT(field->getMemoryUsage() * 10, mesh_bytes);
+}
+
+TEST(INTERSECTION_TESTS, TEST_HEIGHT_FIELD_CCD){
+    auto& registry = EngiGraph::ColliderRegistry::getShared();
+    auto field = registry.loadHeightField("test_files/terrain.png");
+    auto triangulated = std::make_shared<const EngiGraph::Mesh>(field->triangulate());
+    //The same terrain as a height field and as a mesh, each hit by a falling box
+    for (bool use_height_field : {true, false}) {
+        EngiGraph::PhysicsWorld world;
+        EngiGraph::BodyDescription description{};
+        description.type = EngiGraph::BodyType::STATIC;
+        description.scale = {1, 2, 1};
+        if(use_height_field) description.height_field = field;
+        else description.collider = triangulated;
+        const uint32_t terrain = world.getIndex(world.createBody(description));
+        description = {};
+        description.collider = registry.getBox();
+        description.position = {0.3, 2.6, -0.4};
+        description.velocity = {0, -200, 0};
+        const uint32_t box = world.getIndex(world.createBody(description));
+        world.updateCurrentTransforms();
+        world.updateFutureTransforms(0.01);
+        EngiGraph::CollisionBounds bounds;
+        bounds.update(world);
+
+        auto hits = EngiGraph::collideBodies(world, bounds, box, terrain);
+        auto mesh_hits = EngiGraph::linearCCD(*registry.getBox(), *triangulated, world.current_transforms[box], world.current_transforms[terrain],
+                                              world.future_transforms[box], world.future_transforms[terrain]);
+        ASSERT_FALSE(hits.empty());
+        ASSERT_NEAR(hits[0].time, mesh_hits[0].time, 1e-9);
+        for (const auto& hit : hits) {
+            ASSERT_LT(hit.normal_a_to_b.y(), 0.0);
+        }
+        //Normals flip with the order of the bodies
+        auto reversed = EngiGraph::collideBodies(world, bounds, terrain, box);
+        ASSERT_NEAR(reversed[0].time, hits[0].time, 1e-9);
+        ASSERT_GT(reversed[0].normal_a_to_b.y(), 0.0);
+    }
+
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    description.height_field = field;
+    ASSERT_THROW(world.createBody(description), EngiGraph::RuntimeException);
+}
+
+TEST(SCENE_TESTS, TEST_TERRAIN_SCENE_AND_RECORDING){
+    auto scene = EngiGraph::parseScene("terrain test_files/terrain.png 1 2 1\nbox 1 1 1\nposition 0.3 3 -0.4\n");
+    ASSERT_EQ(scene.bodies[0].description.type, EngiGraph::BodyType::STATIC);
+    auto reparsed = EngiGraph::parseScene(EngiGraph::writeScene(scene));
+    ASSERT_EQ(reparsed.bodies[0].shape, EngiGraph::SceneShape::TERRAIN);
+    ASSERT_EQ(reparsed.bodies[0].scale, Eigen::Vector3d(1, 2, 1));
+
+    EngiGraph::VBDSolver solver;
+    solver.gravity = scene.gravity;
+    auto handles = EngiGraph::buildScene(scene, solver.world);
+    auto& world = solver.world;
+    const auto& field = world.height_fields[0];
+    ASSERT_NE(field, nullptr);
+    ASSERT_EQ(world.colliders[0], field->getBoundsMesh());
+
+    EngiGraph::SimulationRecorder recorder;
+    recorder.start(solver);
+    for (int j = 0; j < 100; ++j) {
+        recorder.step(solver, scene.delta_time);
+    }
+    //Resting on the terrain, not below the lowest sample under it
+    const Eigen::Vector3d position = world.getPosition(world.getIndex(handles[1]));
+    double lowest = 1e9;
+    for (double x : {-0.5, 0.5}) {
+        for (double z : {-0.5, 0.5}) {
+            lowest = std::min(lowest, 2.0 * field->sampleHeight(position.x() + x, position.z() + z));
+        }
+    }
+    ASSERT_GT(position.y(), lowest + 0.4);
+    ASSERT_LT(position.y(), 3.0);
+
+    EngiGraph::saveRecording(recorder.stop(), "terrain_test.egrec");
+    auto recording = EngiGraph::loadRecording("terrain_test.egrec");
+    std::remove("terrain_test.egrec");
+    ASSERT_EQ(recording.initial_world.height_fields[0]->getHeights(), field->getHeights());
+    ASSERT_EQ(recording.initial_world.height_fields[1], nullptr);
+    EngiGraph::VBDSolver replay_solver;
+    EngiGraph::SimulationReplay replay(recording);
+    replay.start(replay_solver);
+    while (!replay.isFinished()) {
+        replay.step(replay_solver);
+        ASSERT_TRUE(replay.verify(replay_solver.world));
+    }
+}
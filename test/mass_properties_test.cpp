@@ -0,0 +1,58 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Geometry/MassProperties.h"
+#include "src/Geometry/MeshUtilities.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+
+TEST(MASS_PROPERTIES_TESTS, TEST_SOLID_BOX){
+    auto box = EngiGraph::makeBoxMesh({2, 3, 4});
+    auto properties = EngiGraph::computeMassProperties(box, EngiGraph::MassModel::SOLID);
+    ASSERT_NEAR(properties.mass, 24.0, 1e-9);
+    ASSERT_NEAR(properties.center_of_mass.norm(), 0.0, 1e-9);
+    //m/12 * (b^2 + c^2)
+    Eigen::Matrix3d expected = Eigen::Vector3d{9 + 16, 4 + 16, 4 + 9}.asDiagonal();
+    expected *= 24.0 / 12.0;
+    ASSERT_TRUE(properties.getInertiaTensor().isApprox(expected, 1e-9));
+
+    //Scaling a unit box analytically gives the same result
+    auto unit = EngiGraph::computeMassProperties(EngiGraph::makeBoxMesh({1, 1, 1}), EngiGraph::MassModel::SOLID);
+    auto scaled = unit.scaled(EngiGraph::MassModel::SOLID, 1.0, {2, 3, 4});
+    ASSERT_NEAR(scaled.mass, 24.0, 1e-9);
+    ASSERT_TRUE(scaled.getInertiaTensor().isApprox(expected, 1e-9));
+    auto with_scale = EngiGraph::computeMassProperties(EngiGraph::makeBoxMesh({1, 1, 1}), EngiGraph::MassModel::SOLID, {2, 3, 4});
+    ASSERT_TRUE(with_scale.getInertiaTensor().isApprox(expected, 1e-9));
+}
+
+TEST(MASS_PROPERTIES_TESTS, TEST_SOLID_TORUS){
+    //A fine torus approaches the analytic volume 2 pi^2 R r^2 and axis inertia m (R^2 + 3/4 r^2)
+    const double major = 2.0, minor = 0.5;
+    auto torus = EngiGraph::makeTorusMesh((float)major, (float)minor, 256, 64);
+    auto properties = EngiGraph::computeMassProperties(torus, EngiGraph::MassModel::SOLID);
+    const double volume = 2.0 * M_PI * M_PI * major * minor * minor;
+    ASSERT_NEAR(properties.mass / volume, 1.0, 0.01);
+    ASSERT_NEAR(properties.getInertiaTensor()(1, 1) / (properties.mass * (major * major + 0.75 * minor * minor)), 1.0, 0.01);
+
+    //Large meshes are summed in parallel, in a fixed order
+    auto serial = EngiGraph::computeMassProperties(torus, EngiGraph::MassModel::SOLID, {1, 1, 1}, false);
+    ASSERT_EQ(properties.mass, serial.mass);
+    ASSERT_EQ(properties.second_moment, serial.second_moment);
+}
+
+TEST(MASS_PROPERTIES_TESTS, TEST_SHELL_AND_CACHE){
+    auto box = std::make_shared<const EngiGraph::Mesh>(EngiGraph::makeBoxMesh({1, 1, 1}));
+    EngiGraph::ColliderRegistry registry;
+    auto shell = registry.getMassProperties(box, EngiGraph::MassModel::SHELL, 0.5);
+    ASSERT_NEAR(shell.mass, 3.0, 1e-9);
+    ASSERT_NEAR(shell.getInertiaTensor()(0, 0), 5.0 / 18.0 * 3.0, 1e-9);
+
+    //Uniform scale comes from the cache, non-uniform shells are computed from the mesh
+    auto uniform = registry.getMassProperties(box, EngiGraph::MassModel::SHELL, 0.5, {2, 2, 2});
+    ASSERT_NEAR(uniform.mass, 12.0, 1e-9);
+    ASSERT_NEAR(uniform.getInertiaTensor()(0, 0), 5.0 / 18.0 * 12.0 * 4.0, 1e-9);
+    auto stretched = registry.getMassProperties(box, EngiGraph::MassModel::SHELL, 1.0, {1, 1, 2});
+    ASSERT_NEAR(stretched.mass, 2.0 + 4.0 * 2.0, 1e-9);
+    auto solid = registry.getMassProperties(box, EngiGraph::MassModel::SOLID, 3.0, {1, 1, 2});
+    ASSERT_NEAR(solid.mass, 6.0, 1e-9);
+}
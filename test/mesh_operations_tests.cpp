@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 #include "../src/Geometry/MeshUtilities.h"
 #include "../src/Geometry/MeshConversions.h"
+#include "../src/Exceptions/RuntimeException.h"
 TEST(UTILITY_TESTS, TEST_MESH_REDUCTION) {
     //two conjoined triangles
     std::vector<Eigen::Vector3f> original_vertices = {{0.0f,0.0f,0.0f},{1.0f,1.0f,1.0f},{1.0f,-1.0f,-1.0f},
@@ -67,4 +68,23 @@ TEST(UTILITY_TESTS, TEST_MESH_CONVERSION) {
     for (int j = 0; j < expected_vertices.size(); ++j) {
         ASSERT_EQ(expected_vertices[j], base_mesh.vertices[j]);
     }
-}
\ No newline at end of file
+}
+TEST(UTILITY_TESTS, TEST_TORUS_MESH) {
+    const uint32_t rings = 12, sides = 6;
+    auto torus = EngiGraph::makeTorusMesh(2.0f, 0.5f, rings, sides);
+    ASSERT_EQ(torus.vertices.size(), rings * sides);
+    ASSERT_EQ(torus.triangle_indices.size(), rings * sides * 6);
+    //Closed surface with one hole: V - E + F = 0
+    const int64_t euler = (int64_t)torus.vertices.size() - (int64_t)torus.edge_indices.size() / 2 + (int64_t)torus.triangle_indices.size() / 3;
+    ASSERT_EQ(euler, 0);
+    //Same edges reduceMesh would find
+    ASSERT_EQ(EngiGraph::reduceMesh(torus).edge_indices.size(), torus.edge_indices.size());
+    for (const auto& vertex : torus.vertices) {
+        Eigen::Vector2f ring_point{vertex.x(), vertex.z()};
+        ASSERT_NEAR(Eigen::Vector2f(ring_point.norm() - 2.0f, vertex.y()).norm(), 0.5f, 1e-5);
+    }
+    //Faces point outwards
+    Eigen::Vector3f a = torus.vertices[torus.triangle_indices[0]], b = torus.vertices[torus.triangle_indices[1]], c = torus.vertices[torus.triangle_indices[2]];
+    ASSERT_GT((b - a).cross(c - a).x(), 0.0f);
+    EXPECT_THROW(EngiGraph::makeTorusMesh(1.0f, 0.5f, 2, 8), EngiGraph::RuntimeException);
+}
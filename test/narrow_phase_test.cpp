@@ -0,0 +1,94 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/Collisions/NarrowPhase.h"
+#include "src/Physics/TOISolver/ToiSolver.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Scenes/SceneDescription.h"
+#include "src/Scenes/SceneGenerator.h"
+
+/**
+ * Run a scene and hash the world after every step.
+ * @param threads Worker threads, or 0 to run everything on the calling thread.
+ */
+template<typename Solver> static std::vector<uint64_t> hashSteps(Solver& solver, const EngiGraph::SceneDescription& scene, uint32_t threads) {
+    solver.gravity = scene.gravity;
+    if(threads == 0){
+        solver.narrow_phase.parallel = false;
+        solver.contact_solver.settings.parallel = false;
+    }else{
+        solver.setThreadCount(threads);
+    }
+    EngiGraph::buildScene(scene, solver.world);
+    std::vector<uint64_t> hashes;
+    for (uint32_t step = 0; step < scene.steps; ++step) {
+        solver.step(scene.delta_time);
+        hashes.push_back(solver.world.hashState());
+    }
+    return hashes;
+}
+
+TEST(INTERSECTION_TESTS, TEST_NARROW_PHASE){
+    auto scene = EngiGraph::generateStressScene(EngiGraph::StressScene::BOX_STACKS, 60, 5);
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::buildScene(scene, world);
+    for (uint32_t body = 0; body < world.getBodyCount(); ++body) {
+        world.setVelocity(body, {0, -30, 0});
+    }
+    world.updateCurrentTransforms();
+    world.updateFutureTransforms(scene.delta_time);
+    EngiGraph::CollisionBounds bounds;
+    bounds.update(world);
+
+    std::vector<EngiGraph::BodyPair> pairs;
+    for (uint32_t a = 0; a < world.getBodyCount(); ++a) {
+        for (uint32_t b = a + 1; b < world.getBodyCount(); ++b) {
+            if(world.canPairCollide(a, b) && bounds.overlaps(a, b)) pairs.push_back({a, b});
+        }
+    }
+    ASSERT_GT(pairs.size(), (size_t)EngiGraph::NarrowPhase::PAIRS_PER_TASK);
+    EngiGraph::NarrowPhase narrow_phase;
+    narrow_phase.setExecutor(std::make_shared<tf::Executor>(3));
+    auto hits = narrow_phase.collide(world, bounds, pairs);
+    ASSERT_EQ(hits.size(), pairs.size());
+    size_t hit_count = 0;
+    for (size_t pair = 0; pair < pairs.size(); ++pair) {
+        auto expected = EngiGraph::collideBodies(world, bounds, pairs[pair].body_a, pairs[pair].body_b);
+        ASSERT_EQ(hits[pair].size(), expected.size());
+        for (size_t hit = 0; hit < expected.size(); ++hit) {
+            ASSERT_EQ(hits[pair][hit].time, expected[hit].time);
+            ASSERT_EQ(hits[pair][hit].global_point, expected[hit].global_point);
+            ASSERT_EQ(hits[pair][hit].normal_a_to_b, expected[hit].normal_a_to_b);
+        }
+        hit_count += expected.size();
+    }
+    ASSERT_GT(hit_count, 0u);
+    ASSERT_TRUE(narrow_phase.collide(world, bounds, {}).empty());
+}
+
+TEST(INTERSECTION_TESTS, TEST_DETERMINISTIC_THREAD_COUNT){
+    auto scene = EngiGraph::generateStressScene(EngiGraph::StressScene::BOX_STACKS, 40, 2);
+    scene.steps = 60;
+    for (auto solver_type : {EngiGraph::SceneSolver::VBD, EngiGraph::SceneSolver::TOI, EngiGraph::SceneSolver::TOI_SPECULATIVE}) {
+        std::vector<uint64_t> serial;
+        for (uint32_t threads : {0u, 1u, 2u, 4u}) {
+            std::vector<uint64_t> hashes;
+            if(solver_type == EngiGraph::SceneSolver::VBD){
+                EngiGraph::VBDSolver solver;
+                hashes = hashSteps(solver, scene, threads);
+            }else{
+                EngiGraph::TOISolver solver;
+                if(solver_type == EngiGraph::SceneSolver::TOI_SPECULATIVE) solver.integration_mode = EngiGraph::TOISolver::IntegrationMode::SPECULATIVE;
+                hashes = hashSteps(solver, scene, threads);
+            }
+            if(threads == 0){
+                serial = hashes;
+                continue;
+            }
+            for (size_t step = 0; step < serial.size(); ++step) {
+                ASSERT_EQ(hashes[step], serial[step]) << "Solver " << (int)solver_type << ", " << threads << " threads, step " << step;
+            }
+        }
+    }
+}
@@ -0,0 +1,109 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/Threading/PhysicsThread.h"
+
+TEST(PHYSICS_TESTS, TEST_TRIPLE_BUFFER){
+    EngiGraph::TripleBuffer<int> buffer;
+    ASSERT_FALSE(buffer.consume());
+    buffer.getWriteBuffer() = 1;
+    buffer.publish();
+    buffer.getWriteBuffer() = 2;
+    buffer.publish();
+    //Only the newest value is seen
+    ASSERT_TRUE(buffer.consume());
+    ASSERT_EQ(buffer.getReadBuffer(), 2);
+    ASSERT_FALSE(buffer.consume());
+    ASSERT_EQ(buffer.getReadBuffer(), 2);
+    //Producer writes never touch the buffer being read
+    buffer.getWriteBuffer() = 3;
+    ASSERT_EQ(buffer.getReadBuffer(), 2);
+    buffer.publish();
+    ASSERT_TRUE(buffer.consume());
+    ASSERT_EQ(buffer.getReadBuffer(), 3);
+}
+
+TEST(PHYSICS_TESTS, TEST_SNAPSHOT_INTERPOLATION){
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    auto first = world.createBody(description);
+    description.position = {5, 0, 0};
+    auto second = world.createBody(description);
+    world.updateCurrentTransforms();
+
+    EngiGraph::TransformSnapshot previous;
+    previous.capture(world);
+    world.setPosition(world.getIndex(first), {2, 0, 0});
+    world.setRotation(world.getIndex(first), Eigen::Quaterniond(Eigen::AngleAxisd(M_PI / 2.0, Eigen::Vector3d::UnitZ())));
+    world.destroyBody(second);
+    auto third = world.createBody(description);
+    EngiGraph::TransformSnapshot current;
+    current.capture(world);
+
+    ASSERT_EQ(current.find(second), EngiGraph::TransformSnapshot::NOT_FOUND);
+    uint32_t first_index = current.find(first);
+    Eigen::Matrix4d halfway = current.getInterpolatedTransform(previous, first_index, 0.5);
+    ASSERT_TRUE(halfway.col(3).head<3>().isApprox(Eigen::Vector3d{1, 0, 0}));
+    Eigen::Matrix3d expected_rotation = Eigen::AngleAxisd(M_PI / 4.0, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+    Eigen::Matrix3d halfway_rotation = halfway.topLeftCorner(3, 3);
+    ASSERT_TRUE(halfway_rotation.isApprox(expected_rotation));
+    //New bodies are drawn where they are, not blended from whatever used their slot before
+    Eigen::Matrix4d new_body = current.getInterpolatedTransform(previous, current.find(third), 0.5);
+    ASSERT_TRUE(new_body.col(3).head<3>().isApprox(Eigen::Vector3d{5, 0, 0}));
+}
+
+TEST(PHYSICS_TESTS, TEST_PHYSICS_THREAD_STEPS){
+    EngiGraph::PhysicsWorld world;
+    world.createBody({});
+    int steps_taken = 0;
+    EngiGraph::PhysicsThread physics([&](double delta_time){
+        world.setPosition(0, world.getPosition(0) + Eigen::Vector3d{delta_time, 0, 0});
+        steps_taken++;
+    }, world, 0.5);
+
+    //Never runs on its own while stopped
+    physics.requestStep();
+    physics.requestStep();
+    while (physics.getStepCount() < 2) std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_EQ(physics.getStepCount(), 2u);
+
+    //Wait for the snapshot of the second step
+    while (!physics.updateSnapshots() || physics.getSnapshot().step < 2) std::this_thread::yield();
+    ASSERT_NEAR(physics.getSnapshot().positions[0].x(), 1.0, 1e-12);
+
+    int edited_steps = physics.edit([&](){ world.setPosition(0, {-1, 0, 0}); return steps_taken; });
+    ASSERT_EQ(edited_steps, 2);
+    while (!physics.updateSnapshots()) std::this_thread::yield();
+    ASSERT_NEAR(physics.getSnapshot().positions[0].x(), -1.0, 1e-12);
+    //Edits are not blended
+    ASSERT_EQ(physics.getPreviousSnapshot().positions[0].x(), -1.0);
+}
+
+TEST(PHYSICS_TESTS, TEST_PHYSICS_THREAD_PROFILES){
+    EngiGraph::PhysicsWorld world;
+    world.createBody({});
+    EngiGraph::StepProfile profile{};
+    EngiGraph::PhysicsThread physics([&](double){ profile.contacts++; }, world, 0.5, &profile);
+
+    //Each step is published on its own, none are read in between
+    for (uint32_t step = 1; step <= 3; ++step) {
+        physics.requestStep();
+        while (physics.getStepCount() < step) std::this_thread::yield();
+    }
+    //Profiles of the replaced snapshots are not lost
+    std::vector<EngiGraph::StepProfile> step_profiles;
+    while (physics.getSnapshot().step < 3) {
+        if(!physics.updateSnapshots()){
+            std::this_thread::yield();
+            continue;
+        }
+        const auto& snapshot_profiles = physics.getSnapshot().step_profiles;
+        step_profiles.insert(step_profiles.end(), snapshot_profiles.begin(), snapshot_profiles.end());
+    }
+    ASSERT_EQ(step_profiles.size(), 3u);
+    for (uint32_t step = 0; step < 3; ++step) {
+        ASSERT_EQ(step_profiles[step].contacts, step + 1);
+    }
+}
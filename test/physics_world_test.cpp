@@ -0,0 +1,89 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/World/PhysicsWorld.h"
+#include "src/Exceptions/RuntimeException.h"
+
+TEST(PHYSICS_TESTS, TEST_WORLD_HANDLES){
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    description.position = {1,0,0};
+    auto body_a = world.createBody(description);
+    description.position = {2,0,0};
+    auto body_b = world.createBody(description);
+    description.position = {3,0,0};
+    auto body_c = world.createBody(description);
+
+    //Removing a body moves another one into its place, but handles still find the right body.
+    world.destroyBody(body_a);
+    ASSERT_EQ(world.getBodyCount(), 2);
+    ASSERT_FALSE(world.isValid(body_a));
+    ASSERT_EQ(world.getPosition(world.getIndex(body_b)).x(), 2.0);
+    ASSERT_EQ(world.getPosition(world.getIndex(body_c)).x(), 3.0);
+    ASSERT_EQ(world.getHandle(world.getIndex(body_c)), body_c);
+
+    //The freed slot is reused, but the old handle stays invalid.
+    auto body_d = world.createBody(description);
+    ASSERT_EQ(body_d.slot, body_a.slot);
+    ASSERT_NE(body_d, body_a);
+    ASSERT_THROW((void)world.getIndex(body_a), EngiGraph::RuntimeException);
+}
+
+TEST(PHYSICS_TESTS, TEST_WORLD_INTEGRATION){
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    description.position = {1,2,3};
+    description.velocity = {1,0,0};
+    description.angular_velocity = {0.3,-1.0,2.0};
+    description.rotation = Eigen::Quaterniond(Eigen::AngleAxisd(0.5, Eigen::Vector3d{1,1,0}.normalized()));
+    auto body = world.createBody(description);
+    uint32_t index = world.getIndex(body);
+
+    const double delta_time = 0.01;
+    world.integrateForces(delta_time, {0,-10,0});
+    ASSERT_DOUBLE_EQ(world.getVelocity(index).y(), -0.1);
+
+    //Predicted transform must match the reference quaternion update
+    Eigen::Quaterniond rotation = description.rotation;
+    Eigen::Quaterniond expected_rotation = Eigen::Quaterniond(0, delta_time * 0.5 * 0.3, delta_time * 0.5 * -1.0, delta_time * 0.5 * 2.0) * rotation;
+    expected_rotation.coeffs() += rotation.coeffs();
+    expected_rotation.normalize();
+    Eigen::Transform<double,3,Eigen::Affine> expected = Eigen::Transform<double,3,Eigen::Affine>::Identity();
+    expected.translate(Eigen::Vector3d{1.01,2.0-0.001,3.0}).rotate(expected_rotation);
+
+    world.updateFutureTransforms(delta_time);
+    ASSERT_TRUE(world.future_transforms[index].isApprox(expected.matrix()));
+
+    world.integratePositions(delta_time);
+    world.updateCurrentTransforms();
+    ASSERT_TRUE(world.current_transforms[index].isApprox(expected.matrix()));
+    ASSERT_TRUE(world.getRotation(index).isApprox(expected_rotation));
+
+    //Sleeping bodies do not move
+    world.sleepBody(index);
+    world.integratePositions(delta_time);
+    ASSERT_TRUE(world.getTransform(index).isApprox(expected.matrix()));
+}
+
+TEST(PHYSICS_TESTS, TEST_WORLD_HASH_AND_HANDLE_TABLE){
+    EngiGraph::PhysicsWorld world;
+    auto body_a = world.createBody({});
+    world.createBody({});
+    world.destroyBody(body_a);
+    const uint64_t hash = world.hashState();
+
+    EngiGraph::PhysicsWorld copy = world;
+    ASSERT_EQ(copy.hashState(), hash);
+    copy.setVelocity(0, {0, 0, 1e-300});
+    ASSERT_NE(copy.hashState(), hash);
+
+    //A rebuilt world with the saved handle table hands out the same handles
+    EngiGraph::PhysicsWorld rebuilt;
+    rebuilt.createBody({});
+    rebuilt.states = world.states;
+    rebuilt.setHandleTable(world.getHandleTable());
+    ASSERT_EQ(rebuilt.hashState(), hash);
+    ASSERT_EQ(rebuilt.createBody({}), world.createBody({}));
+    ASSERT_THROW(rebuilt.setHandleTable({}), EngiGraph::RuntimeException);
+}
@@ -0,0 +1,52 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Scenes/SceneDescription.h"
+#include "src/Exceptions/RuntimeException.h"
+
+TEST(SCENE_TESTS, TEST_PARSE_SCENE){
+    auto scene = EngiGraph::parseScene(
+            "solver speculative # comment\n"
+            "delta_time 0.02\n"
+            "steps 30\n"
+            "gravity 0 0 -1\n"
+            "\n"
+            "box 4 0.5 4\n"
+            "static\n"
+            "box 1 2 3\n"
+            "position 0 5 0\n"
+            "velocity 1 0 0\n"
+            "mass 2\n");
+    ASSERT_EQ(scene.solver, EngiGraph::SceneSolver::TOI_SPECULATIVE);
+    ASSERT_EQ(scene.delta_time, 0.02);
+    ASSERT_EQ(scene.steps, 30u);
+    ASSERT_EQ(scene.gravity, Eigen::Vector3d(0, 0, -1));
+    ASSERT_EQ(scene.bodies.size(), 2u);
+    ASSERT_EQ(scene.bodies[0].description.mass, 0.0);
+    ASSERT_FALSE(scene.bodies[0].description.gravity);
+    ASSERT_EQ(scene.bodies[1].scale, Eigen::Vector3d(1, 2, 3));
+    ASSERT_EQ(scene.bodies[1].description.position, Eigen::Vector3d(0, 5, 0));
+
+    EXPECT_THROW(EngiGraph::parseScene("position 0 0 0\n"), EngiGraph::RuntimeException);
+    EXPECT_THROW(EngiGraph::parseScene("box 1 1\n"), EngiGraph::RuntimeException);
+    EXPECT_THROW(EngiGraph::parseScene("box 1 1 1\nspin 3\n"), EngiGraph::RuntimeException);
+}
+
+TEST(SCENE_TESTS, TEST_BUILD_SCENE){
+    auto scene = EngiGraph::parseScene("box 1 2 3\nbox 1 2 3\nmass 12\nbox 1 1 1\nstatic\n");
+    EngiGraph::PhysicsWorld world;
+    auto handles = EngiGraph::buildScene(scene, world);
+    ASSERT_EQ(world.getBodyCount(), 3u);
+    //All boxes share a collider, sized by their scale
+    ASSERT_EQ(world.colliders[0], world.colliders[1]);
+    ASSERT_EQ(world.colliders[0], world.colliders[2]);
+    ASSERT_EQ(world.getScale(0), Eigen::Vector3d(1, 2, 3));
+    ASSERT_EQ(world.getScale(2), Eigen::Vector3d(1, 1, 1));
+    ASSERT_EQ(world.colliders[0]->vertices.size(), 8u);
+    ASSERT_EQ(world.colliders[0]->triangle_indices.size(), 36u);
+    ASSERT_EQ(world.colliders[0]->edge_indices.size(), 36u);
+    //Solid box inertia: m/12 * (y^2 + z^2) = 12/12 * 13
+    ASSERT_NEAR(1.0 / world.states.inverse_inertia_xx[world.getIndex(handles[1])], 13.0, 1e-9);
+    ASSERT_EQ(world.states.inverse_mass[world.getIndex(handles[2])], 0.0);
+}
@@ -0,0 +1,88 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Scenes/SceneGenerator.h"
+#include "src/Exceptions/RuntimeException.h"
+
+static const EngiGraph::StressScene all_scenes[] = {EngiGraph::StressScene::BOX_STACKS, EngiGraph::StressScene::RANDOM_PILE,
+                                                    EngiGraph::StressScene::DOMINOES, EngiGraph::StressScene::TORUS_CHAINS,
+                                                    EngiGraph::StressScene::PROJECTILES};
+
+TEST(SCENE_GENERATOR_TESTS, TEST_DETERMINISTIC){
+    for (auto type : all_scenes) {
+        auto a = EngiGraph::writeScene(EngiGraph::generateStressScene(type, 57, 3));
+        auto b = EngiGraph::writeScene(EngiGraph::generateStressScene(type, 57, 3));
+        auto c = EngiGraph::writeScene(EngiGraph::generateStressScene(type, 57, 4));
+        ASSERT_EQ(a, b);
+        if(type == EngiGraph::StressScene::RANDOM_PILE){
+            ASSERT_NE(a, c);
+        }
+    }
+}
+
+TEST(SCENE_GENERATOR_TESTS, TEST_BODY_COUNT){
+    for (auto type : all_scenes) {
+        for (uint32_t count : {2u, 11u, 100u, 1234u}) {
+            ASSERT_EQ(EngiGraph::generateStressScene(type, count).bodies.size(), count) << EngiGraph::getStressSceneName(type);
+        }
+        ASSERT_EQ(EngiGraph::parseStressSceneName(EngiGraph::getStressSceneName(type)), type);
+    }
+    EXPECT_THROW(EngiGraph::generateStressScene(EngiGraph::StressScene::DOMINOES, 1), EngiGraph::RuntimeException);
+    EXPECT_THROW(EngiGraph::parseStressSceneName("jenga"), EngiGraph::RuntimeException);
+}
+
+TEST(SCENE_GENERATOR_TESTS, TEST_NO_INITIAL_OVERLAP){
+    //Bounding spheres of dynamic boxes must not touch. Tori of a chain interlock on purpose, so only boxes are checked.
+    for (auto type : {EngiGraph::StressScene::BOX_STACKS, EngiGraph::StressScene::RANDOM_PILE, EngiGraph::StressScene::DOMINOES}) {
+        auto scene = EngiGraph::generateStressScene(type, 300, 9);
+        for (size_t a = 0; a < scene.bodies.size(); ++a) {
+            const auto& body_a = scene.bodies[a];
+            if(body_a.description.mass == 0.0) continue;
+            for (size_t b = a + 1; b < scene.bodies.size(); ++b) {
+                const auto& body_b = scene.bodies[b];
+                if(body_b.description.mass == 0.0) continue;
+                double distance = (body_a.description.position - body_b.description.position).norm();
+                //Stacked and domino boxes are axis aligned, so compare along each axis instead
+                Eigen::Vector3d gap = (body_a.description.position - body_b.description.position).cwiseAbs() - 0.5 * (body_a.scale + body_b.scale);
+                if(type == EngiGraph::StressScene::RANDOM_PILE){
+                    ASSERT_GT(distance, 0.5 * (body_a.scale.norm() + body_b.scale.norm()));
+                }else{
+                    ASSERT_GT(gap.maxCoeff(), 0.0);
+                }
+            }
+        }
+    }
+}
+
+TEST(SCENE_GENERATOR_TESTS, TEST_WRITE_SCENE_ROUND_TRIP){
+    for (auto type : all_scenes) {
+        auto scene = EngiGraph::generateStressScene(type, 40, 5);
+        auto parsed = EngiGraph::parseScene(EngiGraph::writeScene(scene));
+        ASSERT_EQ(parsed.delta_time, scene.delta_time);
+        ASSERT_EQ(parsed.bodies.size(), scene.bodies.size());
+        for (size_t i = 0; i < scene.bodies.size(); ++i) {
+            const auto& original = scene.bodies[i];
+            const auto& loaded = parsed.bodies[i];
+            ASSERT_EQ(loaded.shape, original.shape);
+            ASSERT_EQ(loaded.scale, original.scale);
+            ASSERT_EQ(loaded.description.position, original.description.position);
+            ASSERT_EQ(loaded.description.velocity, original.description.velocity);
+            ASSERT_EQ(loaded.description.mass, original.description.mass);
+            //Rotations go through axis-angle in degrees, so only match up to rounding and sign
+            ASSERT_LT(loaded.description.rotation.angularDistance(original.description.rotation), 1e-9);
+        }
+    }
+}
+
+TEST(SCENE_GENERATOR_TESTS, TEST_BUILD_TORUS){
+    auto scene = EngiGraph::parseScene("torus 1 0.25\ntorus 1 0.25\nposition 3 0 0\n");
+    ASSERT_EQ(scene.bodies[0].shape, EngiGraph::SceneShape::TORUS);
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::buildScene(scene, world);
+    ASSERT_EQ(world.colliders[0], world.colliders[1]);
+    float max_x = 0.0f;
+    for (const auto& vertex : world.colliders[0]->vertices) max_x = std::max(max_x, vertex.x());
+    ASSERT_NEAR(max_x, 1.25f, 1e-5f);
+    EXPECT_THROW(EngiGraph::parseScene("torus 1\n"), EngiGraph::RuntimeException);
+}
@@ -0,0 +1,188 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/Queries/SceneQuery.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Exceptions/RuntimeException.h"
+
+/**
+ * Ground slab with its top at y = 0.5, a box at height 3, a box on layer 2 at x = 5, and a compound of two cubes at z = 10.
+ */
+static std::vector<EngiGraph::BodyHandle> buildQueryWorld(EngiGraph::PhysicsWorld& world) {
+    auto& registry = EngiGraph::ColliderRegistry::getShared();
+    EngiGraph::BodyDescription description{};
+    description.collider = registry.getBox();
+    description.type = EngiGraph::BodyType::STATIC;
+    description.scale = {20,1,40};
+    std::vector<EngiGraph::BodyHandle> handles;
+    handles.push_back(world.createBody(description));
+    description.type = EngiGraph::BodyType::DYNAMIC;
+    description.scale = {1,1,1};
+    description.position = {0,3,0};
+    handles.push_back(world.createBody(description));
+    description.position = {5,3,0};
+    description.collision_layer = 2;
+    handles.push_back(world.createBody(description));
+    description.collision_layer = 1;
+    description.compound = registry.loadCompound("test_files/two_cubes.obj");
+    description.collider = description.compound->getMergedMesh();
+    description.position = {0,3,10};
+    handles.push_back(world.createBody(description));
+    return handles;
+}
+
+TEST(PHYSICS_TESTS, TEST_SCENE_RAYCAST){
+    EngiGraph::PhysicsWorld world;
+    auto handles = buildQueryWorld(world);
+    EngiGraph::SceneQuery query;
+    query.update(world);
+    ASSERT_EQ(query.getPieceCount(), 5u);
+
+    EngiGraph::RayQuery ray{};
+    ray.origin = {0.1,10,0.3};
+    ray.direction = {0,-2,0};
+    auto hits = query.raycast(ray);
+    ASSERT_EQ(hits.size(), 1u);
+    ASSERT_EQ(hits[0].body, handles[1]);
+    ASSERT_NEAR(hits[0].time, 6.5, 1e-9);
+    ASSERT_TRUE(hits[0].global_point.isApprox(Eigen::Vector3d(0.1,3.5,0.3), 1e-9));
+    ASSERT_TRUE(hits[0].normal.isApprox(Eigen::Vector3d(0,1,0), 1e-9));
+
+    //Every surface crossed, through the box and then the scaled ground
+    ray.mode = EngiGraph::RaycastMode::ALL;
+    hits = query.raycast(ray);
+    ASSERT_EQ(hits.size(), 4u);
+    ASSERT_NEAR(hits[1].time, 7.5, 1e-9);
+    ASSERT_TRUE(hits[1].normal.isApprox(Eigen::Vector3d(0,1,0), 1e-9));
+    ASSERT_NEAR(hits[2].time, 9.5, 1e-9);
+    ASSERT_EQ(hits[3].body, handles[0]);
+    ray.mode = EngiGraph::RaycastMode::ANY;
+    ASSERT_EQ(query.raycast(ray).size(), 1u);
+    ray.max_distance = 6.0;
+    ASSERT_TRUE(query.raycast(ray).empty());
+
+    //Layers, and compound children with a gap between them
+    ray = {};
+    ray.origin = {5.1,10,0.3};
+    ray.direction = {0,-1,0};
+    ray.collision_mask = 0b01;
+    ASSERT_EQ(query.raycast(ray)[0].body, handles[0]);
+    ray.collision_mask = 0b10;
+    ASSERT_EQ(query.raycast(ray)[0].body, handles[2]);
+    ray = {};
+    ray.origin = {0.1,10,10.3};
+    ray.direction = {0,-1,0};
+    ASSERT_EQ(query.raycast(ray)[0].body, handles[0]);
+    ray.origin = {1.6,10,10.3};
+    ASSERT_EQ(query.raycast(ray)[0].body, handles[3]);
+
+    ray.direction = {0,0,0};
+    ASSERT_THROW((void)query.raycast(ray), EngiGraph::RuntimeException);
+}
+
+TEST(PHYSICS_TESTS, TEST_SCENE_OVERLAPS){
+    EngiGraph::PhysicsWorld world;
+    auto handles = buildQueryWorld(world);
+    EngiGraph::SceneQuery query;
+    query.update(world);
+
+    //Inside a body without touching its surface
+    ASSERT_EQ(query.overlapSphere({0,3,0}, 0.1), std::vector<EngiGraph::BodyHandle>{handles[1]});
+    ASSERT_EQ(query.overlapBox({{-0.1,-0.1,-0.1}, {0.1,0.1,0.1}}), std::vector<EngiGraph::BodyHandle>{handles[0]});
+    //Near the corner of a box, where the bounds touch but the sphere does not
+    ASSERT_TRUE(query.overlapSphere({0.9,3.9,0.9}, 0.6).empty());
+    ASSERT_EQ(query.overlapSphere({0,4.2,0}, 0.8), std::vector<EngiGraph::BodyHandle>{handles[1]});
+    ASSERT_TRUE(query.overlapSphere({0,3,10}, 0.5).empty());
+    ASSERT_EQ(query.overlapBox({{-1.6,2,9}, {-1.4,4,11}}), std::vector<EngiGraph::BodyHandle>{handles[3]});
+
+    ASSERT_EQ(query.overlapBox({{-10,0,-1}, {10,4,11}}), handles);
+    ASSERT_EQ(query.overlapBox({{-10,0,-1}, {10,4,11}}, 0b10), std::vector<EngiGraph::BodyHandle>{handles[2]});
+}
+
+TEST(PHYSICS_TESTS, TEST_SCENE_SWEEP){
+    EngiGraph::PhysicsWorld world;
+    auto handles = buildQueryWorld(world);
+    EngiGraph::SceneQuery query;
+    query.update(world);
+
+    EngiGraph::SweepQuery sweep{};
+    sweep.shape = EngiGraph::ColliderRegistry::getShared().getBox();
+    Eigen::Affine3d transform = Eigen::Affine3d::Identity();
+    transform.translate(Eigen::Vector3d{0.2,6,0.1});
+    transform.scale(0.2);
+    sweep.initial = transform.matrix();
+    transform.pretranslate(Eigen::Vector3d{0,-4,0});
+    sweep.final = transform.matrix();
+    auto hits = query.sweep(sweep);
+    ASSERT_FALSE(hits.empty());
+    ASSERT_EQ(hits[0].body, handles[1]);
+    ASSERT_NEAR(hits[0].time, 0.6, 1e-6);
+    ASSERT_NEAR(hits[0].global_point.y(), 3.5, 1e-6);
+
+    //Nothing in the way on the other layer
+    sweep.collision_mask = 0b10;
+    ASSERT_TRUE(query.sweep(sweep).empty());
+    sweep.shape = nullptr;
+    ASSERT_THROW((void)query.sweep(sweep), EngiGraph::RuntimeException);
+}
+
+TEST(PHYSICS_TESTS, TEST_SCENE_QUERY_BATCHES){
+    EngiGraph::PhysicsWorld world;
+    buildQueryWorld(world);
+    EngiGraph::SceneQuery query;
+    query.update(world);
+
+    std::vector<EngiGraph::RayQuery> rays;
+    std::vector<EngiGraph::OverlapQuery> overlaps;
+    for (int i = 0; i < 64; ++i) {
+        EngiGraph::RayQuery ray{};
+        ray.origin = {-6.0 + 0.2 * i, 10, 0.13 * i};
+        ray.direction = {0.01 * i,-1,0};
+        ray.mode = i % 2 ? EngiGraph::RaycastMode::ALL : EngiGraph::RaycastMode::CLOSEST;
+        rays.push_back(ray);
+        EngiGraph::OverlapQuery overlap{};
+        overlap.shape = i % 2 ? EngiGraph::OverlapShape::SPHERE : EngiGraph::OverlapShape::BOX;
+        overlap.center = ray.origin - Eigen::Vector3d{0, 7, 0};
+        overlap.radius = 0.5;
+        overlap.box = {overlap.center, overlap.center + Eigen::Vector3d::Constant(0.5)};
+        overlaps.push_back(overlap);
+    }
+    auto parallel_hits = query.raycast(rays);
+    auto parallel_overlaps = query.overlap(overlaps);
+    query.parallel = false;
+    ASSERT_EQ(query.overlap(overlaps), parallel_overlaps);
+    auto serial_hits = query.raycast(rays);
+    for (size_t i = 0; i < rays.size(); ++i) {
+        ASSERT_EQ(parallel_hits[i].size(), serial_hits[i].size());
+        for (size_t j = 0; j < serial_hits[i].size(); ++j) {
+            ASSERT_EQ(parallel_hits[i][j].time, serial_hits[i][j].time);
+            ASSERT_EQ(parallel_hits[i][j].body, serial_hits[i][j].body);
+        }
+    }
+    rays[3].direction = {0,0,0};
+    ASSERT_THROW(query.raycast(rays), EngiGraph::RuntimeException);
+}
+
+TEST(PHYSICS_TESTS, TEST_SCENE_QUERY_UPDATE){
+    EngiGraph::PhysicsWorld world;
+    auto handles = buildQueryWorld(world);
+    auto& registry = EngiGraph::ColliderRegistry::getShared();
+    auto box = registry.getBox();
+    ASSERT_EQ(registry.getTriangleHierarchy(box).get(), registry.getTriangleHierarchy(box).get());
+    ASSERT_EQ(registry.getTriangleHierarchy(box)->getItemCount(), box->triangle_indices.size() / 3);
+
+    //Queries see the state at update, even without updated current transforms
+    EngiGraph::SceneQuery query;
+    query.update(world);
+    world.setPosition(world.getIndex(handles[1]), {0,6,0});
+    EngiGraph::RayQuery ray{};
+    ray.origin = {0.1,10,0.3};
+    ray.direction = {0,-1,0};
+    ASSERT_NEAR(query.raycast(ray)[0].time, 6.5, 1e-9);
+    query.update(world);
+    ASSERT_NEAR(query.raycast(ray)[0].time, 3.5, 1e-9);
+    world.destroyBody(handles[1]);
+    query.update(world);
+    ASSERT_EQ(query.raycast(ray)[0].body, handles[0]);
+}
@@ -0,0 +1,199 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include <cstdio>
+#include "src/Physics/Collisions/BodyCollision.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Scenes/SceneDescription.h"
+#include "src/Scenes/SimulationRecording.h"
+#include "src/Exceptions/RuntimeException.h"
+
+/**
+ * Exact signed distance to the unit box.
+ */
+static double boxDistance(const Eigen::Vector3d& point) {
+    const Eigen::Vector3d q = point.cwiseAbs() - Eigen::Vector3d::Constant(0.5);
+    return q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+}
+
+TEST(INTERSECTION_TESTS, TEST_SIGNED_DISTANCE_FIELD){
+    auto box = EngiGraph::ColliderRegistry::getShared().getBox();
+    ASSERT_THROW(EngiGraph::SignedDistanceField::bake(EngiGraph::Mesh{}, 0.1), EngiGraph::RuntimeException);
+    ASSERT_THROW(EngiGraph::SignedDistanceField::bake(*box, 0.0), EngiGraph::RuntimeException);
+    ASSERT_THROW(EngiGraph::SignedDistanceField::bake(*box, 0.1, 0), EngiGraph::RuntimeException);
+    ASSERT_THROW(EngiGraph::SignedDistanceField({0,0,0}, 0.1, 0.3, {1,1,1}, {0}, {}), EngiGraph::RuntimeException);
+
+    const double cell = 0.02;
+    auto field = EngiGraph::SignedDistanceField::bake(*box, cell);
+    ASSERT_DOUBLE_EQ(field->getBand(), 3 * cell);
+    for (double x = -0.57; x <= 0.57; x += 0.017) {
+        for (double y = -0.57; y <= 0.57; y += 0.019) {
+            for (double z = -0.3; z <= 0.3; z += 0.29) {
+                const Eigen::Vector3d point = {x, y, z};
+                const double exact = boxDistance(point);
+                const double distance = field->getDistance(point);
+                if(std::abs(exact) < field->getBand() - cell){
+                    ASSERT_NEAR(distance, exact, 0.5 * cell);
+                }else if(std::abs(exact) > field->getBand() + 2 * cell){
+                    //Clamped far from the surface
+                    ASSERT_FLOAT_EQ(distance, exact > 0 ? field->getBand() : -field->getBand());
+                }
+            }
+        }
+    }
+    Eigen::Vector3d gradient;
+    ASSERT_NEAR(field->getDistance({0.13, 0.53, -0.2}, gradient), 0.03, 1e-6);
+    ASSERT_TRUE(gradient.isApprox(Eigen::Vector3d(0, 1, 0), 1e-4));
+    ASSERT_NEAR(field->getDistance({-0.13, 0.2, -0.48}, gradient), -0.02, 1e-6);
+    ASSERT_TRUE(gradient.isApprox(Eigen::Vector3d(0, 0, -1), 1e-4));
+    //Outside the grid, never more than the true distance
+    ASSERT_LE(field->getDistance({10, 0, 0}, gradient), 9.5);
+    ASSERT_GT(field->getDistance({10, 0, 0}), 9.0);
+    ASSERT_EQ(gradient, Eigen::Vector3d(1, 0, 0));
+
+    //Only bricks near the surface store samples
+    ASSERT_LT(field->getStoredBrickCount(), (size_t)field->getBrickCounts().prod());
+    ASSERT_GT(field->getStoredBrickCount(), 0u);
+}
+
+TEST(INTERSECTION_TESTS, TEST_SIGNED_DISTANCE_FIELD_BAKE){
+    auto& registry = EngiGraph::ColliderRegistry::getShared();
+    auto torus = registry.getTorus(1.0f, 0.25f, 32, 16);
+    //Baked in parallel, and shared
+    auto parallel = registry.getSignedDistanceField(torus, 0.02);
+    ASSERT_EQ(parallel.get(), registry.getSignedDistanceField(torus, 0.02).get());
+    ASSERT_NE(parallel.get(), registry.getSignedDistanceField(torus, 0.04).get());
+    auto serial = EngiGraph::SignedDistanceField::bake(*torus, 0.02, 3, false);
+    ASSERT_EQ(parallel->getBricks(), serial->getBricks());
+    ASSERT_EQ(parallel->getSamples(), serial->getSamples());
+    //Inside the tube, and in the hole, further from the surface than the band
+    ASSERT_FLOAT_EQ(parallel->getDistance({1, 0, 0}), -parallel->getBand());
+    ASSERT_EQ(parallel->getDistance({0, 0, 0}), parallel->getBand());
+    ASSERT_NEAR(parallel->getDistance({0, 0.27, 1}), 0.02, 0.01);
+
+    //Smaller than samples on the whole grid
+    const Eigen::Vector3i cells = parallel->getBrickCounts() * EngiGraph::SignedDistanceField::BRICK_CELLS;
+    const size_t dense_bytes = (size_t)(cells + Eigen::Vector3i::Ones()).prod() * sizeof(float);
+    ASSERT_LT(parallel->getMemoryUsage(), dense_bytes);
+}
+
+TEST(INTERSECTION_TESTS, TEST_SIGNED_DISTANCE_FIELD_CCD){
+    auto& registry = EngiGraph::ColliderRegistry::getShared();
+    auto box = registry.getBox();
+    //A 10 by 1 by 10 floor with its top at 0.5, and a box falling onto it from 2.1 with 2 to go in the step
+    EngiGraph::PhysicsWorld world;
+    EngiGraph::BodyDescription description{};
+    description.type = EngiGraph::BodyType::STATIC;
+    description.collider = box;
+    description.signed_distance_field = registry.getSignedDistanceField(box, 0.02);
+    description.scale = {10, 1, 10};
+    const uint32_t floor = world.getIndex(world.createBody(description));
+    description = {};
+    description.collider = box;
+    description.position = {0.3, 2.6, -0.4};
+    description.velocity = {0, -200, 0};
+    const uint32_t falling = world.getIndex(world.createBody(description));
+    world.updateCurrentTransforms();
+    world.updateFutureTransforms(0.01);
+    EngiGraph::CollisionBounds bounds;
+    bounds.update(world);
+
+    auto hits = EngiGraph::collideBodies(world, bounds, floor, falling);
+    ASSERT_EQ(hits.size(), 4u);
+    for (const auto& hit : hits) {
+        ASSERT_NEAR(hit.time, 0.8, 1e-3);
+        ASSERT_NEAR(hit.global_point.y(), 0.5, 1e-3);
+        ASSERT_TRUE(hit.normal_a_to_b.isApprox(Eigen::Vector3d(0, 1, 0), 1e-4));
+    }
+    auto reversed = EngiGraph::collideBodies(world, bounds, falling, floor);
+    ASSERT_EQ(reversed.size(), 4u);
+    ASSERT_TRUE(reversed[0].normal_a_to_b.isApprox(Eigen::Vector3d(0, -1, 0), 1e-4));
+
+    //Resting on the floor, but moving away
+    world.setPosition(falling, {0.3, 1.0, -0.4});
+    world.setVelocity(falling, {0, 1, 0});
+    world.updateCurrentTransforms();
+    world.updateFutureTransforms(0.01);
+    bounds.update(world);
+    ASSERT_TRUE(EngiGraph::collideBodies(world, bounds, floor, falling).empty());
+    world.setVelocity(falling, {0, -1, 0});
+    world.updateFutureTransforms(0.01);
+    bounds.update(world);
+    hits = EngiGraph::collideBodies(world, bounds, floor, falling);
+    ASSERT_EQ(hits.size(), 4u);
+    ASSERT_EQ(hits[0].time, 0.0);
+
+    //Grazing the top face, so the march steps shrink and run out before the vertices reach it
+    EngiGraph::PhysicsWorld grazing_world;
+    description = {};
+    description.type = EngiGraph::BodyType::STATIC;
+    description.collider = box;
+    description.signed_distance_field = registry.getSignedDistanceField(box, 0.01);
+    const uint32_t top = grazing_world.getIndex(grazing_world.createBody(description));
+    description = {};
+    description.collider = box;
+    description.scale = {0.01, 0.01, 0.01};
+    description.position = {-0.45, 0.51, 0};
+    description.velocity = {90, -5.5, 0};
+    const uint32_t grazing = grazing_world.getIndex(grazing_world.createBody(description));
+    grazing_world.updateCurrentTransforms();
+    grazing_world.updateFutureTransforms(0.01);
+    bounds.update(grazing_world);
+    hits = EngiGraph::collideBodies(grazing_world, bounds, top, grazing);
+    ASSERT_FALSE(hits.empty());
+    for (const auto& hit : hits) {
+        ASSERT_NEAR(hit.time, 0.09, 0.01);
+        ASSERT_NEAR(hit.global_point.y(), 0.5, 1e-3);
+        ASSERT_TRUE(hit.normal_a_to_b.isApprox(Eigen::Vector3d(0, 1, 0), 1e-2));
+    }
+
+    description = {};
+    description.collider = box;
+    description.signed_distance_field = registry.getSignedDistanceField(box, 0.02);
+    ASSERT_THROW(world.createBody(description), EngiGraph::RuntimeException);
+}
+
+TEST(SCENE_TESTS, TEST_DISTANCE_FIELD_SCENE_AND_RECORDING){
+    auto scene = EngiGraph::parseScene("box 10 1 10\ndistance_field 0.02\nbox 1 1 1\nposition 0.3 3 -0.4\nrotation 1 0 1 20\n");
+    ASSERT_EQ(scene.bodies[0].description.type, EngiGraph::BodyType::STATIC);
+    ASSERT_THROW(EngiGraph::parseScene("terrain test_files/terrain.png\ndistance_field 0.1\n"), EngiGraph::RuntimeException);
+    auto reparsed = EngiGraph::parseScene(EngiGraph::writeScene(scene));
+    ASSERT_EQ(reparsed.bodies[0].distance_field_cell_size, 0.02);
+    ASSERT_EQ(reparsed.bodies[1].distance_field_cell_size, 0.0);
+
+    EngiGraph::VBDSolver solver;
+    solver.gravity = scene.gravity;
+    auto handles = EngiGraph::buildScene(scene, solver.world);
+    auto& world = solver.world;
+    ASSERT_NE(world.signed_distance_fields[0], nullptr);
+    ASSERT_EQ(world.colliders[0], EngiGraph::ColliderRegistry::getShared().getBox());
+
+    EngiGraph::SimulationRecorder recorder;
+    recorder.start(solver);
+    for (int j = 0; j < 150; ++j) {
+        recorder.step(solver, scene.delta_time);
+    }
+    //Resting on the floor, without sinking into it
+    const uint32_t box = world.getIndex(handles[1]);
+    double lowest = 1e9;
+    for (const auto& vertex : world.colliders[box]->vertices) {
+        lowest = std::min(lowest, (world.getColliderTransform(box) * vertex.cast<double>().homogeneous()).y());
+    }
+    ASSERT_GT(lowest, 0.45);
+    ASSERT_LT(lowest, 0.6);
+
+    EngiGraph::saveRecording(recorder.stop(), "distance_field_test.egrec");
+    auto recording = EngiGraph::loadRecording("distance_field_test.egrec");
+    std::remove("distance_field_test.egrec");
+    ASSERT_EQ(recording.initial_world.signed_distance_fields[0]->getSamples(), world.signed_distance_fields[0]->getSamples());
+    ASSERT_EQ(recording.initial_world.signed_distance_fields[1], nullptr);
+    EngiGraph::VBDSolver replay_solver;
+    EngiGraph::SimulationReplay replay(recording);
+    replay.start(replay_solver);
+    while (!replay.isFinished()) {
+        replay.step(replay_solver);
+        ASSERT_TRUE(replay.verify(replay_solver.world));
+    }
+}
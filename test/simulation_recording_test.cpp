@@ -0,0 +1,110 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
+#include "src/Scenes/SimulationRecording.h"
+#include "src/Exceptions/RuntimeException.h"
+
+/**
+ * Record a session with every kind of edit, then check that a replay of the saved file matches it step by step.
+ */
+template<typename Solver> static void testRecordAndReplay(Solver& solver, const std::string& filename) {
+    auto scene = EngiGraph::parseScene("box 10 1 10\nposition 0 -0.5 0\nstatic\nbox 1 1 1\nposition 0 1 0\nbox 1 1 1\nposition 0 3 0\nbox 1 1 1\nposition 3 1 0\n");
+    solver.gravity = {0, -9.8, 0};
+    EngiGraph::buildScene(scene, solver.world);
+    //Run a bit first, recording can start at any point
+    for (int i = 0; i < 5; ++i) solver.step(0.01);
+
+    EngiGraph::SimulationRecorder recorder;
+    recorder.start(solver);
+    EngiGraph::PhysicsWorld start_world = solver.world;
+    for (int i = 0; i < 20; ++i) recorder.step(solver, 0.01);
+
+    solver.world.setVelocity(1, {1, 2, 0});
+    solver.world.wakeBody(1);
+    recorder.recordBodyChanged(solver.world, 1);
+    EngiGraph::BodyDescription description{};
+    description.collider = solver.world.colliders[1];
+    description.position = {-3, 2, 0};
+    recorder.recordBodyAdded(solver.world, solver.world.createBody(description));
+    solver.contact_solver.settings.friction = 0.2;
+    for (int i = 0; i < 20; ++i) recorder.step(solver, 0.005);
+
+    recorder.recordBodyRemoved(solver.world, solver.world.getHandle(2));
+    solver.world.destroyBody(solver.world.getHandle(2));
+    recorder.recordWorldReset(start_world);
+    solver.world = start_world;
+    for (int i = 0; i < 20; ++i) recorder.step(solver, 0.01);
+    EngiGraph::saveRecording(recorder.stop(), filename);
+
+    //Recorded steps are not affected by steps after stopping
+    solver.step(0.01);
+    ASSERT_EQ(recorder.getRecording().steps.size(), 60u);
+
+    auto recording = EngiGraph::loadRecording(filename);
+    std::remove(filename.c_str());
+    ASSERT_EQ(recording.steps.size(), 60u);
+    ASSERT_EQ(recording.edits.size(), 5u);
+    ASSERT_EQ(recording.edits[2].type, EngiGraph::RecordedEditType::SETTINGS);
+    ASSERT_EQ(recording.edits[2].step, 20u);
+
+    Solver replay_solver;
+    EngiGraph::SimulationReplay replay(recording);
+    replay.start(replay_solver);
+    ASSERT_EQ(replay_solver.world.hashState(), recording.initial_world.hashState());
+    while (!replay.isFinished()) {
+        replay.step(replay_solver);
+        ASSERT_TRUE(replay.verify(replay_solver.world)) << "step " << replay.getStep();
+    }
+    ASSERT_EQ(replay_solver.contact_solver.settings.friction, 0.2);
+    ASSERT_THROW(replay.step(replay_solver), EngiGraph::RuntimeException);
+}
+
+TEST(RECORDING_TESTS, TEST_REPLAY_TOI){
+    EngiGraph::TOISolver solver;
+    solver.integration_mode = EngiGraph::TOISolver::IntegrationMode::SPECULATIVE;
+    testRecordAndReplay(solver, "recording_toi_test.egrec");
+}
+
+TEST(RECORDING_TESTS, TEST_REPLAY_VBD){
+    EngiGraph::VBDSolver solver;
+    testRecordAndReplay(solver, "recording_vbd_test.egrec");
+}
+
+TEST(RECORDING_TESTS, TEST_REPLAY_DETECTS_DIVERGENCE){
+    EngiGraph::VBDSolver solver;
+    solver.gravity = {0, -9.8, 0};
+    EngiGraph::buildScene(EngiGraph::parseScene("box 1 1 1\nbox 1 1 1\nposition 0 2 0\n"), solver.world);
+    EngiGraph::SimulationRecorder recorder;
+    recorder.start(solver);
+    for (int i = 0; i < 10; ++i) recorder.step(solver, 0.01);
+    //An edit that was not reported makes the replay drift apart
+    solver.world.setVelocity(0, {0, 1, 0});
+    for (int i = 0; i < 10; ++i) recorder.step(solver, 0.01);
+
+    EngiGraph::VBDSolver replay_solver;
+    EngiGraph::SimulationReplay replay(recorder.stop());
+    replay.start(replay_solver);
+    while (!replay.isFinished() && replay.verify(replay_solver.world)) replay.step(replay_solver);
+    ASSERT_EQ(replay.getStep(), 11u);
+
+    EngiGraph::TOISolver wrong_solver;
+    ASSERT_THROW(replay.start(wrong_solver), EngiGraph::RuntimeException);
+}
+
+TEST(RECORDING_TESTS, TEST_BAD_RECORDING_FILE){
+    {
+        std::ofstream file("bad_recording_test.egrec", std::ios::binary);
+        file << "EGREC001";
+    }
+    ASSERT_THROW(EngiGraph::loadRecording("bad_recording_test.egrec"), EngiGraph::RuntimeException);
+    {
+        std::ofstream file("bad_recording_test.egrec", std::ios::binary);
+        file << "not a recording";
+    }
+    ASSERT_THROW(EngiGraph::loadRecording("bad_recording_test.egrec"), EngiGraph::RuntimeException);
+    std::remove("bad_recording_test.egrec");
+    ASSERT_THROW(EngiGraph::loadRecording("missing_recording_test.egrec"), EngiGraph::RuntimeException);
+}
@@ -0,0 +1,64 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/Islands/Sleeping.h"
+#include "src/Physics/VBD/VbdSolver.h"
+
+TEST(PHYSICS_TESTS, TEST_ISLAND_GRAPH){
+    EngiGraph::IslandGraph islands(5);
+    islands.link(0,1);
+    islands.link(3,4);
+    islands.link(1,4);
+    ASSERT_EQ(islands.findIsland(0), islands.findIsland(3));
+    ASSERT_EQ(islands.findIsland(1), islands.findIsland(4));
+    ASSERT_NE(islands.findIsland(2), islands.findIsland(0));
+}
+
+TEST(PHYSICS_TESTS, TEST_ISLAND_SLEEP){
+    EngiGraph::SleepSettings settings{};
+    EngiGraph::IslandGraph islands(3);
+    islands.link(0,1);
+
+    //Body 0 has not rested long enough, so its island stays awake, while lone body 2 falls asleep.
+    std::vector<EngiGraph::SleepState> states = {{0.1, false}, {1.0, false}, {1.0, false}};
+    auto transitions = EngiGraph::updateIslandSleep(islands, states, settings);
+    ASSERT_EQ(transitions[0], EngiGraph::SleepTransition::NONE);
+    ASSERT_EQ(transitions[1], EngiGraph::SleepTransition::NONE);
+    ASSERT_EQ(transitions[2], EngiGraph::SleepTransition::FALL_ASLEEP);
+
+    //A moving body touching a sleeping one wakes it.
+    states = {{0.0, false}, {1.0, true}, {1.0, true}};
+    transitions = EngiGraph::updateIslandSleep(islands, states, settings);
+    ASSERT_EQ(transitions[1], EngiGraph::SleepTransition::WAKE_UP);
+    ASSERT_EQ(transitions[2], EngiGraph::SleepTransition::NONE);
+
+    //Resting time only builds up below the thresholds
+    EngiGraph::SleepState state{};
+    EngiGraph::updateRestingTime(state, {0.01,0,0}, {0,0,0}, 0.1, settings);
+    ASSERT_DOUBLE_EQ(state.resting_time, 0.1);
+    EngiGraph::updateRestingTime(state, {1.0,0,0}, {0,0,0}, 0.1, settings);
+    ASSERT_DOUBLE_EQ(state.resting_time, 0.0);
+}
+
+TEST(PHYSICS_TESTS, TEST_VBD_SLEEP_AND_WAKE){
+    EngiGraph::VBDSolver solver;
+    auto box_a = solver.addBox(1.0, Eigen::Vector3d{1,1,1});
+    auto box_b = solver.addBox(1.0, Eigen::Vector3d{1,1,1}, {5,0,0});
+    auto& world = solver.world;
+
+    //Nothing is moving, so both boxes fall asleep once the time window passes.
+    for (int j = 0; j < 60; ++j) {
+        solver.step(0.01);
+    }
+    ASSERT_TRUE(world.hasFlag(world.getIndex(box_a), EngiGraph::BODY_FLAG_SLEEPING));
+    ASSERT_TRUE(world.hasFlag(world.getIndex(box_b), EngiGraph::BODY_FLAG_SLEEPING));
+
+    //Editing a body wakes it, and it then wakes the body it runs into.
+    world.setVelocity(world.getIndex(box_b), {-10,0,0});
+    world.wakeBody(world.getIndex(box_b));
+    for (int j = 0; j < 50 && world.hasFlag(world.getIndex(box_a), EngiGraph::BODY_FLAG_SLEEPING); ++j) {
+        solver.step(0.01);
+    }
+    ASSERT_FALSE(world.hasFlag(world.getIndex(box_a), EngiGraph::BODY_FLAG_SLEEPING));
+}
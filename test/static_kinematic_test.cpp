@@ -0,0 +1,145 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Physics/Collisions/BodyCollision.h"
+#include "src/Physics/Collisions/CollisionBounds.h"
+#include "src/Physics/Collisions/ColliderRegistry.h"
+#include "src/Exceptions/RuntimeException.h"
+#include "src/Geometry/MeshUtilities.h"
+
+static EngiGraph::BodyHandle addBody(EngiGraph::PhysicsWorld& world, EngiGraph::BodyType type, const Eigen::Vector3d& position, const Eigen::Vector3d& scale = {1,1,1}) {
+    EngiGraph::BodyDescription description{};
+    description.collider = EngiGraph::ColliderRegistry::getShared().getBox();
+    description.type = type;
+    description.position = position;
+    description.scale = scale;
+    return world.createBody(description);
+}
+
+TEST(PHYSICS_TESTS, TEST_BODY_TYPES){
+    EngiGraph::PhysicsWorld world;
+    const uint32_t ground = world.getIndex(addBody(world, EngiGraph::BodyType::STATIC, {0,0,0}));
+    const uint32_t platform = world.getIndex(addBody(world, EngiGraph::BodyType::KINEMATIC, {0,5,0}));
+    const uint32_t box = world.getIndex(addBody(world, EngiGraph::BodyType::DYNAMIC, {0,2,0}));
+    ASSERT_EQ(world.getBodyType(ground), EngiGraph::BodyType::STATIC);
+    ASSERT_EQ(world.getBodyType(platform), EngiGraph::BodyType::KINEMATIC);
+    ASSERT_TRUE(world.isDynamic(box));
+    ASSERT_EQ(world.getMass(ground), 0.0);
+    ASSERT_EQ(world.getMass(platform), 0.0);
+
+    //Only pairs with a dynamic body collide
+    ASSERT_TRUE(world.canPairCollide(ground, box));
+    ASSERT_TRUE(world.canPairCollide(platform, box));
+    ASSERT_FALSE(world.canPairCollide(ground, platform));
+    world.sleepBody(box);
+    ASSERT_FALSE(world.canPairCollide(ground, box));
+    ASSERT_TRUE(world.canPairCollide(platform, box));
+
+    //Gravity moves neither static nor kinematic bodies
+    world.wakeBody(box);
+    world.setVelocity(platform, {1,0,0});
+    world.integrateForces(0.1, {0,-10,0});
+    world.integratePositions(0.1);
+    ASSERT_EQ(world.getPosition(ground), Eigen::Vector3d(0,0,0));
+    ASSERT_EQ(world.getVelocity(ground), Eigen::Vector3d(0,0,0));
+    ASSERT_TRUE(world.getPosition(platform).isApprox(Eigen::Vector3d(0.1,5,0), 1e-12));
+    ASSERT_LT(world.getVelocity(box).y(), 0.0);
+}
+
+TEST(PHYSICS_TESTS, TEST_KINEMATIC_TARGET){
+    EngiGraph::PhysicsWorld world;
+    const uint32_t platform = world.getIndex(addBody(world, EngiGraph::BodyType::KINEMATIC, {1,2,3}));
+    const uint32_t box = world.getIndex(addBody(world, EngiGraph::BodyType::DYNAMIC, {0,0,0}));
+    ASSERT_THROW(world.setKinematicTarget(box, {0,0,0}, Eigen::Quaterniond::Identity(), 0.1), EngiGraph::RuntimeException);
+
+    const Eigen::Vector3d target_position = {2,2,2.5};
+    const Eigen::Quaterniond target_rotation(Eigen::AngleAxisd(0.7, Eigen::Vector3d{1,2,0}.normalized()));
+    world.setKinematicTarget(platform, target_position, target_rotation, 0.05);
+    world.integratePositions(0.05);
+    ASSERT_TRUE(world.getPosition(platform).isApprox(target_position, 1e-9));
+    ASSERT_NEAR(world.getRotation(platform).angularDistance(target_rotation), 0.0, 1e-3);
+}
+
+TEST(PHYSICS_TESTS, TEST_STATIC_BOUNDS_BAKED_ONCE){
+    EngiGraph::PhysicsWorld world;
+    for (int i = 0; i < 8; ++i) {
+        addBody(world, EngiGraph::BodyType::STATIC, {4.0 * i, 0, 0});
+    }
+    const uint32_t box = world.getIndex(addBody(world, EngiGraph::BodyType::DYNAMIC, {0,1.0,0}));
+    EngiGraph::CollisionBounds bounds;
+    for (int j = 0; j < 5; ++j) {
+        world.updateFutureTransforms(0.01);
+        bounds.update(world);
+    }
+    ASSERT_EQ(bounds.getStaticBakeCount(), 8u);
+    //Touching neighbour kept, far away bodies culled
+    ASSERT_TRUE(bounds.overlaps(0, box));
+    ASSERT_FALSE(bounds.overlaps(3, box));
+
+    //Moving a static body rebakes only that body
+    world.setPosition(3, {0, 2.0, 0});
+    world.updateCurrentTransforms();
+    world.updateFutureTransforms(0.01);
+    bounds.update(world);
+    ASSERT_EQ(bounds.getStaticBakeCount(), 9u);
+    ASSERT_TRUE(bounds.overlaps(3, box));
+}
+
+TEST(PHYSICS_TESTS, TEST_STATIC_TRIANGLES_BAKED){
+    EngiGraph::PhysicsWorld world;
+    auto torus = std::make_shared<const EngiGraph::Mesh>(EngiGraph::makeTorusMesh(2.0f, 0.5f, 32, 16));
+    EngiGraph::BodyDescription description{};
+    description.collider = torus;
+    description.type = EngiGraph::BodyType::STATIC;
+    description.rotation = Eigen::AngleAxisd(0.3, Eigen::Vector3d::UnitZ());
+    const auto ring = world.createBody(description);
+    const uint32_t box = world.getIndex(addBody(world, EngiGraph::BodyType::DYNAMIC, {3.5,0,0}, {0.2,0.2,0.2}));
+    world.setVelocity(box, {-150,0,0});
+    EngiGraph::CollisionBounds bounds;
+    world.updateFutureTransforms(0.01);
+    bounds.update(world);
+    const uint32_t ring_index = world.getIndex(ring);
+    ASSERT_EQ(bounds.getStaticTriangles(box), nullptr);
+    ASSERT_EQ(bounds.getStaticTriangles(ring_index)->getItemCount(), torus->triangle_indices.size() / 3);
+
+    //Only the triangles near the box are tested, which finds the same hits as the whole mesh
+    const auto hits = EngiGraph::collideBodies(world, bounds, ring_index, box);
+    const auto expected = EngiGraph::linearCCD(*torus, *world.colliders[box], world.current_transforms[ring_index], world.current_transforms[box],
+                                               world.future_transforms[ring_index], world.future_transforms[box]);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(hits.size(), expected.size());
+    for (size_t j = 0; j < hits.size(); ++j) {
+        ASSERT_EQ(hits[j].time, expected[j].time);
+        ASSERT_TRUE(hits[j].global_point.isApprox(expected[j].global_point));
+        ASSERT_TRUE(hits[j].normal_a_to_b.isApprox(expected[j].normal_a_to_b));
+    }
+
+    //What was baked for a body is freed with it
+    std::weak_ptr<const EngiGraph::Mesh> weak_torus = torus;
+    torus.reset();
+    description.collider.reset();
+    world.destroyBody(ring);
+    ASSERT_TRUE(weak_torus.expired());
+}
+
+TEST(PHYSICS_TESTS, TEST_VBD_STATIC_AND_KINEMATIC){
+    EngiGraph::VBDSolver solver;
+    solver.gravity = {0,-9.8,0};
+    auto& world = solver.world;
+    const uint32_t ground = world.getIndex(addBody(world, EngiGraph::BodyType::STATIC, {0,0,0}, {10,1,10}));
+    const uint32_t platform = world.getIndex(addBody(world, EngiGraph::BodyType::KINEMATIC, {20,0,0}));
+    const uint32_t box = world.getIndex(addBody(world, EngiGraph::BodyType::DYNAMIC, {0,1.1,0}));
+    world.setVelocity(platform, {0,1,0});
+    for (int j = 0; j < 100; ++j) {
+        solver.step(0.01);
+    }
+    //Box rests on the ground, which never moved
+    ASSERT_GT(world.getPosition(box).y(), 0.9);
+    ASSERT_LT(world.getPosition(box).y(), 1.1);
+    ASSERT_EQ(world.getPosition(ground), Eigen::Vector3d(0,0,0));
+    //Platform keeps its velocity
+    ASSERT_NEAR(world.getPosition(platform).y(), 1.0, 1e-9);
+    ASSERT_EQ(world.getVelocity(platform), Eigen::Vector3d(0,1,0));
+}
@@ -0,0 +1,48 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Profiling/StepProfileHistory.h"
+#include "src/Physics/VBD/VbdSolver.h"
+#include "src/Scenes/SceneDescription.h"
+
+TEST(PROFILING_TESTS, TEST_STEP_PROFILE_HISTORY){
+    EngiGraph::StepProfileHistory history(3);
+    for (int i = 1; i <= 5; ++i) {
+        EngiGraph::StepProfile profile{};
+        profile.total_seconds = i * 0.001;
+        profile.phase_seconds[EngiGraph::StepProfile::PHASE_COLLISION] = i * 0.002;
+        profile.hits = i;
+        history.push(profile);
+    }
+    //Only the newest 3 are kept, oldest first
+    ASSERT_EQ(history.getCount(), 3u);
+    ASSERT_EQ(history.get(0).hits, 3u);
+    ASSERT_EQ(history.get(2).hits, 5u);
+    ASSERT_EQ(history.getAverage().hits, 4u);
+    auto collision = history.getMilliseconds(EngiGraph::StepProfile::PHASE_COLLISION);
+    ASSERT_EQ(collision.size(), 3u);
+    ASSERT_NEAR(collision[0], 6.0f, 1e-4);
+    ASSERT_NEAR(history.getMilliseconds(EngiGraph::StepProfile::PHASE_COUNT)[2], 5.0f, 1e-4);
+    history.clear();
+    ASSERT_EQ(history.getCount(), 0u);
+}
+
+TEST(PROFILING_TESTS, TEST_SOLVER_PROFILE){
+    EngiGraph::VBDSolver solver;
+    solver.sleep_settings.enabled = false;
+    auto scene = EngiGraph::parseScene("box 4 0.5 4\nstatic\nbox 1 1 1\nposition 0 0.8 0\nvelocity 0 -100 0\nbox 1 1 1\nposition 10 0 0\n");
+    EngiGraph::buildScene(scene, solver.world);
+    solver.step(0.01);
+    const auto& profile = solver.profile;
+    //The far box is culled by its bounds
+    ASSERT_EQ(profile.pairs_tested, 1u);
+    ASSERT_GT(profile.hits, 0u);
+    ASSERT_GT(profile.contacts, 0u);
+    ASSERT_GT(profile.solver_iterations, 0u);
+    ASSERT_EQ(profile.toi_iterations, 0u);
+    double phase_total = 0.0;
+    for (double seconds : profile.phase_seconds) phase_total += seconds;
+    ASSERT_GT(profile.total_seconds, 0.0);
+    ASSERT_LE(phase_total, profile.total_seconds);
+}
@@ -0,0 +1,84 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/TOISolver/ToiSolver.h"
+#include "src/Geometry/MeshConversions.h"
+#include "src/FileIO/ObjLoader.h"
+
+/**
+ * Load a box collider centered on the origin.
+ */
+static std::shared_ptr<const EngiGraph::Mesh> loadBox(const Eigen::Vector3f& dimensions) {
+    auto raw_mesh_cube = EngiGraph::loadOBJ("./test_files/cube.obj");
+    for (auto& vertex : raw_mesh_cube[0].vertices) {
+        vertex.position = (vertex.position - Eigen::Vector3f{0.5,0.5,0.5}).cwiseProduct(dimensions);
+    }
+    return std::make_shared<const EngiGraph::Mesh>(EngiGraph::stripVisualMesh(raw_mesh_cube[0]));
+}
+
+TEST(PHYSICS_TESTS, TEST_SPECULATIVE_NO_TUNNELING){
+    EngiGraph::TOISolver solver;
+    solver.integration_mode = EngiGraph::TOISolver::IntegrationMode::SPECULATIVE;
+    solver.gravity = {0,0,0};
+    solver.sleep_settings.enabled = false;
+
+    //Thin static wall
+    EngiGraph::BodyDescription description{};
+    description.collider = loadBox({0.05,4,4});
+    description.mass = 0.0;
+    description.gravity = false;
+    solver.world.createBody(description);
+
+    //Box moving several of its own lengths per step
+    description.collider = loadBox({0.5,0.5,0.5});
+    description.mass = 1.0;
+    description.gravity = true;
+    description.position = {-1.5,0,0};
+    description.velocity = {150,0,0};
+    auto box = solver.world.createBody(description);
+
+    //The first step stops the box right at the wall, instead of carrying it 1.5 units through
+    solver.step(0.01);
+    ASSERT_NEAR(solver.world.getPosition(solver.world.getIndex(box)).x(), -0.275, 1e-2);
+    for (int j = 0; j < 10; ++j) {
+        solver.step(0.01);
+        ASSERT_LT(solver.world.getPosition(solver.world.getIndex(box)).x(), 0.0);
+    }
+}
+
+TEST(PHYSICS_TESTS, TEST_SPECULATIVE_STACK_ON_FLOOR){
+    EngiGraph::TOISolver solver;
+    solver.integration_mode = EngiGraph::TOISolver::IntegrationMode::SPECULATIVE;
+
+    EngiGraph::BodyDescription description{};
+    description.collider = loadBox({10,0.5,10});
+    description.position = {0,-0.25,0};
+    description.mass = 0.0;
+    description.gravity = false;
+    solver.world.createBody(description);
+
+    //A stack resting on the floor, and a box dropped onto its edge next to it
+    std::vector<EngiGraph::BodyHandle> boxes;
+    description.collider = loadBox({1,1,1});
+    description.mass = 1.0;
+    description.gravity = true;
+    for (const Eigen::Vector3d& position : {Eigen::Vector3d{0,0.55,0}, Eigen::Vector3d{0.2,1.6,0.15}, Eigen::Vector3d{-0.1,2.65,0.1}}) {
+        description.position = position;
+        boxes.push_back(solver.world.createBody(description));
+    }
+    description.position = {3,3,0};
+    description.rotation = Eigen::Quaterniond(Eigen::AngleAxisd(0.5, Eigen::Vector3d::UnitX()));
+    boxes.push_back(solver.world.createBody(description));
+
+    for (int j = 0; j < 600; ++j) {
+        solver.step(0.01);
+        for (auto box : boxes) {
+            ASSERT_GT(solver.world.getPosition(solver.world.getIndex(box)).y(), 0.45);
+        }
+    }
+    //Each box of the stack ends up resting on the one below
+    for (size_t j = 0; j < 3; ++j) {
+        ASSERT_NEAR(solver.world.getPosition(solver.world.getIndex(boxes[j])).y(), 0.5 + j, 0.02);
+    }
+}
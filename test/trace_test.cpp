@@ -0,0 +1,39 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include <thread>
+#include "src/Profiling/Trace.h"
+
+TEST(PROFILING_TESTS, TEST_CHROME_TRACE){
+    EngiGraph::clearTrace();
+    {
+        EngiGraph::TraceScope scope("not recorded");
+    }
+    EngiGraph::setTracingEnabled(true);
+    EngiGraph::setTraceThreadName("Test \"main\"");
+    {
+        EngiGraph::TraceScope scope("outer");
+        EngiGraph::TraceScope inner("inner");
+    }
+    std::thread worker([](){
+        EngiGraph::setTraceThreadName("Worker");
+        EngiGraph::TraceScope scope("on worker");
+    });
+    worker.join();
+    EngiGraph::setTracingEnabled(false);
+
+    //Events of exited threads are kept
+    std::string json = EngiGraph::getChromeTraceJson();
+    ASSERT_EQ(json.find("not recorded"), std::string::npos);
+    ASSERT_NE(json.find("{\"name\":\"outer\",\"cat\":\"EngiGraph\",\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(json.find("\"inner\""), std::string::npos);
+    ASSERT_NE(json.find("\"on worker\""), std::string::npos);
+    ASSERT_NE(json.find("\"Worker\""), std::string::npos);
+    ASSERT_NE(json.find("\"Test \\\"main\\\"\""), std::string::npos);
+    ASSERT_EQ(json.front(), '{');
+    ASSERT_EQ(json.back(), '}');
+
+    EngiGraph::clearTrace();
+    ASSERT_EQ(EngiGraph::getChromeTraceJson().find("\"outer\""), std::string::npos);
+}
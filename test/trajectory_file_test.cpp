@@ -0,0 +1,114 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include "src/FileIO/LzCompression.h"
+#include "src/FileIO/TrajectoryFile.h"
+#include "src/Exceptions/RuntimeException.h"
+
+TEST(TRAJECTORY_TESTS, TEST_LZ_ROUND_TRIP){
+    std::mt19937 random(7);
+    std::vector<std::vector<uint8_t>> inputs{{}, {1}, {1, 2, 3, 4, 5, 6}};
+    //Repetitive data, long runs, and noise
+    std::vector<uint8_t> repetitive;
+    for (int i = 0; i < 10000; ++i) repetitive.push_back((uint8_t)(i % 37));
+    inputs.push_back(repetitive);
+    inputs.emplace_back(70000, 0);
+    std::vector<uint8_t> noise(5000);
+    for (auto& byte : noise) byte = (uint8_t)random();
+    inputs.push_back(noise);
+
+    for (const auto& input : inputs) {
+        auto compressed = EngiGraph::compressLz(input.data(), input.size());
+        std::vector<uint8_t> output(input.size());
+        EngiGraph::decompressLz(compressed.data(), compressed.size(), output.data(), output.size());
+        ASSERT_EQ(output, input);
+    }
+    ASSERT_LT(EngiGraph::compressLz(repetitive.data(), repetitive.size()).size(), repetitive.size() / 20);
+
+    auto compressed = EngiGraph::compressLz(repetitive.data(), repetitive.size());
+    std::vector<uint8_t> output(repetitive.size());
+    ASSERT_THROW(EngiGraph::decompressLz(compressed.data(), compressed.size() / 2, output.data(), output.size()), EngiGraph::RuntimeException);
+    ASSERT_THROW(EngiGraph::decompressLz(compressed.data(), compressed.size(), output.data(), output.size() - 1), EngiGraph::RuntimeException);
+}
+
+/**
+ * A few bodies moving and spinning, with one added part way through.
+ */
+static void moveBodies(EngiGraph::PhysicsWorld& world, int step) {
+    for (uint32_t i = 0; i < world.getBodyCount(); ++i) {
+        world.setPosition(i, {i + 0.01 * step, -0.5 * step * step * 1e-3, 100.0 * i});
+        world.setRotation(i, Eigen::Quaterniond(Eigen::AngleAxisd(0.05 * step * (i + 1), Eigen::Vector3d(1, 2, 3).normalized())));
+    }
+}
+
+TEST(TRAJECTORY_TESTS, TEST_WRITE_AND_SEEK){
+    const std::string filename = "trajectory_test.egtrj";
+    EngiGraph::PhysicsWorld world;
+    world.createBody({});
+    world.createBody({});
+    {
+        EngiGraph::TrajectoryWriter writer(filename, 0.01, {16, 1e-4, true});
+        for (int step = 0; step < 100; ++step) {
+            if(step == 40) world.createBody({});
+            moveBodies(world, step);
+            writer.append(world);
+        }
+        ASSERT_EQ(writer.getStepCount(), 100u);
+    }
+
+    EngiGraph::TrajectoryReader reader(filename);
+    ASSERT_EQ(reader.getStepCount(), 100u);
+    ASSERT_EQ(reader.getDeltaTime(), 0.01);
+    //The added body ends a chunk early: 0-15, 16-31, 32-39, 40-55, 56-71, 72-87, 88-99
+    ASSERT_EQ(reader.getChunkCount(), 7u);
+
+    //Out of order reads, including backwards within a chunk
+    EngiGraph::PhysicsWorld expected;
+    for (int step : {99, 0, 57, 50, 39, 40, 41, 15, 16, 3}) {
+        const auto& frame = reader.readStep(step);
+        ASSERT_EQ(frame.step, (uint64_t)step);
+        ASSERT_EQ(frame.getBodyCount(), step >= 40 ? 3u : 2u);
+        expected = world;
+        moveBodies(expected, step);
+        for (uint32_t i = 0; i < frame.getBodyCount(); ++i) {
+            ASSERT_EQ(frame.handles[i], world.getHandle(i));
+            ASSERT_LE((frame.positions[i] - expected.getPosition(i)).cwiseAbs().maxCoeff(), 0.5e-4 + 1e-9);
+            ASSERT_LT(frame.rotations[i].angularDistance(expected.getRotation(i)), 1e-3);
+        }
+    }
+    ASSERT_THROW(reader.readStep(100), EngiGraph::RuntimeException);
+    std::remove(filename.c_str());
+}
+
+TEST(TRAJECTORY_TESTS, TEST_READ_UNCLOSED_FILE){
+    const std::string filename = "trajectory_unclosed_test.egtrj";
+    const std::string copy = "trajectory_unclosed_copy_test.egtrj";
+    EngiGraph::PhysicsWorld world;
+    world.createBody({});
+    {
+        EngiGraph::TrajectoryWriter writer(filename, 0.02, {10, 1e-3, false});
+        for (int step = 0; step < 35; ++step) {
+            moveBodies(world, step);
+            writer.append(world);
+        }
+        //Copy before the writer closes, like a file left behind by a crash. Only whole chunks are on disk.
+        std::filesystem::copy_file(filename, copy, std::filesystem::copy_options::overwrite_existing);
+    }
+    EngiGraph::TrajectoryReader reader(copy);
+    ASSERT_EQ(reader.getStepCount(), 30u);
+    ASSERT_NEAR(reader.readStep(29).positions[0].x(), 0.29, 1e-3);
+    std::remove(filename.c_str());
+    std::remove(copy.c_str());
+
+    {
+        std::ofstream file("trajectory_bad_test.egtrj", std::ios::binary);
+        file << "not a trajectory at all, not even close";
+    }
+    ASSERT_THROW(EngiGraph::TrajectoryReader("trajectory_bad_test.egtrj"), EngiGraph::RuntimeException);
+    std::remove("trajectory_bad_test.egtrj");
+}
@@ -0,0 +1,92 @@
+//
+// Created by Philip on 10/19/2026.
+//
+#include "gtest/gtest.h"
+#include "src/Physics/World/WorldSnapshot.h"
+#include "src/Exceptions/RuntimeException.h"
+
+static EngiGraph::PhysicsWorld makeWorld() {
+    EngiGraph::PhysicsWorld world;
+    auto collider = std::make_shared<const EngiGraph::Mesh>();
+    EngiGraph::BodyDescription description{};
+    description.collider = collider;
+    description.mass = 0.0;
+    world.createBody(description);
+    description.mass = 2.0;
+    for (int i = 0; i < 4; ++i) {
+        description.position = {0, 1.0 + i, 0};
+        world.createBody(description);
+    }
+    return world;
+}
+
+TEST(SNAPSHOT_TESTS, TEST_CAPTURE_AND_RESTORE){
+    EngiGraph::PhysicsWorld world = makeWorld();
+    const uint64_t hash = world.hashState();
+    auto snapshot = EngiGraph::WorldSnapshot::capture(world);
+    //Colliders are shared with the world, never copied
+    const auto* collider = world.colliders[1].get();
+
+    //Change state, add and remove bodies, then go back
+    world.setVelocity(2, {1, 2, 3});
+    world.destroyBody(world.getHandle(1));
+    EngiGraph::BodyDescription description{};
+    world.createBody(description);
+    world.createBody(description);
+    snapshot.restore(world);
+    ASSERT_EQ(world.hashState(), hash);
+    ASSERT_EQ(world.getBodyCount(), 5u);
+    ASSERT_EQ(world.colliders[1].get(), collider);
+    ASSERT_EQ(world.current_transforms.size(), 5u);
+    ASSERT_EQ(world.current_transforms[3], world.getTransform(3));
+    //Handles are restored too
+    ASSERT_EQ(world.createBody(description), makeWorld().createBody(description));
+
+    EngiGraph::WorldSnapshot empty;
+    empty.restore(world);
+    ASSERT_EQ(world.getBodyCount(), 0u);
+}
+
+TEST(SNAPSHOT_TESTS, TEST_COPY_ON_WRITE){
+    EngiGraph::PhysicsWorld world = makeWorld();
+    auto first = EngiGraph::WorldSnapshot::capture(world);
+    world.setPosition(3, {5, 5, 5});
+    auto second = EngiGraph::WorldSnapshot::capture(world, &first);
+    //position_x, y and z changed, everything else is shared
+    ASSERT_FALSE(second.isArrayShared(first, 0));
+    ASSERT_FALSE(second.isArrayShared(first, 2));
+    ASSERT_TRUE(second.isArrayShared(first, 3));
+    ASSERT_TRUE(second.isArrayShared(first, 16));
+    ASSERT_TRUE(second.isColliderTableShared(first));
+
+    world.colliders[2] = std::make_shared<const EngiGraph::Mesh>();
+    auto third = EngiGraph::WorldSnapshot::capture(world, &second);
+    ASSERT_FALSE(third.isColliderTableShared(second));
+    ASSERT_TRUE(third.isArrayShared(second, 0));
+
+    //Restoring an older snapshot is not affected by later ones
+    first.restore(world);
+    ASSERT_EQ(world.getPosition(3), Eigen::Vector3d(0, 3, 0));
+}
+
+TEST(SNAPSHOT_TESTS, TEST_REWIND_RING){
+    EngiGraph::PhysicsWorld world = makeWorld();
+    EngiGraph::WorldSnapshotRing ring(5, 2);
+    ASSERT_THROW(ring.rewind(world, 0), EngiGraph::RuntimeException);
+    for (uint64_t step = 1; step <= 20; ++step) {
+        world.setPosition(1, {(double)step, 0, 0});
+        ring.update(world, step);
+    }
+    //Every second step, only the last 5 kept
+    ASSERT_EQ(ring.getCount(), 5u);
+    ASSERT_EQ(ring.getOldestStep(), 11u);
+    ASSERT_EQ(ring.getNewestStep(), 19u);
+
+    ASSERT_EQ(ring.rewind(world, 16), 15u);
+    ASSERT_EQ(world.getPosition(1).x(), 15.0);
+    ASSERT_EQ(ring.getNewestStep(), 15u);
+    //Too far back lands on the oldest snapshot
+    ASSERT_EQ(ring.rewind(world, 2), 11u);
+    ASSERT_EQ(world.getPosition(1).x(), 11.0);
+    ASSERT_EQ(ring.getCount(), 1u);
+}